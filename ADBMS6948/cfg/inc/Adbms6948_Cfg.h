@@ -51,12 +51,30 @@ Analog Devices License Agreement.
 #define ADBMS6948_INSTANCE_ID_CFG                 	0U
 
 
-/** The configuration of the number of daisy chains connected to the BMS Controller */
+/** The configuration of the number of daisy chains connected to the BMS Controller. Each chain
+    needs its own SPI and chip select binding in the platform layer. */
+#ifndef ADBMS6948_NO_OF_DAISY_CHAIN
 #define ADBMS6948_NO_OF_DAISY_CHAIN                   (1U)
-/** The maximum number of BMS devices connected in a single daisy chain */
+#endif
+/** The maximum number of BMS devices connected in a single daisy chain. All frame buffers of the
+    driver and the platform layer are sized from it. */
+#ifndef ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN
 #define ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN    (1U)
+#endif
 /** The configuration of the Development mode for the ADBMS6948 SW driver */
 #define ADBMS6948_DEVELOPMENT_MODE_EN    FALSE
+/** The configuration of the asynchronous SPI transport for register group reads */
+#define ADBMS6948_SPI_ASYNC_EN           TRUE
+/** Longest wait for one asynchronous register group transfer in microseconds, the transfer is
+    aborted and the read fails after it */
+#define ADBMS6948_SPI_ASYNC_TIMEOUT_US   ((uint32_t)5000u)
+/** Number of command counter verifications served from the command counter received with the
+    read data before configuration register A is read again for an explicit check. 1 reads
+    configuration register A on every verification. */
+#define ADBMS6948_CMDCNT_VERIFY_PERIOD   ((uint8_t)8u)
+/** Number of configuration register updates written from the driver's shadow copy before one
+    is read back for verification. 1 reads back every update. */
+#define ADBMS6948_CFG_VERIFY_PERIOD      ((uint8_t)4u)
 
 
 /** Configuration to select the maximum divide factor to calculate the OW threshold for CADC.*/
@@ -67,6 +85,14 @@ Analog Devices License Agreement.
 #define ADBMS6948_SADC_OW_MAX_DIV_FACTOR	((uint16_t)12u)
 /** Configuration to select the minimum divide factor to calculate the OW threshold for SADC.*/
 #define ADBMS6948_SADC_OW_MIN_DIV_FACTOR	((uint16_t)8u)
+/** Configuration of the I1-ADC open wire thresholds, difference of the current codes in uV
+    above which the input is open and below which it is closed.*/
+#define ADBMS6948_I1ADC_OW_OPEN_DELTA		((uint32_t)10000u)
+#define ADBMS6948_I1ADC_OW_CLOSED_DELTA		((uint32_t)2000u)
+/** Configuration of the I2-ADC open wire thresholds, difference of the current codes in uV
+    above which the input is open and below which it is closed.*/
+#define ADBMS6948_I2ADC_OW_OPEN_DELTA		((uint32_t)10000u)
+#define ADBMS6948_I2ADC_OW_CLOSED_DELTA		((uint32_t)2000u)
 
 /** Assigns What Comes on OC1 Status Bus */
 #define STATUS_CFG_VAL  ((uint8_t)0x00u)
@@ -129,10 +129,11 @@ static const Adbms6948_DaisyChainCfgType  Adbms6948_ChainConfigData[1u] =
 		0x4E2u, /* Over voltage threshold (val * 16 * 100uV) */
 		0x271u, /* Under voltage threshold (val * 16 * 100uV) */
 		ADBMS6948_FILTER_DISABLED,
-		ADBMS6948_CTH_VOLT_22_5mv,
+		SYS_CS_THRESHOLD,
         ADBMS6948_GPIO11_OC2_MODE,    /*GPIO11 mode*/
         &Adbms6948_koOC1CfgData,      /*OC1 configuration*/
-        &Adbms6948_koOC2CfgData       /*OC2 configuration*/
+        &Adbms6948_koOC2CfgData,      /*OC2 configuration*/
+        FALSE                         /*Warm init*/
 	},
 };
 
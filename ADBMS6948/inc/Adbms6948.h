@@ -93,6 +93,27 @@ typedef uint16_t Adbms6948_OVThresCfgType;
  */
 typedef uint16_t Adbms6948_UVThresCfgType;
 
+/**
+ * PWM discharge duty cycle type, one per cell \n
+ * 0 - Discharge off \n
+ * 1 to ADBMS6948_PWM_DUTY_MAX - Discharge switch on for (value/15) of the PWM period
+ */
+typedef uint8_t Adbms6948_PwmDutyCfgType;
+
+/** Highest PWM discharge duty cycle, switch always on */
+#define ADBMS6948_PWM_DUTY_MAX		((uint8_t)15u)
+
+/**
+ * Open wire status of a cell or current input, reported by
+ * Adbms6948_CellOWDiag and Adbms6948_CurrentOWDiag
+ */
+/** Wire connected */
+#define ADBMS6948_OW_CLOSED			((uint8_t)0u)
+/** Wire open */
+#define ADBMS6948_OW_OPEN			((uint8_t)1u)
+/** Difference between the thresholds, no decision */
+#define ADBMS6948_OW_UNDECIDED		((uint8_t)2u)
+
 /**
  * Data Type to indicate the Soak Time value for Auxiliary and status conversions in ADBMS6948 device
  */
@@ -163,6 +184,16 @@ typedef enum {
 	ADBMS6948_CTH_VOLT_135mv
 }Adbms6948_CSThresVoltType;
 
+/** Comparison threshold of an Adbms6948_CSThresVoltType in microvolts, a constant expression */
+#define ADBMS6948_CTH_VOLT_TO_UV(eCth) \
+	(((eCth) == ADBMS6948_CTH_VOLT_5_1mV)   ? 5100 : \
+	 ((eCth) == ADBMS6948_CTH_VOLT_8_1mV)   ? 8100 : \
+	 ((eCth) == ADBMS6948_CTH_VOLT_10_05mV) ? 10050 : \
+	 ((eCth) == ADBMS6948_CTH_VOLT_15mv)    ? 15000 : \
+	 ((eCth) == ADBMS6948_CTH_VOLT_22_5mv)  ? 22500 : \
+	 ((eCth) == ADBMS6948_CTH_VOLT_45mv)    ? 45000 : \
+	 ((eCth) == ADBMS6948_CTH_VOLT_75mv)    ? 75000 : 135000)
+
 /*! \enum Adbms6948_Gpio11CfgType
     Enumeration of GPIO11 configuration type. */
 typedef enum
@@ -269,6 +300,9 @@ typedef struct
 
     /*! OC2 Configuration Parameters */
     Adbms6948_OC2CfgType                *Adbms6948_poOC2CfgType;
+
+    /*! Flag to take over a chain which already holds this configuration, without reset and calibration */
+    boolean                              Adbms6948_bWarmInit;
 }Adbms6948_DaisyChainCfgType;
 
 /*!
@@ -927,6 +961,14 @@ Adbms6948_ReturnType Adbms6948_ReadCADCI1ADC
 	Adbms6948_SnapSelType	eSnapSel,
 	const uint8_t			knChainID
 );
+Adbms6948_ReturnType Adbms6948_ReadCellVoltCS
+(
+	int16_t				    *pnCellData,
+	int16_t				    *pnSCellData,
+	uint16_t			    *pnCSFltStatus,
+	Adbms6948_SnapSelType	eSnapSel,
+	const uint8_t			knChainID
+);
 Adbms6948_ReturnType  Adbms6948_ReadCellVoltCurrentAverage
 (
 	int16_t 				*pnCellData,
@@ -949,16 +991,16 @@ const uint8_t  			 knChainID
 );
 Adbms6948_ReturnType  Adbms6948_CellOWDiag
 (
-    uint16_t 			*pnCellData,
-    uint16_t 			*pnCellOWData,
+    const int16_t 		*pnCellData,
+    const int16_t 		*pnCellOWData,
 	boolean				 bIsCADCUsed,
     uint8_t 			*pbCellOWStatus,
     const uint8_t 		 knChainID
 );
 Adbms6948_ReturnType  Adbms6948_CurrentOWDiag
 (
-	uint32_t 			*pnCurrentData,
-	uint32_t 			*pnCurrentOWData,
+	const int32_t 		*pnCurrentData,
+	const int32_t 		*pnCurrentOWData,
 	boolean				 bIsI1ADCUsed,
 	uint8_t 			*pbCurrentOWStatus,
 	const uint8_t 		 knChainID
@@ -1047,6 +1089,12 @@ Adbms6948_CSThresVoltType 	*pCSCompThresVolt,
 const uint8_t  				 knChainID
 );
 
+Adbms6948_ReturnType  Adbms6948_CfgPwmDischarge
+(
+Adbms6948_PwmDutyCfgType 	*pPwmDuty,
+const uint8_t  				 knChainID
+);
+
 Adbms6948_ReturnType  Adbms6948_CfgGpioPins
 (
 Adbms6948_GpioPinCfgType 	*pGpioPinCfg,
@@ -1065,6 +1113,31 @@ Adbms6948_ReturnType  Adbms6948_CfgOC2Params
     const uint8_t           knChainID
 );
 
+Adbms6948_ReturnType  Adbms6948_CheckChainCfg
+(
+    const uint8_t           knChainID
+);
+
+Adbms6948_ReturnType  Adbms6948_ReInitChain
+(
+    const uint8_t           knChainID
+);
+
+Adbms6948_ReturnType  Adbms6948_CfgBegin
+(
+    const uint8_t           knChainID
+);
+
+Adbms6948_ReturnType  Adbms6948_CfgCommit
+(
+    const uint8_t           knChainID
+);
+
+Adbms6948_ReturnType  Adbms6948_CfgAbort
+(
+    const uint8_t           knChainID
+);
+
 
 Adbms6948_ReturnType  Adbms6948_ReadDevRevCode
 (
@@ -93,6 +93,15 @@ Analog Devices License Agreement.
 /** To read one register group */
 #define ADBMS6948_NUMOF_REGGRP_SIX				((uint8_t)0x06u)
 
+/** Shadow copy bit of PWM register group A, above the configuration register groups */
+#define ADBMS6948_PWM_SHADOW_GRP_A				((uint16_t)0x0200u)
+
+/** Shadow copy bit of PWM register group B */
+#define ADBMS6948_PWM_SHADOW_GRP_B				((uint16_t)0x0400u)
+
+/** Shadow copy mask of all the configuration and PWM register groups */
+#define ADBMS6948_CFG_SHADOW_ALL_GRPS			((uint16_t)0x07FFu)
+
 /** Number of register groups for RDCIV command */
 #define ADBMS6948_NUMOF_REGGRP_RDCIV			((uint8_t)(0x08u))
 
@@ -191,6 +200,14 @@ boolean  Adbms6948_Cmn_ValidatePEC
   uint8_t  knChainID
 );
 
+boolean  Adbms6948_Cmn_ValidateFramePEC
+(
+  uint8_t *pFrameBuf,
+  uint8_t  nSliceLen,
+  boolean *pbDevValid,
+  uint8_t  knChainID
+);
+
 Adbms6948_ReturnType Adbms6948_Cmn_VerifyCmdCnt
 (
 	boolean 	bWithCfgRead,
@@ -199,7 +216,8 @@ Adbms6948_ReturnType Adbms6948_Cmn_VerifyCmdCnt
 
 Adbms6948_ReturnType Adbms6948_Cmn_InitChain
 (
-	uint8_t  nChainIndex
+	uint8_t  nChainIndex,
+	boolean  bReInit
 );
 
 Adbms6948_ReturnType  Adbms6948_Cmn_UpdateConfigPerDevice
@@ -220,6 +238,27 @@ Adbms6948_ReturnType  Adbms6948_Cmn_UpdateConfig16
 	const uint8_t  						knChainID
 );
 
+void  Adbms6948_Cmn_InvalidateCfgShadow
+(
+	uint16_t 		nGrpMask,
+	const uint8_t  	knChainID
+);
+
+void  Adbms6948_Cmn_BeginCfgTxn
+(
+	const uint8_t  	knChainID
+);
+
+void  Adbms6948_Cmn_AbortCfgTxn
+(
+	const uint8_t  	knChainID
+);
+
+Adbms6948_ReturnType  Adbms6948_Cmn_CommitCfgTxn
+(
+	const uint8_t  	knChainID
+);
+
 Adbms6948_ReturnType  Adbms6948_Cmn_PwmDischarge(
 uint8_t 		*pPwmCfgA,
 uint8_t 		*pPwmCfgB,
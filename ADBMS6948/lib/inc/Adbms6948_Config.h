@@ -71,6 +71,12 @@ Adbms6948_CSThresVoltType 		*pCSCompThresVolt,
 const uint8_t  					 knChainID
 );
 
+Adbms6948_ReturnType  Adbms6948_Int_CfgPwmDischarge
+(
+Adbms6948_PwmDutyCfgType 	*pPwmDuty,
+const uint8_t  				 knChainID
+);
+
 Adbms6948_ReturnType  Adbms6948_Int_CfgGpioPins
 (
 Adbms6948_GpioPinCfgType 	*pGpioPinCfg,
@@ -95,6 +101,31 @@ Adbms6948_ReturnType Adbms6948_Int_CfgCoulombCounter
     const uint8_t       knChainID
 );
 
+Adbms6948_ReturnType  Adbms6948_Int_CheckChainCfg
+(
+const uint8_t 		knChainID
+);
+
+Adbms6948_ReturnType  Adbms6948_Int_ReInitChain
+(
+const uint8_t 		knChainID
+);
+
+Adbms6948_ReturnType  Adbms6948_Int_CfgBegin
+(
+const uint8_t 		knChainID
+);
+
+Adbms6948_ReturnType  Adbms6948_Int_CfgCommit
+(
+const uint8_t 		knChainID
+);
+
+Adbms6948_ReturnType  Adbms6948_Int_CfgAbort
+(
+const uint8_t 		knChainID
+);
+
 /*! \addtogroup ADI_ADBMS6948_CONFIG_DATA	ADBMS6948 Configuration Data Types
 * @{
 */
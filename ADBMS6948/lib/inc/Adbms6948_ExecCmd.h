@@ -324,6 +324,13 @@ Analog Devices License Agreement.
 #define ADBMS6948_CMD_RDAO			((uint16_t)0x003Au)
 
 /*============= D A T A T Y P E S =============*/
+/*! Callback invoked by Adbms6948_Cmd_ExecuteCmdRDPipelined once a register
+    group has been received. */
+typedef void (*Adbms6948_Cmd_RxGrpCallbackType)
+(
+    uint8_t  	 nGrpIdx,
+    void 		*pContext
+);
 
 /*======= P U B L I C P R O T O T Y P E S ========*/
 void  Adbms6948_Cmd_ExecuteCmdRD
@@ -335,6 +342,16 @@ void  Adbms6948_Cmd_ExecuteCmdRD
     const uint8_t    knChainID
 );
 
+Adbms6948_ReturnType  Adbms6948_Cmd_ExecuteCmdRDPipelined
+(
+    uint16_t 						*pnCmdLst,
+    uint8_t     					 pRxBuf[][ADBMS6948_MAX_FRAME_SIZE],
+    uint32_t  						 nDataCfg,
+    Adbms6948_Cmd_RxGrpCallbackType  pfRxGrpCallback,
+    void 							*pContext,
+    const uint8_t    				 knChainID
+);
+
 void  Adbms6948_Cmd_ExecuteCmdWR
 (
     uint16_t  		 nCommand,
@@ -383,7 +400,7 @@ void  Adbms6948_Cmd_ExecuteCmdRDAll
 (
     uint8_t             *pRxBuf,
     uint16_t            nCmd,
-    uint8_t             nRegGrps,
+    uint16_t            nDataLen,
     boolean             bIsPollCmd,
     const uint8_t       knChainID
 );
@@ -90,6 +90,12 @@ Analog Devices License Agreement.
 /** Clear Fault Flags service ID*/
 #define ADBMS6948_CLRFLAG_ID                ((uint8_t)0x4Bu)
 
+/** Current open wire diagnostic service ID*/
+#define ADBMS6948_CURRENTOWDIAG_ID          ((uint8_t)0x4Cu)
+
+/** Read C and S-ADC cell voltages service ID*/
+#define ADBMS6948_READCELLVOLTCS_ID         ((uint8_t)0x4Du)
+
 /***************************** Other Defines *********************************/
 
 
@@ -129,6 +135,9 @@ Analog Devices License Agreement.
 /** Types of "Read All" commands based on number of data bytes they read */
 #define ADBMS6948_READALL_COMMAND_TYPES 		((uint8_t)0x05u)
 
+/** Offset of the signed cell voltage codes, code plus offset is the cell voltage in steps of 150 uV */
+#define ADBMS6948_OW_CODE_OFFSET				((int32_t)10000)
+
 /** Number of bytes (including 2 PEC bytes) for commands reading all cell voltages */
 #define ADBMS6948_RDALL_CELLVOLTAGES_BYTES		((uint8_t)34u)
 
@@ -137,6 +146,8 @@ Analog Devices License Agreement.
 
 /** Number of bytes (including 2 PEC bytes) for commands reading all C and S-ADC cell voltages */
 #define ADBMS6948_RDALL_CSVOLTAGES_BYTES		((uint8_t)66u)
+/** Number of bytes of C-ADC cell voltages in RDCSVALL command result, the S-ADC cell voltages follow */
+#define ADBMS6948_RDCSALL_C_BYTES				((uint8_t)32u)
 
 /** Number of bytes (including 2 PEC bytes) for commands reading all C and S-ADC cell voltages and I1, I2-ADCs current values */
 #define ADBMS6948_RDALL_CSVOLTAGE_CURRENT_BYTES ((uint8_t)72u)
@@ -148,6 +159,8 @@ Analog Devices License Agreement.
 #define ADBMS6948_RDASALL_GPIO_BYTES            ((uint8_t)22u)
 /** Number of bytes of Redundant GPIO data in RDASALL command result */
 #define ADBMS6948_RDASALL_RD_GPIO_BYTES         ((uint8_t)22u)
+/** Number of GPIO results of one device in RDASALL command result */
+#define ADBMS6948_RDASALL_NO_OF_GPIOS           ((uint8_t)11u)
 /** Number of bytes of Status register A in RDASALL command result */
 #define ADBMS6948_RDASALL_STATUSA_BYTES         ((uint8_t)6u)
 /** Number of bytes of Status register B in RDASALL command result */
@@ -313,12 +326,42 @@ Adbms6948_ReturnType Adbms6948_Int_ClearAllFlags
 (
     const uint8_t                   knChainID
 );
+Adbms6948_ReturnType  Adbms6948_Int_CellOWDiag
+(
+    const int16_t 		*pnCellData,
+    const int16_t 		*pnCellOWData,
+	boolean				 bIsCADCUsed,
+    uint8_t 			*pbCellOWStatus,
+    const uint8_t 		 knChainID
+);
+Adbms6948_ReturnType  Adbms6948_Int_CurrentOWDiag
+(
+	const int32_t 		*pnCurrentData,
+	const int32_t 		*pnCurrentOWData,
+	boolean				 bIsI1ADCUsed,
+	uint8_t 			*pbCurrentOWStatus,
+	const uint8_t 		 knChainID
+);
 Adbms6948_ReturnType  Adbms6948_Int_ReadCellOVUVStatus
 (
 uint32_t 				*pnCellOVUVStatus,
 Adbms6948_SnapSelType 	 eSnapSel,
 const uint8_t  			 knChainID
 );
+Adbms6948_ReturnType Adbms6948_Int_ReadCellVoltCS
+(
+	int16_t			    	*pnCellData,
+	int16_t			    	*pnSCellData,
+	uint16_t			    *pnCSFltStatus,
+	Adbms6948_SnapSelType	eSnapSel,
+	const uint8_t			knChainID
+);
+Adbms6948_ReturnType  Adbms6948_Int_ReadCSFltStatus
+(
+uint16_t 				*pnCSFltStatus,
+Adbms6948_SnapSelType 	 eSnapSel,
+const uint8_t  			 knChainID
+);
 Adbms6948_ReturnType Adbms6948_Int_ClearCellVoltageRegisters
 (
     Adbms6948_SnapSelType           eSnapSel,
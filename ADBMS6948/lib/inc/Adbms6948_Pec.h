@@ -24,6 +24,13 @@ Analog Devices License Agreement.
 /*============= I N C L U D E S =============*/
 #include "Adbms6948_Types.h"
 
+/*============== D E F I N E S ===============*/
+/** Number of entries of the command PEC table, one per 11-bit command code */
+#define ADBMS6948_CMD_PEC_TABLE_SIZE    ((uint16_t)0x0800u)
+
+/** Number of data bytes folded into the 10-bit PEC per table step */
+#define ADBMS6948_PEC10_NO_OF_SLICES    ((uint8_t)0x04u)
+
 /*======= P U B L I C P R O T O T Y P E S ========*/
 
 uint16_t Adbms6948_Pec15Calculate
@@ -32,6 +39,11 @@ uint16_t Adbms6948_Pec15Calculate
     uint8_t   	 nLength
 );
 
+uint16_t Adbms6948_Pec15Command
+(
+    uint16_t  nCommand
+);
+
 uint16_t Adbms6948_Pec10Calculate
 (
 uint8_t 	*pDataBuf,
@@ -39,6 +51,15 @@ boolean  	 bIsRxCmd,
 uint8_t   	 nLength
 );
 
+uint8_t Adbms6948_Pec10ValidateSlices
+(
+uint8_t 	*pFrameBuf,
+uint8_t   	 nSliceLen,
+uint8_t   	 nNoOfSlices,
+boolean  	*pbPecMatch,
+uint8_t  	*pnCmdCnt
+);
+
 #endif /* ADBMS6948_PEC_H */
 
 /** @}*/ /* Adbms6948_Pec */
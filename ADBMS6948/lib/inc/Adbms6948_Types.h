@@ -185,6 +185,21 @@ Analog Devices License Agreement.
 /** Read AlwaysOn Memory service ID. */
 #define ADBMS6948_AOMEMREAD_ID				((uint8_t)0x39u)
 
+/** Check chain configuration service ID. */
+#define ADBMS6948_CHECKCHAINCFG_ID			((uint8_t)0x3Au)
+
+/** Begin configuration transaction service ID. */
+#define ADBMS6948_CFGBEGIN_ID				((uint8_t)0x3Bu)
+
+/** Commit configuration transaction service ID. */
+#define ADBMS6948_CFGCOMMIT_ID				((uint8_t)0x3Cu)
+
+/** Abort configuration transaction service ID. */
+#define ADBMS6948_CFGABORT_ID				((uint8_t)0x3Du)
+
+/** Re-initialize chain service ID. */
+#define ADBMS6948_REINITCHAIN_ID			((uint8_t)0x3Eu)
+
 /*************************** DEVELOPMENT ERROR CODES *************************/
 
 /** API service called with NULL pointer as parameter */
@@ -211,6 +226,9 @@ Analog Devices License Agreement.
 /** No. of register in a group */
 #define ADBMS6948_REG_GRP_LEN		  			((uint8_t)0x06u)
 
+/** No. of PWM register groups, A for cells 1 to 12 and B for cells 13 to 16 */
+#define ADBMS6948_NUMOF_PWM_GRPS				((uint8_t)0x02u)
+
 /** PEC length */
 #define ADBMS6948_PEC_LEN						((uint8_t)0x02u)
 
@@ -908,6 +926,36 @@ typedef struct
     /*! Current count of PEC Errors */
     uint32_t     nPECError[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
 
+    /*! Command counter verifications since the last explicit check */
+    uint8_t     nCmdCntVerifyCnt;
+
+    /*! Explicit command counter check required on the next verification */
+    boolean     bCmdCntResync;
+
+    /*! Shadow copy of configuration register groups A to I, six bytes per device in chain order */
+    uint8_t     aCfgShadow[ADBMS6948_CONFIG_GROUP_INVALID][ADBMS6948_REG_GRP_LEN * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+
+    /*! Shadow copy of PWM register groups A and B, six bytes per device in chain order */
+    uint8_t     aPwmShadow[ADBMS6948_NUMOF_PWM_GRPS][ADBMS6948_REG_GRP_LEN * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+
+    /*! Configuration and PWM groups whose shadow copy holds the device contents, one bit per group */
+    uint16_t    nCfgShadowValid;
+
+    /*! Configuration writes from the shadow copy since the last read back verification */
+    uint8_t     nCfgWrVerifyCnt;
+
+    /*! Configuration transaction open, configuration updates are staged instead of written */
+    boolean     bCfgTxnOpen;
+
+    /*! Staged field values of configuration register groups A to I, six bytes per device */
+    uint8_t     aCfgTxnData[ADBMS6948_CONFIG_GROUP_INVALID][ADBMS6948_REG_GRP_LEN * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+
+    /*! Staged fields of every configuration register, common to all devices */
+    uint8_t     aCfgTxnMask[ADBMS6948_CONFIG_GROUP_INVALID][ADBMS6948_REG_GRP_LEN];
+
+    /*! Configuration groups with staged fields, one bit per group */
+    uint16_t    nCfgTxnDirty;
+
     /*! Chain State */
     volatile Adbms6948_ChainStateType    eChainState;
 
@@ -276,6 +276,67 @@ const uint8_t  				 knChainID
 	return (Adbms6948_Int_CfgCSCompThresVolt(pCSCompThresVolt, knChainID));
 }
 
+/*****************************************************************************/
+/*!
+    @brief      This API sets the PWM discharge duty cycle of every cell of
+				ADBMS6948. Only the PWM register groups whose contents change
+				are written and verified, so repeating the same duty cycles
+				costs no SPI traffic. \n
+
+    @param 	[in]    pPwmDuty  		Pointer to the duty cycles. Application to
+									pass 16 values per ADBMS6948 device, in the order
+									of the devices in chain and laid out as the cell
+									data read back, so other devices take no values.
+									Cells without discharge take 0.
+									@range: 0 to ADBMS6948_PWM_DUTY_MAX
+									@resolution: 1/15 of the PWM period
+
+    @param	[in]   	knChainID	    Specifies ID of the daisy chain on
+									which the operation is to be performed.
+									@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+									@resolution: NA
+
+    @return        E_OK: 		Success \n
+                   E_NOT_OK: 	Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_CfgPwmDischarge
+(
+Adbms6948_PwmDutyCfgType 	*pPwmDuty,
+const uint8_t  				 knChainID
+)
+{
+	return (Adbms6948_Int_CfgPwmDischarge(pPwmDuty, knChainID));
+}
+
+/*****************************************************************************/
+/*!
+    @brief      This API configures the time base of the coulomb counter of
+				all the ADBMS6948 devices in the chain. \n
+
+    @param 	[in]    pnNumConversions	Pointer to the number of I1-ADC
+									conversions of the coulomb counter time base.
+									@range: 0 to 65535
+									@resolution: 1 conversion time
+
+    @param	[in]   	knChainID	    Specifies ID of the daisy chain on
+									which the operation is to be performed.
+									@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+									@resolution: NA
+
+    @return        E_OK: 		Success \n
+                   E_NOT_OK: 	Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_CfgCoulombCounter
+(
+uint16_t 		*pnNumConversions,
+const uint8_t  	 knChainID
+)
+{
+	return (Adbms6948_Int_CfgCoulombCounter(pnNumConversions, knChainID));
+}
+
 /*****************************************************************************/
 /*!
     @brief      This API sets pull-down ON/OFF for the particular GPIO pin of
@@ -354,6 +415,128 @@ Adbms6948_ReturnType  Adbms6948_CfgOC2Params
     return (Adbms6948_Int_CfgOC2Params(poOC2CfgType, knChainID));
 }
 
+/*****************************************************************************/
+/*!
+    @brief          This API checks whether the daisy chain still holds the
+                    configuration applied by Adbms6948_Init. It costs a single
+                    register group read, so applications can keep the driver
+                    initialized across requests and re-initialize only when
+                    this check fails. \n
+
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+
+    @return        E_OK:        Chain is configured \n
+                   E_NOT_OK:    Chain needs to be re-initialized \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_CheckChainCfg
+(
+    const uint8_t           knChainID
+)
+{
+    return (Adbms6948_Int_CheckChainCfg(knChainID));
+}
+
+/*****************************************************************************/
+/*!
+    @brief          This API re-initializes one daisy chain, e.g. after
+                    Adbms6948_CheckChainCfg failed, without the soft reset of
+                    Adbms6948_Init. A chain which kept its configuration is
+                    taken over, otherwise its configuration is written again.
+                    The other chains keep running. \n
+
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+
+    @return        E_OK:        Chain is configured \n
+                   E_NOT_OK:    Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_ReInitChain
+(
+    const uint8_t           knChainID
+)
+{
+    return (Adbms6948_Int_ReInitChain(knChainID));
+}
+
+/*****************************************************************************/
+/*!
+    @brief          This API opens a configuration transaction. Until
+                    Adbms6948_CfgCommit, Adbms6948_CfgOVThreshold,
+                    Adbms6948_CfgUVThreshold, Adbms6948_CfgGpioPins,
+                    Adbms6948_CfgIIRFilter, Adbms6948_CfgCSCompThresVolt and the
+                    other configuration register updates only stage their
+                    fields, without SPI traffic. \n
+
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+
+    @return        E_OK:        Success \n
+                   E_NOT_OK:    Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_CfgBegin
+(
+    const uint8_t           knChainID
+)
+{
+    return (Adbms6948_Int_CfgBegin(knChainID));
+}
+
+/*****************************************************************************/
+/*!
+    @brief          This API commits a configuration transaction. Every
+                    configuration register group with staged fields is written
+                    once, then all of them are read back together and
+                    compared. \n
+
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+
+    @return        E_OK:        Success \n
+                   E_NOT_OK:    Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_CfgCommit
+(
+    const uint8_t           knChainID
+)
+{
+    return (Adbms6948_Int_CfgCommit(knChainID));
+}
+
+/*****************************************************************************/
+/*!
+    @brief          This API aborts a configuration transaction, the staged
+                    fields are discarded. \n
+
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+
+    @return        E_OK:        Success \n
+                   E_NOT_OK:    Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_CfgAbort
+(
+    const uint8_t           knChainID
+)
+{
+    return (Adbms6948_Int_CfgAbort(knChainID));
+}
+
 /*! @}*/
 
 
@@ -930,6 +1113,8 @@ Adbms6948_ReturnType  Adbms6948_ReadI1ADCConvCnt
 									[C(1), C(2), ..., C(M)]
                                     where X=first cell of the group.    \n
 									      M=Number of cells in the group
+									Without ADI_LEGACY_GRP_SUPPORT all the cells
+									of a device precede those of the next device.
 									@range: NA
 									@resolution: NA
 
@@ -969,7 +1154,7 @@ Adbms6948_ReturnType  Adbms6948_ReadCellVolt
 					ADBMS6948 device.
 
     @param 	[out]	pnCellData	Place holder to report the cell measurement
-								data.
+								data, 16 cells of every device of the chain.
 								@range: NA
 								@resolution: NA
 	@param 	[in] 	knChainID	Specifies ID of the daisy chain on which the
@@ -1115,17 +1300,18 @@ Adbms6948_ReturnType  Adbms6948_ReadDevParam
                     status A-B-C-D-E(5 * 6 byte), F-G(2 * 4 byte)
 
     @param  [out]   panGpioData             Placeholder to store the GPIO
-                                            values.
+                                            values, 11 per device of the chain.
                                             @range: NA
                                             @resolution: NA
 
     @param  [out]   panRedundantGpioData    Placeholder to store the Redundant
-                                            GPIO values.
+                                            GPIO values, 11 per device of the chain.
                                             @range: NA
                                             @resolution: NA
 
     @param  [out]   poStatusRegsVal         Placeholder to store the Status
-                                            register values.
+                                            register values, one per device
+                                            of the chain.
                                             @range: NA
                                             @resolution: NA
 
@@ -1194,10 +1380,12 @@ Adbms6948_ReturnType  Adbms6948_ReadCurrent
     @brief  This API reads the voltage and current data from the C and I1-ADCs
 			respectively in ADBMS6948 device.
 
-    @param	[out]	pnCellData 		Placeholder to report the cell voltage data
+    @param	[out]	pnCellData 		Placeholder to report the cell voltage data,
+									16 cells of every device of the chain
 									@range: NA
 									@resolution: NA
-    @param	[out]	pnCurrentData 	Placeholder to report the current data
+    @param	[out]	pnCurrentData 	Placeholder to report the current data, one
+									per device of the chain
 									@range: NA
 									@resolution: NA
     @param	[in]	eSnapSel		Specifies the snapshot command/s to be sent.
@@ -1222,14 +1410,60 @@ Adbms6948_ReturnType Adbms6948_ReadCADCI1ADC
 	return (Adbms6948_Int_ReadCADCI1ADC(pnCellData, pnCurrentData, eSnapSel, knChainID));
 }
 /*****************************************************************************/
+/*!
+    @brief  This API reads the C-ADC and S-ADC cell voltages of all the cells
+			with a single frame and the C vs S fault flags of the same
+			snapshot, for a plausibility check of the redundant
+			measurements. The flags that were read are cleared. The C-ADC
+			runs with redundancy (Adbms6948_bEnRedun) for the S-ADC results
+			and the flags to track the C-ADC results.
+
+    @param	[out]	pnCellData 		Placeholder to report the C-ADC cell voltage
+									data, 16 cells of every device of the chain
+									@range: NA
+									@resolution: NA
+    @param	[out]	pnSCellData 	Placeholder to report the S-ADC cell voltage
+									data, 16 cells of every device of the chain
+									@range: NA
+									@resolution: NA
+    @param	[out]	pnCSFltStatus 	Placeholder to report the C vs S fault
+									flags, one per device of the chain, bit n
+									for cell n + 1
+									@range: NA
+									@resolution: NA
+    @param	[in]	eSnapSel		Specifies the snapshot command/s to be sent.
+							        @range: Enumeration.
+							        @resolution: NA
+	@param 	[in]	knChainID		Specifies ID of the daisy chain on which the
+	                        		operation is to be performed.
+									@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+									@resolution: NA
+    @return     	E_OK: Success    \n
+                	E_NOT_OK: Failed \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType Adbms6948_ReadCellVoltCS
+(
+	int16_t				    *pnCellData,
+	int16_t				    *pnSCellData,
+	uint16_t			    *pnCSFltStatus,
+	Adbms6948_SnapSelType	eSnapSel,
+	const uint8_t			knChainID
+)
+{
+	return (Adbms6948_Int_ReadCellVoltCS(pnCellData, pnSCellData, pnCSFltStatus, eSnapSel, knChainID));
+}
+/*****************************************************************************/
 /*!
 	@brief  This API reads the average cell volatages and average current from
 			all C-ADC channels and I1-ADC respectively.
 
-	@param	[out]	pnCellData		    Placeholder to report the cell voltage data
+	@param	[out]	pnCellData		    Placeholder to report the cell voltage data,
+									    16 cells of every device of the chain
 									    @range: NA
 									    @resolution: NA
-    @param	[out]	pnCurrentData 	    Placeholder to report the current data
+    @param	[out]	pnCurrentData 	    Placeholder to report the current data,
+									    one per device of the chain
 									    @range: NA
 									    @resolution: NA
     @param  [in]    bSendUnsnapAtEnd    Specifies whether to send UNSNAP command
@@ -1330,6 +1564,104 @@ const uint8_t  			 knChainID
 	return (Adbms6948_Int_PollADCStatus(eADCSel, pbADCStatus, knChainID));
 }
 
+/*****************************************************************************/
+/*!
+    @brief         	This API evaluates the open wire status of every cell
+					from a normal measurement and a measurement taken with the
+					open wire switches on. No command is sent to the devices.
+					The status of cell n is the status of its top wire Cn;
+					only the cells whose switch was on carry information.
+
+	@param [in]  	pnCellData		Cell voltage codes measured with the open
+									wire switches off.
+									@range: NA
+									@resolution: NA
+
+	@param [in]  	pnCellOWData	Cell voltage codes measured with the open
+									wire switches on, e.g. by
+									Adbms6948_TrigSADC with ADBMS6948_CELL_OW_ODD
+									or ADBMS6948_CELL_OW_EVEN.
+									@range: NA
+									@resolution: NA
+
+	@param [in]  	bIsCADCUsed		TRUE if the open wire measurement was taken
+									with the C-ADC, FALSE for the S-ADC.
+									@range: TRUE, FALSE
+									@resolution: NA
+
+	@param [out]  	pbCellOWStatus	Place holder to report one ADBMS6948_OW_*
+									status per cell.
+									@range: NA
+									@resolution: NA
+
+	@param [in] 	knChainID	Specifies ID of the daisy chain on which the
+								operation is to be performed.
+								@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+								@resolution: NA
+
+    @return     E_OK: Success  \n
+                E_NOT_OK: Failed \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_CellOWDiag
+(
+    const int16_t 		*pnCellData,
+    const int16_t 		*pnCellOWData,
+	boolean				 bIsCADCUsed,
+    uint8_t 			*pbCellOWStatus,
+    const uint8_t 		 knChainID
+)
+{
+	return (Adbms6948_Int_CellOWDiag(pnCellData, pnCellOWData, bIsCADCUsed, pbCellOWStatus, knChainID));
+}
+
+/*****************************************************************************/
+/*!
+    @brief         	This API evaluates the open wire status of the current
+					inputs of every device from a normal current measurement
+					and a measurement taken with the open wire switches on.
+					No command is sent to the devices.
+
+	@param [in]  	pnCurrentData		Current codes measured with the open
+										wire switches off, one per device.
+										@range: NA
+										@resolution: NA
+
+	@param [in]  	pnCurrentOWData		Current codes measured with the open
+										wire switches on, one per device.
+										@range: NA
+										@resolution: NA
+
+	@param [in]  	bIsI1ADCUsed		TRUE for the I1-ADC, FALSE for the I2-ADC.
+										@range: TRUE, FALSE
+										@resolution: NA
+
+	@param [out]  	pbCurrentOWStatus	Place holder to report one
+										ADBMS6948_OW_* status per device.
+										@range: NA
+										@resolution: NA
+
+	@param [in] 	knChainID	Specifies ID of the daisy chain on which the
+								operation is to be performed.
+								@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+								@resolution: NA
+
+    @return     E_OK: Success  \n
+                E_NOT_OK: Failed \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_CurrentOWDiag
+(
+	const int32_t 		*pnCurrentData,
+	const int32_t 		*pnCurrentOWData,
+	boolean				 bIsI1ADCUsed,
+	uint8_t 			*pbCurrentOWStatus,
+	const uint8_t 		 knChainID
+)
+{
+	return (Adbms6948_Int_CurrentOWDiag(pnCurrentData, pnCurrentOWData, bIsI1ADCUsed, pbCurrentOWStatus, knChainID));
+}
+
 /*****************************************************************************/
 /*!
     @brief          This API clears the fault flags in Status C register.
@@ -1351,6 +1683,95 @@ Adbms6948_ReturnType Adbms6948_ClearAllFlags
     return (Adbms6948_Int_ClearAllFlags(knChainID));
 }
 
+/*****************************************************************************/
+/*!
+    @brief          This API starts the coulomb counter, which accumulates the
+                    I1-ADC results and counts the conversions in the time base.
+
+    @param  [in]    bContMode       Specifies whether the coulomb counter runs
+                                    in continuous mode or single shot mode.
+                                    @range: FALSE,TRUE
+                                    @resolution: NA
+
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+
+    @return        E_OK:        Success \n
+                   E_NOT_OK:    Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType Adbms6948_EnableCoulombCounter
+(
+    boolean                 bContMode,
+    const uint8_t           knChainID
+)
+{
+    return (Adbms6948_Int_EnableCoulombCounter(bContMode, knChainID));
+}
+
+/*****************************************************************************/
+/*!
+    @brief          This API reads the coulomb counter and time base of the
+                    first device in the chain, optionally between SNAP and
+                    UNSNAP so that both values belong to the same conversion.
+
+    @param  [out]   pnCoulombCount  Placeholder to report the coulomb counter
+                                    value.
+                                    @range: 0 to (2^32 - 1)
+                                    @resolution: 1 count
+
+    @param  [out]   pnTimeBase      Placeholder to report the time base value.
+                                    @range: 0 to (2^16 - 1)
+                                    @resolution: 1 conversion time
+
+    @param  [in]    eSnapSel        Specifies the snapshot command/s to be sent.
+                                    @range: Enumeration
+                                    @resolution: NA
+
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+
+    @return        E_OK:        Success \n
+                   E_NOT_OK:    Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType Adbms6948_ReadCoulombCountAndTimeBase
+(
+    uint32_t                *pnCoulombCount,
+    uint16_t                *pnTimeBase,
+    Adbms6948_SnapSelType   eSnapSel,
+    const uint8_t           knChainID
+)
+{
+    return (Adbms6948_Int_ReadCoulombCountAndTimeBase(pnCoulombCount, pnTimeBase, eSnapSel, knChainID));
+}
+
+/*****************************************************************************/
+/*!
+    @brief          This API clears the coulomb counter and time base register
+                    groups with the CLRCC command.
+
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+
+    @return        E_OK:        Success \n
+                   E_NOT_OK:    Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType Adbms6948_ClearCoulombCountAndTimeBase
+(
+    const uint8_t           knChainID
+)
+{
+    return (Adbms6948_Int_SendCtrlCmd(ADBMS6948_CTRL_CMD_CLRCC, knChainID));
+}
+
 /*****************************************************************************/
 /*!
     @brief          This API clears all the cell voltage registers and also
@@ -1464,6 +1885,49 @@ const uint8_t  			 knChainID
 	return (Adbms6948_Int_ReadCellOVUVStatus(pnCellOVUVStatus, eSnapSel, knChainID));
 }
 
+/*****************************************************************************/
+/*!
+    @brief	This API reads the C vs S fault flags of all the devices in the
+			chain and clears the flags that were set.
+
+    @param [out]	pnCSFltStatus  		Place holder to report the C vs S fault
+										flags. The user must provide a buffer
+										of one entry per device of the chain.
+
+										Bit n of an entry reports that the
+										C-ADC and S-ADC results of cell n + 1
+										of the device differed by more than
+										the comparison threshold
+										(Adbms6948_eCSThresholdVolt) in a
+										redundant conversion since the flags
+										were last cleared.
+
+										@range: NA
+										@resolution: NA
+
+	@param 	[in] 	eSnapSel	Specifies the snapshot command/s to be sent.
+								@range: Enumeration
+								@resolution: NA
+
+    @param	[in]   	knChainID	Specifies ID of the daisy chain on
+								which the operation is to be performed.
+								@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+								@resolution: NA
+
+    @return        E_OK: 		Success \n
+                   E_NOT_OK: 	Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_ReadCSFltStatus
+(
+uint16_t 				*pnCSFltStatus,
+Adbms6948_SnapSelType 	 eSnapSel,
+const uint8_t  			 knChainID
+)
+{
+	return (Adbms6948_Int_ReadCSFltStatus(pnCSFltStatus, eSnapSel, knChainID));
+}
+
 /** @}*/
 /** @}*/
 
@@ -39,6 +39,65 @@ Adbms6948_ChainStateInfoType Adbms6948_aoChainStateInfo[ADBMS6948_NO_OF_DAISY_CH
 /* Un-Initialized Data section start */
 ADBMS6948_DRV_UNINIT_DATA_STOP
 
+/*! Read command of every configuration register group, indexed by \ref Adbms6948_ConfigGroupSelection */
+static const uint16_t Adbms6948_kaCfgRdCmd[ADBMS6948_CONFIG_GROUP_INVALID] =
+{
+	ADBMS6948_CMD_RDCFGA, ADBMS6948_CMD_RDCFGB, ADBMS6948_CMD_RDCFGC,
+	ADBMS6948_CMD_RDCFGD, ADBMS6948_CMD_RDCFGE, ADBMS6948_CMD_RDCFGF,
+	ADBMS6948_CMD_RDCFGG, ADBMS6948_CMD_RDCFGH, ADBMS6948_CMD_RDCFGI
+};
+
+/*! Fields of configuration register group A set by the initialization, compared by the warm initialization */
+static const uint8_t Adbms6948_kaWarmInitCfgAMask[ADBMS6948_REG_GRP_LEN] =
+{
+	(uint8_t)(ADBMS6948_CFGAR0_MASK_REFON | ADBMS6948_CFGAR0_MASK_CTH), 0x00u, 0x00u,
+	ADBMS6948_CFGAR3_MASK_GPO, (uint8_t)(ADBMS6948_CFGAR4_MASK_GPO << ADBMS6948_CFGAR4_POS_GPO),
+	ADBMS6948_CFGAR5_MASK_FC
+};
+
+/*! Write command of every configuration register group, indexed by \ref Adbms6948_ConfigGroupSelection */
+static const uint16_t Adbms6948_kaCfgWrCmd[ADBMS6948_CONFIG_GROUP_INVALID] =
+{
+	ADBMS6948_CMD_WRCFGA, ADBMS6948_CMD_WRCFGB, ADBMS6948_CMD_WRCFGC,
+	ADBMS6948_CMD_WRCFGD, ADBMS6948_CMD_WRCFGE, ADBMS6948_CMD_WRCFGF,
+	ADBMS6948_CMD_WRCFGG, ADBMS6948_CMD_WRCFGH, ADBMS6948_CMD_WRCFGI
+};
+
+/*! Write command of PWM register groups A and B */
+static const uint16_t Adbms6948_kaPwmWrCmd[ADBMS6948_NUMOF_PWM_GRPS] =
+{
+	ADBMS6948_CMD_WRPWMA, ADBMS6948_CMD_WRPWMB
+};
+
+/*! Read command of PWM register groups A and B */
+static const uint16_t Adbms6948_kaPwmRdCmd[ADBMS6948_NUMOF_PWM_GRPS] =
+{
+	ADBMS6948_CMD_RDPWMA, ADBMS6948_CMD_RDPWMB
+};
+
+/*! Shadow copy bit of PWM register groups A and B */
+static const uint16_t Adbms6948_kaPwmShadowBit[ADBMS6948_NUMOF_PWM_GRPS] =
+{
+	ADBMS6948_PWM_SHADOW_GRP_A, ADBMS6948_PWM_SHADOW_GRP_B
+};
+
+
+/*======Static Types==============*/
+/*! Context of the register group validation which runs while a read is in progress */
+typedef struct
+{
+	/*! Register groups as received from the chain */
+	uint8_t 				(*pRdDataBuff)[ADBMS6948_MAX_FRAME_SIZE];
+
+	/*! Register groups with valid PEC handed to the caller */
+	uint8_t 				(*pRxBuff)[ADBMS6948_MAX_FRAME_SIZE];
+
+	/*! Accumulated validation status */
+	Adbms6948_ReturnType  	nRet;
+
+	/*! Daisy chain ID */
+	uint8_t 				nChainID;
+}Adbms6948_lRegGrpCtxType;
 
 /*======Static Prototype==============*/
 static void  Adbms6948_lI2CUpdRdBuf
@@ -91,6 +150,12 @@ uint8_t 	*pCfgData,
 uint8_t 	*pCfgDataChain,
 uint8_t  	 nChainIndex
 );
+static Adbms6948_ReturnType  Adbms6948_lWritePwmGrp
+(
+uint8_t 		 nPwmGrp,
+uint8_t 		*pPwmCfg,
+const uint8_t  	 knChainID
+);
 static uint8_t Adbms6948_lI2CGetRdStat
 (
 uint8_t nRdBytes,
@@ -102,6 +167,59 @@ static uint8_t Adbms6948_lI2CGetWrStat
 uint8_t nWrBytes,
 uint8_t anFCOMM[]
 );
+
+static void  Adbms6948_lValidateRegGrp
+(
+uint8_t  	 nGrpIdx,
+void 		*pContext
+);
+
+static boolean  Adbms6948_lUpdatePecStatus
+(
+boolean  	 bPecMatch,
+uint8_t  	 nCmdCntRcvd,
+uint8_t  	 nDeviceId,
+uint8_t  	 knChainID
+);
+
+static Adbms6948_ReturnType  Adbms6948_lReadCfgShadow
+(
+Adbms6948_ConfigGroupSelection  	 eCfgRegGrpSel,
+uint8_t 							*pCfgData,
+const uint8_t  						 knChainID
+);
+
+static Adbms6948_ReturnType  Adbms6948_lWriteCfgShadow
+(
+Adbms6948_ConfigGroupSelection  	 eCfgRegGrpSel,
+uint8_t 							*pCfgData,
+const uint8_t  						 knChainID
+);
+
+static boolean  Adbms6948_lWarmInitChain
+(
+uint8_t  	*pCfgAData,
+uint8_t  	*pCfgBData,
+uint8_t  	*pCfgCData,
+uint8_t  	 nChainIndex
+);
+
+static Adbms6948_ReturnType  Adbms6948_lLoadCfg
+(
+Adbms6948_ConfigGroupSelection  	 eCfgRegGrpSel,
+uint8_t 							*pCfgData,
+const uint8_t  						 knChainID
+);
+
+static Adbms6948_ReturnType  Adbms6948_lStoreCfg
+(
+Adbms6948_ConfigGroupSelection  	 eCfgRegGrpSel,
+uint8_t 							 nRegId,
+uint8_t 							 aMask[],
+uint8_t 							 nNoOfRegs,
+uint8_t 							*pCfgData,
+const uint8_t  						 knChainID
+);
 /*============= C O D E =============*/
 /* Start of code section */
 
@@ -220,57 +338,66 @@ boolean  Adbms6948_Cmn_ValidatePEC
     uint16_t   nDataPec;
     uint16_t   nRcvdPec;
     uint8_t   nCmdCntRcvd;
-    boolean  bIsPecValid = TRUE;
+    boolean  bIsPecValid;
 
     nDataPec = Adbms6948_Pec10Calculate(&pDataBuf[0], TRUE, nLen - ADBMS6948_PEC_LEN);
     nRcvdPec = ((uint16_t)(((uint16_t)pDataBuf[nLen-2u]) << 8) + (uint16_t)pDataBuf[nLen-1u]);
     nCmdCntRcvd = (uint8_t)((nRcvdPec & (uint16_t)0xFC00) >> 10u);
     nRcvdPec = (uint16_t)(nRcvdPec & (uint16_t)0x03FF);
 
-    /* Set the PEC error to FALSE in the state variable */
-    Adbms6948_aoChainStateInfo[knChainID].aLastReadPecEr[nDeviceId] = (boolean)FALSE;
-    if (nRcvdPec != nDataPec)
+    bIsPecValid = Adbms6948_lUpdatePecStatus((boolean)(nRcvdPec == nDataPec), nCmdCntRcvd, nDeviceId, knChainID);
+return (bIsPecValid);
+}
+
+/*!
+    @brief  This function validates the PEC and command counter of the read data for all the
+    devices on the chain in one pass. The frame holds one slice per device, device 0 first, each
+    slice being the register data followed by the PEC. The runtime errors are reported the same way
+    as \ref Adbms6948_Cmn_ValidatePEC.
+
+    @param  [in]   pFrameBuf  Pointer to the first device slice of the frame.
+
+    @param  [in]   nSliceLen  Length of the slice of one device, including the PEC.
+
+    @param  [out]  pbDevValid  Per device validation result, TRUE if PEC and command counter are valid.
+
+    @param  [in]   knChainID  The Id of the daisy chain on which the operation is done.
+
+    @return  TRUE: PEC valid for all devices
+             FALSE: PEC invalid for at least one device
+*/
+boolean  Adbms6948_Cmn_ValidateFramePEC
+(
+  uint8_t *pFrameBuf,
+  uint8_t  nSliceLen,
+  boolean *pbDevValid,
+  uint8_t  knChainID
+)
+{
+    boolean  abPecMatch[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+    uint8_t  anCmdCntRcvd[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+    uint8_t  nDeviceId;
+    uint8_t  nNoOfDevices = Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices;
+    boolean  bIsPecValid = TRUE;
+
+    (void)Adbms6948_Pec10ValidateSlices(pFrameBuf, nSliceLen, nNoOfDevices, &abPecMatch[0], &anCmdCntRcvd[0]);
+    for (nDeviceId = 0u; nDeviceId < nNoOfDevices; nDeviceId++)
     {
-    	if (Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDeviceId] == ADBMS6948_DEVICE)
-    	{
-    		bIsPecValid = FALSE;
-    		Adbms6948_aoChainStateInfo[knChainID].nPECError[nDeviceId]++;
-    		if (TRUE == Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_Invalid_PEC.nState)
-    		{
-    			Adbms6948_Cmn_ReportRuntimeErr(
-                    Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_Invalid_PEC.nErrID,
-					ADBMS6948_RUNTIME_E_STATUS_FAILED);
-    		}
-    	}
-    	/* Set the PEC error to TRUE in the state variable */
-    	Adbms6948_aoChainStateInfo[knChainID].aLastReadPecEr[nDeviceId] = (boolean)TRUE;
+        pbDevValid[nDeviceId] = Adbms6948_lUpdatePecStatus(abPecMatch[nDeviceId], anCmdCntRcvd[nDeviceId], nDeviceId, knChainID);
+        if (FALSE == pbDevValid[nDeviceId])
+        {
+            bIsPecValid = FALSE;
+        }
     }
-    else
-    {
-    	if (Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDeviceId] == ADBMS6948_DEVICE)
-    	{
-			if (nCmdCntRcvd != Adbms6948_aoChainStateInfo[knChainID].nCmdCnt[nDeviceId])
-			{
-				bIsPecValid = FALSE;
-				Adbms6948_aoChainStateInfo[knChainID].nCmdCntError[nDeviceId]++;
-				/* Latch onto the command count set in the device */
-				Adbms6948_aoChainStateInfo[knChainID].nCmdCnt[nDeviceId] = (uint8_t)nCmdCntRcvd;
-				if (TRUE == Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_CommandCount.nState)
-				{
-					Adbms6948_Cmn_ReportRuntimeErr(
-						  Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_CommandCount.nErrID,
-						  ADBMS6948_RUNTIME_E_STATUS_FAILED);
-				}
-			}
-    	}
-    	Adbms6948_aoChainStateInfo[knChainID].aLastReadCCs[nDeviceId] = (uint8_t)nCmdCntRcvd;
-	}
 return (bIsPecValid);
 }
 
 /*!
     @brief  This function reads the configuration register A and verifies the command counter value
-    read from the device against the value maintained by the driver.
+    read from the device against the value maintained by the driver. Every read already checks the
+    command counter received in its PEC word, so a command that is lost is detected by the next read.
+    The explicit read is therefore only done every \ref ADBMS6948_CMDCNT_VERIFY_PERIOD verifications,
+    or on the next verification after a PEC or command counter mismatch.
 
     @param 	[in]  bWithCfgRead	To include configuration read.
 
@@ -288,9 +415,18 @@ Adbms6948_ReturnType  Adbms6948_Cmn_VerifyCmdCnt
     Adbms6948_ReturnType  nRet = E_OK;
 
     if (TRUE == bWithCfgRead)
+    {
+        Adbms6948_aoChainStateInfo[knChainID].nCmdCntVerifyCnt++;
+    }
+    if ((TRUE == bWithCfgRead) &&
+        ((TRUE == Adbms6948_aoChainStateInfo[knChainID].bCmdCntResync) ||
+         (Adbms6948_aoChainStateInfo[knChainID].nCmdCntVerifyCnt >= ADBMS6948_CMDCNT_VERIFY_PERIOD)))
     {
 		uint8_t  aRdCfgData[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)];
 		uint16_t anCmdList[ADBMS6948_NUMOF_REGGRP_ONE];
+		/* A mismatch found by this read sets the resync flag again */
+		Adbms6948_aoChainStateInfo[knChainID].nCmdCntVerifyCnt = 0u;
+		Adbms6948_aoChainStateInfo[knChainID].bCmdCntResync = FALSE;
 		/* Read configuration register group A and verify the PEC and command counter. */
 		anCmdList[0u] = ADBMS6948_CMD_RDCFGA;
 		nRet = Adbms6948_Cmn_ReadRegGroup(anCmdList, aRdCfgData, ADBMS6948_NUMOF_REGGRP_ONE, knChainID);
@@ -303,13 +439,17 @@ Adbms6948_ReturnType  Adbms6948_Cmn_VerifyCmdCnt
     @brief         This function is used to initialize the configurations of all devices in a chain.
 
     @param	[in]   nChainIndex	 		Index of the chain to be initialized
+    @param	[in]   bReInit	 			TRUE to re-initialize a chain of the running driver: the chain
+										is taken over when it kept its configuration, as with
+										Adbms6948_bWarmInit, and configured without the soft reset otherwise
 
 	@return        	E_OK    : Operation was successful \n
                     E_NOT_OK: Operation failed \n
  */
 Adbms6948_ReturnType  Adbms6948_Cmn_InitChain
 (
-	uint8_t  nChainIndex
+	uint8_t  nChainIndex,
+	boolean  bReInit
 )
 {
 	uint8_t  nCfgDataChain[(ADBMS6948_REG_GRP_LEN) *
@@ -324,6 +464,7 @@ Adbms6948_ReturnType  Adbms6948_Cmn_InitChain
 	Adbms6948_ReturnType  nRet = E_OK;
 	uint8_t  aRdCfgData[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN +
 			(ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)] = {0u};
+	boolean  bChainCfgd;
 
 	if (TRUE == Adbms6948_pConfig->Adbms6948_pDaisyChainCfg[nChainIndex].Adbms6948_bEnableInit)
 	{
@@ -363,79 +504,96 @@ Adbms6948_ReturnType  Adbms6948_Cmn_InitChain
 		/* Wake up N devices in the daisy chain */
 		Adbms6948_aoChainStateInfo[nChainIndex].bFirstWakeup = TRUE;
 
+		/* Verify the command counter explicitly on the first verification */
+		Adbms6948_aoChainStateInfo[nChainIndex].nCmdCntVerifyCnt = 0u;
+		Adbms6948_aoChainStateInfo[nChainIndex].bCmdCntResync = TRUE;
+
 		Adbms6948_aoChainStateInfo[nChainIndex].nCurrNoOfDevices =
 							Adbms6948_pDaisyChainCfgInput[nChainIndex].Adbms6948_nNoOfDevices;
 
         /*Wakeup*/
 		Adbms6948_Cmn_WakeUpBmsIC(nChainIndex);
 
-        /*Software reset the IC, puts it into sleep mode*/
-		Adbms6948_Cmd_ExecCmd(ADBMS6948_CMD_SRST, FALSE, nChainIndex);
+		/* A chain which kept its configuration, e.g. over a reset of the host, is taken over */
+		bChainCfgd = FALSE;
+		if ((TRUE == bReInit) || (TRUE == Adbms6948_pDaisyChainCfgInput[nChainIndex].Adbms6948_bWarmInit))
+		{
+			bChainCfgd = Adbms6948_lWarmInitChain(nCfgAData, nCfgBData, nCfgCData, nChainIndex);
+		}
 
-        /*Wakeup the IC again*/
-		Adbms6948_Cmn_WakeUpBmsIC(nChainIndex);
+		if (FALSE == bChainCfgd)
+		{
+			if (FALSE == bReInit)
+			{
+				/*Software reset the IC, puts it into sleep mode*/
+				Adbms6948_Cmd_ExecCmd(ADBMS6948_CMD_SRST, FALSE, nChainIndex);
+
+				/*Wakeup the IC again*/
+				Adbms6948_Cmn_WakeUpBmsIC(nChainIndex);
+			}
 
-		/* Copy the configuration data to local variable */
-		Adbms6948_lPrepConfigBuff(ADBMS6948_CMD_RDCFGA,aRdCfgData,nCfgAData,&nCfgDataChain[0u],nChainIndex);
+			/* Copy the configuration data to local variable */
+			Adbms6948_lPrepConfigBuff(ADBMS6948_CMD_RDCFGA,aRdCfgData,nCfgAData,&nCfgDataChain[0u],nChainIndex);
 
-		/* Clear the command counter. */
-		Adbms6948_Cmd_ExecCmd(ADBMS6948_CMD_RSTCC, FALSE, nChainIndex);
+			/* Clear the command counter. */
+			Adbms6948_Cmd_ExecCmd(ADBMS6948_CMD_RSTCC, FALSE, nChainIndex);
 
-		/* Write the configuration register to the BMS IC */
-		Adbms6948_Cmd_ExecuteCmdWR(ADBMS6948_CMD_WRCFGA, &nCfgDataChain[0], nChainIndex);
-        /* Read the configuration register from the BMS IC and compare with the written values*/
-        anCmdList[0u] = ADBMS6948_CMD_RDCFGA;
-        nRet = Adbms6948_Cmn_ReadRegGroup(anCmdList, aRdCfgData, ADBMS6948_NUMOF_REGGRP_ONE, nChainIndex);
+			/* Write the configuration register to the BMS IC */
+			Adbms6948_Cmd_ExecuteCmdWR(ADBMS6948_CMD_WRCFGA, &nCfgDataChain[0], nChainIndex);
+			/* Read the configuration register from the BMS IC and compare with the written values*/
+			anCmdList[0u] = ADBMS6948_CMD_RDCFGA;
+			nRet = Adbms6948_Cmn_ReadRegGroup(anCmdList, aRdCfgData, ADBMS6948_NUMOF_REGGRP_ONE, nChainIndex);
 
-        /*Calibration delay*/
-        ADI_PAL_TIMERDELAY(ADBMS6948_TIME_CALIBRATION, nChainIndex);
+			/*Calibration delay*/
+			ADI_PAL_TIMERDELAY(ADBMS6948_TIME_CALIBRATION, nChainIndex);
 #if 0
-        for(int i = 0; i < ADBMS6948_REG_DATA_LEN_WITHOUT_PEC; ++i)
-        {
-            if (aRdCfgData[0][i + ADBMS6948_CMD_DATA_LEN] != nCfgDataChain[i])
-            {
-                nRet = E_NOT_OK;
-                break;
-            }
-        }
+			for(int i = 0; i < ADBMS6948_REG_DATA_LEN_WITHOUT_PEC; ++i)
+			{
+				if (aRdCfgData[0][i + ADBMS6948_CMD_DATA_LEN] != nCfgDataChain[i])
+				{
+					nRet = E_NOT_OK;
+					break;
+				}
+			}
 #endif
-        if (E_OK == nRet)
-        {
-            /* Copy the configuration data to local variable */
-            Adbms6948_lPrepConfigBuff(ADBMS6948_CMD_RDCFGB, aRdCfgData, nCfgBData, &nCfgDataChain[0u], nChainIndex);
-            /* Write the configuration to the chain */
-            Adbms6948_Cmd_ExecuteCmdWR(ADBMS6948_CMD_WRCFGB, &nCfgDataChain[0], nChainIndex);
-            /* Read the configuration register from the BMS IC and compare with the written values*/
-            anCmdList[0u] = ADBMS6948_CMD_RDCFGB;
-            nRet = Adbms6948_Cmn_ReadRegGroup(anCmdList, aRdCfgData, ADBMS6948_NUMOF_REGGRP_ONE, nChainIndex);
-            for(int i = 0; i < ADBMS6948_REG_DATA_LEN_WITHOUT_PEC; ++i)
-            {
-                if (aRdCfgData[0][i + ADBMS6948_CMD_DATA_LEN] != nCfgDataChain[i])
-                {
-                    nRet = E_NOT_OK;
-                    break;
-                }
-            }
-        }
+			if (E_OK == nRet)
+			{
+				/* Copy the configuration data to local variable */
+				Adbms6948_lPrepConfigBuff(ADBMS6948_CMD_RDCFGB, aRdCfgData, nCfgBData, &nCfgDataChain[0u], nChainIndex);
+				/* Write the configuration to the chain */
+				Adbms6948_Cmd_ExecuteCmdWR(ADBMS6948_CMD_WRCFGB, &nCfgDataChain[0], nChainIndex);
+				/* Read the configuration register from the BMS IC and compare with the written values*/
+				anCmdList[0u] = ADBMS6948_CMD_RDCFGB;
+				nRet = Adbms6948_Cmn_ReadRegGroup(anCmdList, aRdCfgData, ADBMS6948_NUMOF_REGGRP_ONE, nChainIndex);
+				for(int i = 0; i < ADBMS6948_REG_DATA_LEN_WITHOUT_PEC; ++i)
+				{
+					if (aRdCfgData[0][i + ADBMS6948_CMD_DATA_LEN] != nCfgDataChain[i])
+					{
+						nRet = E_NOT_OK;
+						break;
+					}
+				}
+			}
 
-        if (E_OK == nRet)
-        {
-            /* Copy the configuration data to local variable */
-            Adbms6948_lPrepConfigBuff(ADBMS6948_CMD_RDCFGC,aRdCfgData,nCfgCData,&nCfgDataChain[0u],nChainIndex);
-            /* Write the configuration to the chain */
-            Adbms6948_Cmd_ExecuteCmdWR(ADBMS6948_CMD_WRCFGC, &nCfgDataChain[0], nChainIndex);
-            /* Read the configuration register from the BMS IC and compare with the written values*/
-            anCmdList[0u] = ADBMS6948_CMD_RDCFGC;
-            nRet = Adbms6948_Cmn_ReadRegGroup(anCmdList, aRdCfgData, ADBMS6948_NUMOF_REGGRP_ONE, nChainIndex);
-            for(int i = 0; i < ADBMS6948_REG_DATA_LEN_WITHOUT_PEC; ++i)
-            {
-                if (aRdCfgData[0][i + ADBMS6948_CMD_DATA_LEN] != nCfgDataChain[i])
-                {
-                    nRet = E_NOT_OK;
-                    break;
-                }
-            }
-        }
+			if (E_OK == nRet)
+			{
+				/* Copy the configuration data to local variable */
+				Adbms6948_lPrepConfigBuff(ADBMS6948_CMD_RDCFGC,aRdCfgData,nCfgCData,&nCfgDataChain[0u],nChainIndex);
+				/* Write the configuration to the chain */
+				Adbms6948_Cmd_ExecuteCmdWR(ADBMS6948_CMD_WRCFGC, &nCfgDataChain[0], nChainIndex);
+				/* Read the configuration register from the BMS IC and compare with the written values*/
+				anCmdList[0u] = ADBMS6948_CMD_RDCFGC;
+				nRet = Adbms6948_Cmn_ReadRegGroup(anCmdList, aRdCfgData, ADBMS6948_NUMOF_REGGRP_ONE, nChainIndex);
+				for(int i = 0; i < ADBMS6948_REG_DATA_LEN_WITHOUT_PEC; ++i)
+				{
+					if (aRdCfgData[0][i + ADBMS6948_CMD_DATA_LEN] != nCfgDataChain[i])
+					{
+						nRet = E_NOT_OK;
+						break;
+					}
+				}
+			}
+		}
 
 		if (E_OK == nRet)
 		{
@@ -468,7 +626,12 @@ return (nRet);
  /*!
     @brief          This function updates the different values for specified
 					register in the configuration register group for all the
-					devices with specified data.
+					devices with specified data. The group is merged into the
+					shadow copy and written; the device is read only when the
+					shadow copy is not valid and on the sampled read back
+					verification, see \ref Adbms6948_lWriteCfgShadow. Within a
+					configuration transaction the field is staged instead, see
+					\ref Adbms6948_Cmn_CommitCfgTxn.
 
 	@param	[in]   	eCfgRegGrpSel  	Selects configuration register group.
 
@@ -498,103 +661,29 @@ Adbms6948_ReturnType  Adbms6948_Cmn_UpdateConfigPerDevice
 	const uint8_t  						knChainID
 )
 {
-	Adbms6948_ReturnType  nRet = E_OK;
+	Adbms6948_ReturnType  nRet = E_NOT_OK;
 	uint8_t  nDeviceIndex;
-	uint8_t  nRdCfgByteIndex;
-	uint8_t  nWrCfgByteIndex;
-	uint8_t  aRdCfgData[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)] = {0u};
 	uint8_t  aWrCfgData[ADBMS6948_REG_GRP_LEN * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN] = {0u};
-	uint8_t  nLoopIdx;
-	uint8_t  nCfgBytesPerDev;
-	uint16_t  nRdCmd, nWrCmd,nWrIdx,aCmdList[1u];
-	uint32_t  nDataCfg,nDataBufLen;
+	uint16_t  nWrIdx;
 
-	nDataBufLen = (uint32_t)((uint32_t)ADBMS6948_CMD_DATA_LEN + Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices * (uint32_t)ADBMS6948_REG_DATA_LEN_WITH_PEC);
-	nDataCfg = (((uint32_t)ADBMS6948_NUMOF_REGGRP_ONE << 16u) | (nDataBufLen));
-
-	switch(eCfgRegGrpSel)
+	if ((eCfgRegGrpSel < ADBMS6948_CONFIG_GROUP_INVALID) && (nRegId <= 5u))
 	{
-		case ADBMS6948_CONFIG_GROUP_A:
-			nRdCmd = ADBMS6948_CMD_RDCFGA;
-			nWrCmd = ADBMS6948_CMD_WRCFGA;
-			break;
-		case ADBMS6948_CONFIG_GROUP_B:
-			nRdCmd = ADBMS6948_CMD_RDCFGB;
-			nWrCmd = ADBMS6948_CMD_WRCFGB;
-			break;
-		default:
-			nRet = E_NOT_OK;
-			break;
+		nRet = Adbms6948_lLoadCfg(eCfgRegGrpSel, &aWrCfgData[0], knChainID);
 	}
 
 	if (nRet == E_OK)
 	{
-		if (nRegId<=5u)
+		for (nDeviceIndex = 0u; nDeviceIndex < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDeviceIndex++)
 		{
-			nCfgBytesPerDev = (uint8_t)(ADBMS6948_REG_GRP_LEN + ADBMS6948_PEC_LEN);
-
-			/* Read the configuration to the chain */
-			aCmdList[0u] =  nRdCmd;
-			Adbms6948_Cmd_ExecuteCmdRD(aCmdList,aRdCfgData,nDataCfg,FALSE,knChainID);
-
-			for (nDeviceIndex = 0u; nDeviceIndex < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDeviceIndex++)
+			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDeviceIndex])
 			{
-				nRdCfgByteIndex = (uint8_t)(ADBMS6948_CMD_DATA_LEN + (uint8_t)(nDeviceIndex * ADBMS6948_REG_DATA_LEN_WITH_PEC));
-				nWrCfgByteIndex = nDeviceIndex * (ADBMS6948_REG_GRP_LEN);
-				if (TRUE == Adbms6948_Cmn_ValidatePEC((uint8_t*)&aRdCfgData[0u][nRdCfgByteIndex],nCfgBytesPerDev, nDeviceIndex, knChainID))
-				{
-					for (nLoopIdx = 0u; nLoopIdx < ADBMS6948_REG_GRP_LEN; nLoopIdx++)
-					{
-						aWrCfgData[nWrCfgByteIndex + nLoopIdx] = aRdCfgData[0u][nRdCfgByteIndex + nLoopIdx];
-					}
-					if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDeviceIndex])
-					{
-						nWrIdx = (uint16_t)nWrCfgByteIndex + nRegId;
-						aWrCfgData[nWrIdx] &= (uint8_t)(~nMask);
-						aWrCfgData[nWrIdx] |= (uint8_t)(pData[nDeviceIndex]);
-					}
-				}
-				else
-				{
-					nRet |= E_NOT_OK;
-				}
+				nWrIdx = (uint16_t)((uint16_t)nDeviceIndex * ADBMS6948_REG_GRP_LEN) + nRegId;
+				aWrCfgData[nWrIdx] &= (uint8_t)(~nMask);
+				aWrCfgData[nWrIdx] |= (uint8_t)(pData[nDeviceIndex]);
 			}
-
-			if (nRet == E_OK)
-			{
-                /* Write the configuration to the chain */
-                Adbms6948_Cmd_ExecuteCmdWR(nWrCmd, &aWrCfgData[0], knChainID);
-
-                /*Read the configuration register and verify contents along with PEC and command counter*/
-    			aCmdList[0u] =  nRdCmd;
-                Adbms6948_Cmd_ExecuteCmdRD(aCmdList, aRdCfgData, nDataCfg, FALSE, knChainID);
-                for (nDeviceIndex = 0u; nDeviceIndex < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDeviceIndex++)
-                {
-                    nRdCfgByteIndex = (uint8_t)(ADBMS6948_CMD_DATA_LEN + (uint8_t)(nDeviceIndex * ADBMS6948_REG_DATA_LEN_WITH_PEC));
-                    nWrCfgByteIndex = nDeviceIndex * (ADBMS6948_REG_GRP_LEN);
-                    if (TRUE == Adbms6948_Cmn_ValidatePEC((uint8_t*)&aRdCfgData[0u][nRdCfgByteIndex], nCfgBytesPerDev, nDeviceIndex, knChainID))
-                    {
-                        for (nLoopIdx = 0u; nLoopIdx < ADBMS6948_REG_GRP_LEN; nLoopIdx++)
-                        {
-                            if (aRdCfgData[0u][nRdCfgByteIndex + nLoopIdx] != aWrCfgData[nWrCfgByteIndex + nLoopIdx])
-                            {
-                                nRet |= E_NOT_OK;
-                                break;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        nRet = E_NOT_OK;
-                        break;
-                    }
-                }
-			}
-		}
-		else
-		{
-			nRet = E_NOT_OK;
 		}
+
+		nRet = Adbms6948_lStoreCfg(eCfgRegGrpSel, nRegId, &nMask, 1u, &aWrCfgData[0], knChainID);
 	}
 return(nRet);
 }
@@ -603,7 +692,7 @@ return(nRet);
  * Function Definition section
  */
  /*!
-    @brief         This function updates the different values for two specified registers in the configuration register group for all the devices with specified data.
+    @brief         This function updates the different values for two specified registers in the configuration register group for all the devices with specified data. The group is merged into the shadow copy and written, see \ref Adbms6948_Cmn_UpdateConfigPerDevice.
 
 	@param	[in]   	eCfgRegGrpSel  	Selects configuration register group.
 
@@ -628,147 +717,212 @@ Adbms6948_ReturnType  Adbms6948_Cmn_UpdateConfig16
 	const uint8_t  						knChainID
 )
 {
-	Adbms6948_ReturnType  nRet = E_OK;
+	Adbms6948_ReturnType  nRet = E_NOT_OK;
 	uint8_t  nDeviceIndex;
-	uint8_t  nRdCfgByteIndex;
-	uint8_t  nWrCfgByteIndex;
-	uint8_t  aRdCfgData[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)] = {0u};
 	uint8_t  aWrCfgData[ADBMS6948_REG_GRP_LEN * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN] = {0u};
-	uint8_t  nLoopIdx, nDataIndex = 0u;
-	uint8_t  nCfgBytesPerDev;
-	uint16_t  nRdCmd, nWrCmd,nWrIdx;
-	uint16_t aCmdList[1u];
-	uint32_t  nDataCfg,nDataBufLen;
+	uint8_t  nDataIndex = 0u;
+	uint16_t  nWrIdx;
 
-	nDataBufLen = (uint32_t)((uint32_t)ADBMS6948_CMD_DATA_LEN + Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices * (uint32_t)ADBMS6948_REG_DATA_LEN_WITH_PEC);
-	nDataCfg = (((uint32_t)ADBMS6948_NUMOF_REGGRP_ONE << 16u) | (nDataBufLen));
-
-	switch(eCfgRegGrpSel)
+	if ((eCfgRegGrpSel < ADBMS6948_CONFIG_GROUP_INVALID) && (nRegId <= 4u))
 	{
-		case ADBMS6948_CONFIG_GROUP_A:
-			nRdCmd = ADBMS6948_CMD_RDCFGA;
-			nWrCmd = ADBMS6948_CMD_WRCFGA;
-			break;
-		case ADBMS6948_CONFIG_GROUP_B:
-			nRdCmd = ADBMS6948_CMD_RDCFGB;
-			nWrCmd = ADBMS6948_CMD_WRCFGB;
-			break;
-        case ADBMS6948_CONFIG_GROUP_C:
-			nRdCmd = ADBMS6948_CMD_RDCFGC;
-			nWrCmd = ADBMS6948_CMD_WRCFGC;
-			break;
-        case ADBMS6948_CONFIG_GROUP_D:
-			nRdCmd = ADBMS6948_CMD_RDCFGD;
-			nWrCmd = ADBMS6948_CMD_WRCFGD;
-			break;
-        case ADBMS6948_CONFIG_GROUP_E:
-			nRdCmd = ADBMS6948_CMD_RDCFGE;
-			nWrCmd = ADBMS6948_CMD_WRCFGE;
-			break;
-        case ADBMS6948_CONFIG_GROUP_F:
-			nRdCmd = ADBMS6948_CMD_RDCFGF;
-			nWrCmd = ADBMS6948_CMD_WRCFGF;
-			break;
-        case ADBMS6948_CONFIG_GROUP_G:
-			nRdCmd = ADBMS6948_CMD_RDCFGG;
-			nWrCmd = ADBMS6948_CMD_WRCFGG;
-			break;
-        case ADBMS6948_CONFIG_GROUP_H:
-			nRdCmd = ADBMS6948_CMD_RDCFGH;
-			nWrCmd = ADBMS6948_CMD_WRCFGH;
-			break;
-        case ADBMS6948_CONFIG_GROUP_I:
-			nRdCmd = ADBMS6948_CMD_RDCFGI;
-			nWrCmd = ADBMS6948_CMD_WRCFGI;
-			break;
-		default:
-			nRet = E_NOT_OK;
-			break;
+		nRet = Adbms6948_lLoadCfg(eCfgRegGrpSel, &aWrCfgData[0], knChainID);
 	}
 
-	if (nRegId > 4u)
+	if (nRet == E_OK)
 	{
-		nRet = E_NOT_OK;
+		for (nDeviceIndex = 0u; nDeviceIndex < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDeviceIndex++)
+		{
+			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDeviceIndex])
+			{
+				nWrIdx = (uint16_t)((uint16_t)nDeviceIndex * ADBMS6948_REG_GRP_LEN) + nRegId;
+				aWrCfgData[nWrIdx] &= (uint8_t)(~aMask[0u]);
+				aWrCfgData[nWrIdx] |= (uint8_t)(pData[nDataIndex++]);
+				nWrIdx++;
+				aWrCfgData[nWrIdx] &= (uint8_t)(~aMask[1u]);
+				aWrCfgData[nWrIdx] |= (uint8_t)(pData[nDataIndex++]);
+			}
+		}
+
+		nRet = Adbms6948_lStoreCfg(eCfgRegGrpSel, nRegId, aMask, 2u, &aWrCfgData[0], knChainID);
 	}
+return(nRet);
+}
 
-	if (nRet == E_OK)
-	{
-		nCfgBytesPerDev = (uint8_t)(ADBMS6948_REG_GRP_LEN + ADBMS6948_PEC_LEN);
+/*!
+    @brief  This function marks the shadow copy of configuration register groups as stale, so the
+    next update of a group reads it from the devices first. It is called whenever the devices may
+    hold other contents than the driver wrote, e.g. after a reset or a command counter mismatch.
 
-		/* Read the configuration to the chain */
-		aCmdList[0u] =  nRdCmd;
-		Adbms6948_Cmd_ExecuteCmdRD(aCmdList,aRdCfgData,nDataCfg,FALSE, knChainID);
+    @param  [in]  nGrpMask  Groups to invalidate, bit n for \ref Adbms6948_ConfigGroupSelection n.
 
-		for (nDeviceIndex = 0u; nDeviceIndex < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDeviceIndex++)
+    @param  [in]  knChainID  The daisy chain ID to perform the operation.
+
+    @return  None.
+*/
+void  Adbms6948_Cmn_InvalidateCfgShadow
+(
+	uint16_t 		nGrpMask,
+	const uint8_t  	knChainID
+)
+{
+	Adbms6948_aoChainStateInfo[knChainID].nCfgShadowValid &= (uint16_t)(~nGrpMask);
+}
+
+/*!
+    @brief  This function opens a configuration transaction. Until the transaction is committed or
+    aborted, \ref Adbms6948_Cmn_UpdateConfigPerDevice and \ref Adbms6948_Cmn_UpdateConfig16 stage
+    their fields per register group instead of writing them.
+
+    @param  [in]  knChainID  The daisy chain ID to perform the operation.
+
+    @return  None.
+*/
+void  Adbms6948_Cmn_BeginCfgTxn
+(
+	const uint8_t  	knChainID
+)
+{
+	Adbms6948_ChainStateInfoType  *poChain = &Adbms6948_aoChainStateInfo[knChainID];
+
+	Adbms6948_Cmn_Memset(&poChain->aCfgTxnData[0u][0u], 0u, (uint32_t)sizeof(poChain->aCfgTxnData));
+	Adbms6948_Cmn_Memset(&poChain->aCfgTxnMask[0u][0u], 0u, (uint32_t)sizeof(poChain->aCfgTxnMask));
+	poChain->nCfgTxnDirty = 0u;
+	poChain->bCfgTxnOpen = TRUE;
+}
+
+/*!
+    @brief  This function closes a configuration transaction and discards the staged fields.
+
+    @param  [in]  knChainID  The daisy chain ID to perform the operation.
+
+    @return  None.
+*/
+void  Adbms6948_Cmn_AbortCfgTxn
+(
+	const uint8_t  	knChainID
+)
+{
+	Adbms6948_aoChainStateInfo[knChainID].bCfgTxnOpen = FALSE;
+	Adbms6948_aoChainStateInfo[knChainID].nCfgTxnDirty = 0u;
+}
+
+/*!
+    @brief  This function closes a configuration transaction and applies the staged fields. Every
+    register group with staged fields is merged into its shadow copy and written once; all written
+    groups are then read back together and compared, PEC and command counter included.
+
+    @param  [in]  knChainID  The daisy chain ID to perform the operation.
+
+    @return  E_OK: Operation was successful
+             E_NOT_OK: Operation failed, the written groups are read again on their next update
+*/
+Adbms6948_ReturnType  Adbms6948_Cmn_CommitCfgTxn
+(
+	const uint8_t  	knChainID
+)
+{
+	Adbms6948_ReturnType  nRet = E_OK;
+	Adbms6948_ChainStateInfoType  *poChain = &Adbms6948_aoChainStateInfo[knChainID];
+	uint8_t  aWrCfgData[ADBMS6948_REG_GRP_LEN * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+	uint8_t  aRdCfgData[ADBMS6948_NUMOF_REGGRP_SIX][ADBMS6948_MAX_FRAME_SIZE] = {0u};
+	uint16_t  anCmdList[ADBMS6948_NUMOF_REGGRP_SIX];
+	uint8_t  anGrpList[ADBMS6948_NUMOF_REGGRP_SIX];
+	uint8_t  nGrp, nNoOfGrps, nGrpIdx, nDevIdx, nByteIdx;
+	uint16_t  nDataIdx, nGrpBit, nWritten = 0u;
+
+	poChain->bCfgTxnOpen = FALSE;
+
+	/* Merge the staged fields and write every dirty group once */
+	for (nGrp = 0u; (E_OK == nRet) && (nGrp < (uint8_t)ADBMS6948_CONFIG_GROUP_INVALID); nGrp++)
+	{
+		nGrpBit = (uint16_t)((uint16_t)1u << nGrp);
+		if ((poChain->nCfgTxnDirty & nGrpBit) != 0u)
 		{
-			nRdCfgByteIndex = (uint8_t)(ADBMS6948_CMD_DATA_LEN + (uint8_t)(nDeviceIndex * ADBMS6948_REG_DATA_LEN_WITH_PEC));
-			nWrCfgByteIndex = nDeviceIndex * (ADBMS6948_REG_GRP_LEN);
-			if (TRUE == Adbms6948_Cmn_ValidatePEC((uint8_t*)&aRdCfgData[0u][nRdCfgByteIndex],nCfgBytesPerDev, nDeviceIndex, knChainID))
+			nRet = Adbms6948_lReadCfgShadow((Adbms6948_ConfigGroupSelection)nGrp, &aWrCfgData[0u], knChainID);
+			if (E_OK == nRet)
 			{
-				for (nLoopIdx = 0u; nLoopIdx < ADBMS6948_REG_GRP_LEN; nLoopIdx++)
+				for (nDevIdx = 0u; nDevIdx < poChain->nCurrNoOfDevices; nDevIdx++)
 				{
-					aWrCfgData[nWrCfgByteIndex + nLoopIdx] = aRdCfgData[0u][nRdCfgByteIndex + nLoopIdx];
-				}
-				if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDeviceIndex])
-				{
-					nWrIdx = (uint16_t)nWrCfgByteIndex + nRegId;
-					aWrCfgData[nWrIdx] &= (uint8_t)(~aMask[0u]);
-					aWrCfgData[nWrIdx] |= (uint8_t)(pData[nDataIndex++]);
-					nWrIdx = (uint16_t)nWrCfgByteIndex + nRegId + 1u;
-					aWrCfgData[nWrIdx] &= (uint8_t)(~aMask[1u]);
-					aWrCfgData[nWrIdx] |= (uint8_t)(pData[nDataIndex++]);
+					if (ADBMS6948_DEVICE == poChain->Adbms6948_eDevChain[nDevIdx])
+					{
+						for (nByteIdx = 0u; nByteIdx < ADBMS6948_REG_GRP_LEN; nByteIdx++)
+						{
+							nDataIdx = (uint16_t)((uint16_t)nDevIdx * ADBMS6948_REG_GRP_LEN) + nByteIdx;
+							aWrCfgData[nDataIdx] &= (uint8_t)(~poChain->aCfgTxnMask[nGrp][nByteIdx]);
+							aWrCfgData[nDataIdx] |= (uint8_t)(poChain->aCfgTxnData[nGrp][nDataIdx] & poChain->aCfgTxnMask[nGrp][nByteIdx]);
+						}
+					}
 				}
+				Adbms6948_Cmd_ExecuteCmdWR(Adbms6948_kaCfgWrCmd[nGrp], &aWrCfgData[0u], knChainID);
+				Adbms6948_Cmn_Memcpy(&poChain->aCfgShadow[nGrp][0u], &aWrCfgData[0u],
+				(uint32_t)poChain->nCurrNoOfDevices * ADBMS6948_REG_GRP_LEN);
+				nWritten |= nGrpBit;
 			}
-			else
+		}
+	}
+	poChain->nCfgTxnDirty = 0u;
+
+	/* Read back the written groups in one multi group read, up to six groups per read */
+	nGrp = 0u;
+	while ((E_OK == nRet) && (nGrp < (uint8_t)ADBMS6948_CONFIG_GROUP_INVALID))
+	{
+		nNoOfGrps = 0u;
+		for (; (nGrp < (uint8_t)ADBMS6948_CONFIG_GROUP_INVALID) && (nNoOfGrps < ADBMS6948_NUMOF_REGGRP_SIX); nGrp++)
+		{
+			if ((nWritten & (uint16_t)((uint16_t)1u << nGrp)) != 0u)
 			{
-				nRet |= E_NOT_OK;
+				anCmdList[nNoOfGrps] = Adbms6948_kaCfgRdCmd[nGrp];
+				anGrpList[nNoOfGrps] = nGrp;
+				nNoOfGrps++;
 			}
 		}
-
-		if (nRet == E_OK)
+		if (nNoOfGrps > 0u)
 		{
-			/* Write the configuration to the chain */
-			Adbms6948_Cmd_ExecuteCmdWR(nWrCmd, &aWrCfgData[0], knChainID);
-
-            /*Read the configuration register and verify contents along with PEC and command counter*/
-            aCmdList[0u] =  nRdCmd;
-            Adbms6948_Cmd_ExecuteCmdRD(aCmdList, aRdCfgData, nDataCfg, FALSE, knChainID);
-
-            for (nDeviceIndex = 0u; nDeviceIndex < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDeviceIndex++)
-            {
-                nRdCfgByteIndex = (uint8_t)(ADBMS6948_CMD_DATA_LEN + (uint8_t)(nDeviceIndex * ADBMS6948_REG_DATA_LEN_WITH_PEC));
-                nWrCfgByteIndex = nDeviceIndex * (ADBMS6948_REG_GRP_LEN);
-                if (TRUE == Adbms6948_Cmn_ValidatePEC((uint8_t*)&aRdCfgData[0u][nRdCfgByteIndex],nCfgBytesPerDev, nDeviceIndex, knChainID))
-                {
-                    for (nLoopIdx = 0u; nLoopIdx < ADBMS6948_REG_GRP_LEN; nLoopIdx++)
-                    {
-                        if (aRdCfgData[0u][nRdCfgByteIndex + nLoopIdx] != aWrCfgData[nWrCfgByteIndex + nLoopIdx])
-                        {
-                            nRet |= E_NOT_OK;
-                            break;
-                        }
-                    }
-                }
-                else
-                {
-                    nRet = E_NOT_OK;
-                    break;
-                }
-            }
+			nRet = Adbms6948_Cmn_ReadRegGroup(anCmdList, aRdCfgData, nNoOfGrps, knChainID);
+		}
+		for (nGrpIdx = 0u; (E_OK == nRet) && (nGrpIdx < nNoOfGrps); nGrpIdx++)
+		{
+			for (nDevIdx = 0u; nDevIdx < poChain->nCurrNoOfDevices; nDevIdx++)
+			{
+				if (ADBMS6948_DEVICE == poChain->Adbms6948_eDevChain[nDevIdx])
+				{
+					for (nByteIdx = 0u; nByteIdx < ADBMS6948_REG_GRP_LEN; nByteIdx++)
+					{
+						nDataIdx = (uint16_t)((uint16_t)nDevIdx * ADBMS6948_REG_GRP_LEN) + nByteIdx;
+						if (aRdCfgData[nGrpIdx][ADBMS6948_CMD_DATA_LEN + (nDevIdx * ADBMS6948_REG_DATA_LEN_WITH_PEC) + nByteIdx] !=
+							poChain->aCfgShadow[anGrpList[nGrpIdx]][nDataIdx])
+						{
+							nRet = E_NOT_OK;
+						}
+					}
+				}
+			}
 		}
 	}
-return(nRet);
+
+	if (E_OK == nRet)
+	{
+		poChain->nCfgWrVerifyCnt = 0u;
+	}
+	else
+	{
+		/* The devices may hold other contents than the shadow copy */
+		Adbms6948_Cmn_InvalidateCfgShadow(nWritten, knChainID);
+	}
+return (nRet);
 }
 
 /*
  * Function Definition section
  */
  /*!
-    @brief         This function updates the different values for two specified registers in the configuration register group for all the devices with specified data.
+    @brief         This function writes PWM register groups A and B of all the devices and verifies them
+    by reading them back. A group whose shadow copy already holds the data is not written, so refreshing
+    unchanged duty cycles costs no SPI traffic.
 
- 	@param	[in]   	pPwmCfgA	 		Array of config A Pwm register data.
+ 	@param	[in]   	pPwmCfgA	 		PWM register group A data, six bytes per device in chain order.
 
- 	@param	[in]   	pPwmCfgB	 		Array of config B Pwm register data.
+ 	@param	[in]   	pPwmCfgB	 		PWM register group B data, six bytes per device in chain order.
 
 	@param	[in]   	knChainID	    The Id of the daisy chain on which the operation is done. It is mapped to the array index of configuration in Adbms6948_DaisyChainCfgType member of \ref Adbms6948_CfgType. It starts with 0 for the first chain.
 
@@ -783,71 +937,91 @@ const uint8_t  	 knChainID
 )
 {
 	Adbms6948_ReturnType  nRet;
-    uint16_t nCmd = ADBMS6948_CMD_RDPWMA;
-	uint8_t aRdPwmData[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)] = {0u};
-    uint32_t nDataCfg,nDataBufLen;
-    uint8_t nDeviceIndex;
-    uint32_t nRdPwmByteIndex, nWrPwmByteIndex;
 
-	nDataBufLen = (uint32_t)((uint32_t)ADBMS6948_CMD_DATA_LEN + Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices * (uint32_t)ADBMS6948_REG_DATA_LEN_WITH_PEC);
-	nDataCfg = (((uint32_t)ADBMS6948_NUMOF_REGGRP_ONE << 16u) | (nDataBufLen));
+	nRet = Adbms6948_lWritePwmGrp(0u, pPwmCfgA, knChainID);
+	if (E_OK == nRet)
+	{
+		nRet = Adbms6948_lWritePwmGrp(1u, pPwmCfgB, knChainID);
+	}
+	return nRet;
+}
 
-    /* Write PWM A config registers */
-	Adbms6948_Cmd_ExecuteCmdWR(ADBMS6948_CMD_WRPWMA, &pPwmCfgA[0], knChainID);
-    /* Read PWM A config register and verify the register value, PEC and command count*/
-    Adbms6948_Cmd_ExecuteCmdRD(&nCmd, aRdPwmData, nDataCfg, FALSE, knChainID);
-    for (nDeviceIndex = 0u; nDeviceIndex < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDeviceIndex++)
-    {
-        nRdPwmByteIndex = (uint8_t)(ADBMS6948_CMD_DATA_LEN + (uint8_t)(nDeviceIndex * ADBMS6948_REG_DATA_LEN_WITH_PEC));
-        nWrPwmByteIndex = nDeviceIndex * (ADBMS6948_REG_GRP_LEN);
-        if (TRUE == Adbms6948_Cmn_ValidatePEC((uint8_t*)&aRdPwmData[0u][nRdPwmByteIndex], ADBMS6948_REG_DATA_LEN_WITH_PEC, nDeviceIndex, knChainID))
-        {
-            for (uint8_t nLoopIdx = 0u; nLoopIdx < ADBMS6948_REG_GRP_LEN; nLoopIdx++)
-            {
-                if (aRdPwmData[0u][nRdPwmByteIndex + nLoopIdx] != pPwmCfgA[nWrPwmByteIndex + nLoopIdx])
-                {
-                    nRet |= E_NOT_OK;
-                    break;
-                }
-            }
-        }
-        else
-        {
-            nRet |= E_NOT_OK;
-            break;
-        }
-    }
+/*!
+    @brief         This function writes a PWM register group unless its shadow copy already holds the
+    data, then reads it back and verifies the data, PEC and command counter of every device.
 
-    if (E_OK == nRet)
-    {
-        /* Write PWM B config registers */
-        Adbms6948_Cmd_ExecuteCmdWR(ADBMS6948_CMD_WRPWMB, &pPwmCfgB[0], knChainID);
-        /* Read PWM B config register and verify the register value, PEC and command count*/
-        Adbms6948_Cmd_ExecuteCmdRD(&nCmd, aRdPwmData, nDataCfg, FALSE, knChainID);
-        for (nDeviceIndex = 0u; nDeviceIndex < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDeviceIndex++)
-        {
-            nRdPwmByteIndex = (uint8_t)(ADBMS6948_CMD_DATA_LEN + (uint8_t)(nDeviceIndex * ADBMS6948_REG_DATA_LEN_WITH_PEC));
-            nWrPwmByteIndex = nDeviceIndex * (ADBMS6948_REG_GRP_LEN);
-            if (TRUE == Adbms6948_Cmn_ValidatePEC((uint8_t*)&aRdPwmData[0u][nRdPwmByteIndex], ADBMS6948_REG_DATA_LEN_WITH_PEC, nDeviceIndex, knChainID))
-            {
-                for (uint8_t nLoopIdx = 0u; nLoopIdx < ADBMS6948_REG_GRP_LEN; nLoopIdx++)
-                {
-                    if (aRdPwmData[0u][nRdPwmByteIndex + nLoopIdx] != pPwmCfgA[nWrPwmByteIndex + nLoopIdx])
-                    {
-                        nRet |= E_NOT_OK;
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                nRet |= E_NOT_OK;
-                break;
-            }
-        }
-    }
+ 	@param	[in]   	nPwmGrp	 		PWM register group, 0 for A and 1 for B.
+
+ 	@param	[in]   	pPwmCfg	 		Register group data, six bytes per device in chain order.
+
+	@param	[in]   	knChainID	    The daisy chain ID to perform the operation.
+
+   @return        	E_OK    : Operation was successful \n
+                    E_NOT_OK: Operation failed \n
+ */
+static Adbms6948_ReturnType  Adbms6948_lWritePwmGrp
+(
+uint8_t 		 nPwmGrp,
+uint8_t 		*pPwmCfg,
+const uint8_t  	 knChainID
+)
+{
+	Adbms6948_ChainStateInfoType  *poChain = &Adbms6948_aoChainStateInfo[knChainID];
+	Adbms6948_ReturnType  nRet = E_OK;
+	uint16_t nCmd = Adbms6948_kaPwmRdCmd[nPwmGrp];
+	uint16_t nGrpBit = Adbms6948_kaPwmShadowBit[nPwmGrp];
+	uint8_t aRdPwmData[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_MAX_FRAME_SIZE] = {0u};
+	uint32_t nDataCfg, nDataBufLen, nGrpLen, nByteIdx;
+	uint32_t nRdPwmByteIndex, nWrPwmByteIndex;
+	uint8_t nDeviceIndex, nLoopIdx;
+	boolean bChanged = FALSE;
+
+	nGrpLen = (uint32_t)poChain->nCurrNoOfDevices * ADBMS6948_REG_GRP_LEN;
+	for (nByteIdx = 0u; nByteIdx < nGrpLen; nByteIdx++)
+	{
+		if (poChain->aPwmShadow[nPwmGrp][nByteIdx] != pPwmCfg[nByteIdx])
+		{
+			bChanged = TRUE;
+		}
+	}
+
+	if ((TRUE == bChanged) || ((poChain->nCfgShadowValid & nGrpBit) == 0u))
+	{
+		poChain->nCfgShadowValid &= (uint16_t)(~nGrpBit);
+		nDataBufLen = (uint32_t)((uint32_t)ADBMS6948_CMD_DATA_LEN + poChain->nCurrNoOfDevices * (uint32_t)ADBMS6948_REG_DATA_LEN_WITH_PEC);
+		nDataCfg = (((uint32_t)ADBMS6948_NUMOF_REGGRP_ONE << 16u) | (nDataBufLen));
+
+		/* Write the PWM register group */
+		Adbms6948_Cmd_ExecuteCmdWR(Adbms6948_kaPwmWrCmd[nPwmGrp], &pPwmCfg[0], knChainID);
+		/* Read the PWM register group and verify the register value, PEC and command count */
+		Adbms6948_Cmd_ExecuteCmdRD(&nCmd, aRdPwmData, nDataCfg, FALSE, knChainID);
+		for (nDeviceIndex = 0u; nDeviceIndex < poChain->nCurrNoOfDevices; nDeviceIndex++)
+		{
+			nRdPwmByteIndex = (uint32_t)ADBMS6948_CMD_DATA_LEN + ((uint32_t)nDeviceIndex * ADBMS6948_REG_DATA_LEN_WITH_PEC);
+			nWrPwmByteIndex = (uint32_t)nDeviceIndex * ADBMS6948_REG_GRP_LEN;
+			if (TRUE == Adbms6948_Cmn_ValidatePEC((uint8_t*)&aRdPwmData[0u][nRdPwmByteIndex], ADBMS6948_REG_DATA_LEN_WITH_PEC, nDeviceIndex, knChainID))
+			{
+				for (nLoopIdx = 0u; nLoopIdx < ADBMS6948_REG_GRP_LEN; nLoopIdx++)
+				{
+					if (aRdPwmData[0u][nRdPwmByteIndex + nLoopIdx] != pPwmCfg[nWrPwmByteIndex + nLoopIdx])
+					{
+						nRet = E_NOT_OK;
+					}
+				}
+			}
+			else
+			{
+				nRet = E_NOT_OK;
+			}
+		}
 
-	return nRet;
+		if (E_OK == nRet)
+		{
+			Adbms6948_Cmn_Memcpy(&poChain->aPwmShadow[nPwmGrp][0u], &pPwmCfg[0u], nGrpLen);
+			poChain->nCfgShadowValid |= nGrpBit;
+		}
+	}
+return (nRet);
 }
 
 /*!
@@ -935,6 +1109,7 @@ Adbms6948_ReturnType Adbms6948_Cmn_SoftReset
     /* Set the bFirstWakeup to TRUE so that the driver uses wait time for SLEEP
      state instead of STANDBY state*/
     Adbms6948_aoChainStateInfo[knChainID].bFirstWakeup = TRUE;
+    Adbms6948_aoChainStateInfo[knChainID].bCmdCntResync = TRUE;
 	return nRet;
 }
 
@@ -1200,51 +1375,41 @@ Adbms6948_ReturnType  Adbms6948_Cmn_ReadRegGroup
 	const uint8_t  	knChainID
 )
 {
-	Adbms6948_ReturnType  nRet = E_OK;
     uint8_t  aRdDataBuff[ADBMS6948_NUMOF_REGGRP_SIX][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)] = {0u};
-    uint8_t  nDevIdx, nGrpIdx, nRegGrpDataLen;
     uint32_t nDataCfg;
     uint32_t nDataBufLen;
-    uint16_t nDevStartIdx, nDevDataIdx;
-    boolean  bValidData;
+    Adbms6948_lRegGrpCtxType oRegGrpCtx;
 
     nDataBufLen = (uint32_t)((uint32_t)ADBMS6948_CMD_DATA_LEN + (uint32_t)(Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices * (uint32_t)ADBMS6948_REG_DATA_LEN_WITH_PEC));
     nDataCfg = (((uint32_t)nCmdLstLen << 16u) | (nDataBufLen));
-    /* Read the configuration of the chain */
-    Adbms6948_Cmd_ExecuteCmdRD(pnCmdLst, aRdDataBuff, nDataCfg, FALSE, knChainID);
 
-    for (nGrpIdx = 0u; nGrpIdx < nCmdLstLen; nGrpIdx++)
+    oRegGrpCtx.pRdDataBuff = aRdDataBuff;
+    oRegGrpCtx.pRxBuff = pRxBuff;
+    oRegGrpCtx.nRet = E_OK;
+    oRegGrpCtx.nChainID = knChainID;
+
+    /* Read the register groups, each group is validated as soon as it is received */
+    if (E_OK != Adbms6948_Cmd_ExecuteCmdRDPipelined(pnCmdLst, aRdDataBuff, nDataCfg, &Adbms6948_lValidateRegGrp, &oRegGrpCtx, knChainID))
     {
-		for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
-		{
-			nDevStartIdx = (uint16_t)((uint16_t)ADBMS6948_CMD_DATA_LEN + (nDevIdx * (uint16_t)ADBMS6948_REG_DATA_LEN_WITH_PEC));
-			bValidData = Adbms6948_Cmn_ValidatePEC((uint8_t*)&aRdDataBuff[nGrpIdx][nDevStartIdx],ADBMS6948_REG_DATA_LEN_WITH_PEC, nDevIdx, knChainID);
-			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
-			{
-				if (TRUE == bValidData)
-				{
-					for (nRegGrpDataLen = 0u; nRegGrpDataLen < ADBMS6948_REG_GRP_LEN; nRegGrpDataLen++)
-					{
-						nDevDataIdx = nDevStartIdx + nRegGrpDataLen;
-						pRxBuff[nGrpIdx][nDevDataIdx] = aRdDataBuff[nGrpIdx][nDevDataIdx];
-					}
-				}
-				else
-				{
-					nRet |= E_NOT_OK;
-				}
-			}
-		}
+        /* SPI transfer failed or timed out */
+        oRegGrpCtx.nRet = E_NOT_OK;
+        Adbms6948_Cmn_ReportRuntimeErr(Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_Platform_Error.nErrID,
+                ADBMS6948_RUNTIME_E_STATUS_FAILED);
     }
-return(nRet);
+
+return(oRegGrpCtx.nRet);
 }
 /*****************************************************************************/
 /*!
 	@brief			Common function to read register groups using "ALL" commands
 
+	The response of every device of the chain is read in one frame. The receive
+	buffer holds one slice per device, device 0 first, each slice being the data
+	followed by the PEC; the PEC and command counter of every slice are validated.
+
 	@param	[in]	nCmd        	"Read all" Command to use
-	@param	[in]	pRxBuf      	Pointer to the receive buffer
-	@param	[in]	nDataLenBytes   Number of bytes of data to read (including PEC)
+	@param	[in]	pRxBuf      	Pointer to the receive buffer, nDataLenBytes per device
+	@param	[in]	nDataLenBytes   Number of bytes of data to read of one device (including PEC)
 	@param	[in]	knChainID   	Specifies ID of the daisy chain on
 									which the operation is to be performed.
     @return 		E_OK: 			Success \n
@@ -1259,13 +1424,15 @@ Adbms6948_ReturnType  Adbms6948_Cmn_ReadAllRegGroups
 )
 {
 	Adbms6948_ReturnType  nRet = E_OK;
-	uint8_t  nDevIdx;
-	nDevIdx = 0;
+	boolean  abDevValid[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+	uint16_t  nFrameDataLen;
 	boolean  bValidData;
 
-	/* Read all the register groups from ADBMS6948 */
-	Adbms6948_Cmd_ExecuteCmdRDAll(pRxBuf, nCmd, nDataLenBytes, FALSE, knChainID);
-	bValidData = Adbms6948_Cmn_ValidatePEC(pRxBuf, nDataLenBytes, nDevIdx, knChainID);
+	nFrameDataLen = (uint16_t)((uint16_t)nDataLenBytes * (uint16_t)Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices);
+
+	/* Read all the register groups from every device of the chain */
+	Adbms6948_Cmd_ExecuteCmdRDAll(pRxBuf, nCmd, nFrameDataLen, FALSE, knChainID);
+	bValidData = Adbms6948_Cmn_ValidateFramePEC(pRxBuf, nDataLenBytes, &abDevValid[0], knChainID);
 	if (TRUE == bValidData)
 	{
 		nRet = E_OK;
@@ -1279,7 +1446,8 @@ return(nRet);
 }
 /*****************************************************************************/
 /*!
-    @brief	Common function to write one more register groups.
+    @brief	Common function to write one more register groups. The data of
+			the group in pTxBuff is written to every device of the chain.
 
     @param [out]	pnCmdLst	Array of write commands.
 								@range: NA
@@ -1310,13 +1478,17 @@ void  Adbms6948_Cmn_WriteRegGroup
 )
 {
 	uint8_t  aDataTxBuf[ADBMS6948_REG_GRP_LEN * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
-	uint8_t  nByteIdx;
+	uint8_t  nByteIdx, nDevIdx;
 	uint16_t  nSrcDataIdx, nDataIdx = 0u;
 
 	nSrcDataIdx = (uint16_t)ADBMS6948_CMD_DATA_LEN;
-	for (nByteIdx = 0u; nByteIdx < ADBMS6948_REG_GRP_LEN; nByteIdx++)
+	for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
 	{
-		aDataTxBuf[nDataIdx++] = pTxBuff[0u][nSrcDataIdx + nByteIdx];
+		/* Same data on every device, e.g. the flags cleared by CLRFLAG */
+		for (nByteIdx = 0u; nByteIdx < ADBMS6948_REG_GRP_LEN; nByteIdx++)
+		{
+			aDataTxBuf[nDataIdx++] = pTxBuff[0u][nSrcDataIdx + nByteIdx];
+		}
 	}
     Adbms6948_Cmd_ExecuteCmdCLR(pnCmdLst[0u], nDataLen, &aDataTxBuf[0u], knChainID);
 }
@@ -1661,6 +1833,300 @@ uint8_t   					 nDevIdx
     }
 }
 
+/*!
+    @brief  This function copies the shadow copy of a configuration register group for all the
+    devices on the chain. A stale shadow copy is first read from the devices; it becomes valid only
+    when the PEC and command counter of every device are valid.
+
+    @param  [in]   eCfgRegGrpSel  Configuration register group.
+
+    @param  [out]  pCfgData  Register group data of all devices, six bytes per device.
+
+    @param  [in]   knChainID  The daisy chain ID to perform the operation.
+
+    @return  E_OK: Operation was successful
+             E_NOT_OK: Operation failed
+*/
+static Adbms6948_ReturnType  Adbms6948_lReadCfgShadow
+(
+Adbms6948_ConfigGroupSelection  	 eCfgRegGrpSel,
+uint8_t 							*pCfgData,
+const uint8_t  						 knChainID
+)
+{
+	Adbms6948_ReturnType  nRet = E_OK;
+	Adbms6948_ChainStateInfoType  *poChain = &Adbms6948_aoChainStateInfo[knChainID];
+	uint8_t  aRdCfgData[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)] = {0u};
+	uint8_t  nDeviceIndex, nRdCfgByteIndex;
+	uint16_t  aCmdList[ADBMS6948_NUMOF_REGGRP_ONE];
+	uint16_t  nGrpBit = (uint16_t)((uint16_t)1u << (uint8_t)eCfgRegGrpSel);
+	uint32_t  nDataCfg;
+
+	if ((poChain->nCfgShadowValid & nGrpBit) == 0u)
+	{
+		nDataCfg = (((uint32_t)ADBMS6948_NUMOF_REGGRP_ONE << 16u) |
+		((uint32_t)ADBMS6948_CMD_DATA_LEN + ((uint32_t)poChain->nCurrNoOfDevices * (uint32_t)ADBMS6948_REG_DATA_LEN_WITH_PEC)));
+		aCmdList[0u] = Adbms6948_kaCfgRdCmd[eCfgRegGrpSel];
+		Adbms6948_Cmd_ExecuteCmdRD(aCmdList, aRdCfgData, nDataCfg, FALSE, knChainID);
+
+		for (nDeviceIndex = 0u; nDeviceIndex < poChain->nCurrNoOfDevices; nDeviceIndex++)
+		{
+			nRdCfgByteIndex = (uint8_t)(ADBMS6948_CMD_DATA_LEN + (uint8_t)(nDeviceIndex * ADBMS6948_REG_DATA_LEN_WITH_PEC));
+			if (TRUE == Adbms6948_Cmn_ValidatePEC(&aRdCfgData[0u][nRdCfgByteIndex], ADBMS6948_REG_DATA_LEN_WITH_PEC, nDeviceIndex, knChainID))
+			{
+				Adbms6948_Cmn_Memcpy(&poChain->aCfgShadow[eCfgRegGrpSel][nDeviceIndex * ADBMS6948_REG_GRP_LEN],
+				&aRdCfgData[0u][nRdCfgByteIndex], ADBMS6948_REG_GRP_LEN);
+			}
+			else
+			{
+				nRet = E_NOT_OK;
+			}
+		}
+		if (E_OK == nRet)
+		{
+			poChain->nCfgShadowValid |= nGrpBit;
+		}
+	}
+
+	if (E_OK == nRet)
+	{
+		Adbms6948_Cmn_Memcpy(pCfgData, &poChain->aCfgShadow[eCfgRegGrpSel][0u],
+		(uint32_t)poChain->nCurrNoOfDevices * ADBMS6948_REG_GRP_LEN);
+	}
+return (nRet);
+}
+
+/*!
+    @brief  This function writes a configuration register group to all the devices on the chain
+    and records it as the shadow copy. Every \ref ADBMS6948_CFG_VERIFY_PERIOD write is read back and
+    compared; the other writes are verified by the command counter of the next read, which a device
+    rejecting the write does not increment. A failed read back leaves the shadow copy stale.
+
+    @param  [in]  eCfgRegGrpSel  Configuration register group.
+
+    @param  [in]  pCfgData  Register group data of all devices, six bytes per device.
+
+    @param  [in]  knChainID  The daisy chain ID to perform the operation.
+
+    @return  E_OK: Operation was successful
+             E_NOT_OK: Operation failed
+*/
+static Adbms6948_ReturnType  Adbms6948_lWriteCfgShadow
+(
+Adbms6948_ConfigGroupSelection  	 eCfgRegGrpSel,
+uint8_t 							*pCfgData,
+const uint8_t  						 knChainID
+)
+{
+	Adbms6948_ReturnType  nRet = E_OK;
+	Adbms6948_ChainStateInfoType  *poChain = &Adbms6948_aoChainStateInfo[knChainID];
+	uint8_t  aRdCfgData[ADBMS6948_REG_GRP_LEN * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+	uint8_t  nByteIdx, nNoOfBytes;
+	uint16_t  nGrpBit = (uint16_t)((uint16_t)1u << (uint8_t)eCfgRegGrpSel);
+
+	/* Write the configuration to the chain */
+	Adbms6948_Cmd_ExecuteCmdWR(Adbms6948_kaCfgWrCmd[eCfgRegGrpSel], pCfgData, knChainID);
+	nNoOfBytes = (uint8_t)(poChain->nCurrNoOfDevices * ADBMS6948_REG_GRP_LEN);
+	Adbms6948_Cmn_Memcpy(&poChain->aCfgShadow[eCfgRegGrpSel][0u], pCfgData, nNoOfBytes);
+
+	poChain->nCfgWrVerifyCnt++;
+	if (poChain->nCfgWrVerifyCnt >= ADBMS6948_CFG_VERIFY_PERIOD)
+	{
+		/* Read the configuration register and verify contents along with PEC and command counter */
+		poChain->nCfgWrVerifyCnt = 0u;
+		poChain->nCfgShadowValid &= (uint16_t)(~nGrpBit);
+		nRet = Adbms6948_lReadCfgShadow(eCfgRegGrpSel, &aRdCfgData[0u], knChainID);
+		for (nByteIdx = 0u; (E_OK == nRet) && (nByteIdx < nNoOfBytes); nByteIdx++)
+		{
+			if (aRdCfgData[nByteIdx] != pCfgData[nByteIdx])
+			{
+				poChain->nCfgShadowValid &= (uint16_t)(~nGrpBit);
+				nRet = E_NOT_OK;
+			}
+		}
+	}
+return (nRet);
+}
+
+/*!
+    @brief  This function checks whether the chain still holds the configuration of the
+    initialization, e.g. after a reset of the host while the devices stayed powered. Configuration
+    register groups A, B and C are read in one transaction; the PEC of every device must be valid
+    and the groups must match the configuration, group A in the fields set by the initialization
+    only. The command counter is not known yet and is taken from the received data instead of
+    being checked. On a match the command counters are resynchronized and the shadow copy of the
+    groups is seeded, so the reset, the RSTCC and the calibration delay can be skipped.
+
+    @param  [in]  pCfgAData  Configuration register group A set by the initialization.
+
+    @param  [in]  pCfgBData  Configuration register group B set by the initialization.
+
+    @param  [in]  pCfgCData  Configuration register group C set by the initialization.
+
+    @param  [in]  nChainIndex  The daisy chain ID to perform the operation.
+
+    @return  TRUE: The chain is configured and was taken over
+             FALSE: The chain is to be reset and configured
+*/
+static boolean  Adbms6948_lWarmInitChain
+(
+uint8_t  	*pCfgAData,
+uint8_t  	*pCfgBData,
+uint8_t  	*pCfgCData,
+uint8_t  	 nChainIndex
+)
+{
+	Adbms6948_ChainStateInfoType  *poChain = &Adbms6948_aoChainStateInfo[nChainIndex];
+	uint8_t  aRdCfgData[ADBMS6948_NUMOF_REGGRP_THREE][ADBMS6948_MAX_FRAME_SIZE] = {0u};
+	uint16_t  anCmdList[ADBMS6948_NUMOF_REGGRP_THREE] = {ADBMS6948_CMD_RDCFGA, ADBMS6948_CMD_RDCFGB, ADBMS6948_CMD_RDCFGC};
+	uint8_t  *apCfgData[ADBMS6948_NUMOF_REGGRP_THREE];
+	boolean  abPecMatch[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+	uint8_t  aanCmdCnt[ADBMS6948_NUMOF_REGGRP_THREE][ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+	uint8_t  nGrpIdx, nDevIdx, nByteIdx, nMask, nRdByte;
+	uint32_t  nDataCfg;
+	boolean  bChainCfgd = TRUE;
+
+	apCfgData[0u] = pCfgAData;
+	apCfgData[1u] = pCfgBData;
+	apCfgData[2u] = pCfgCData;
+
+	nDataCfg = (((uint32_t)ADBMS6948_NUMOF_REGGRP_THREE << 16u) |
+	((uint32_t)ADBMS6948_CMD_DATA_LEN + ((uint32_t)poChain->nCurrNoOfDevices * (uint32_t)ADBMS6948_REG_DATA_LEN_WITH_PEC)));
+	Adbms6948_Cmd_ExecuteCmdRD(anCmdList, aRdCfgData, nDataCfg, FALSE, nChainIndex);
+
+	for (nGrpIdx = 0u; nGrpIdx < ADBMS6948_NUMOF_REGGRP_THREE; nGrpIdx++)
+	{
+		(void)Adbms6948_Pec10ValidateSlices(&aRdCfgData[nGrpIdx][ADBMS6948_CMD_DATA_LEN], ADBMS6948_REG_DATA_LEN_WITH_PEC,
+		poChain->nCurrNoOfDevices, &abPecMatch[0u], &aanCmdCnt[nGrpIdx][0u]);
+		for (nDevIdx = 0u; nDevIdx < poChain->nCurrNoOfDevices; nDevIdx++)
+		{
+			if (ADBMS6948_DEVICE == poChain->Adbms6948_eDevChain[nDevIdx])
+			{
+				/* Reads do not count, all groups carry the same command counter */
+				if ((FALSE == abPecMatch[nDevIdx]) || (aanCmdCnt[nGrpIdx][nDevIdx] != aanCmdCnt[0u][nDevIdx]))
+				{
+					bChainCfgd = FALSE;
+				}
+				for (nByteIdx = 0u; nByteIdx < ADBMS6948_REG_GRP_LEN; nByteIdx++)
+				{
+					nMask = (nGrpIdx == 0u) ? Adbms6948_kaWarmInitCfgAMask[nByteIdx] : 0xFFu;
+					nRdByte = aRdCfgData[nGrpIdx][ADBMS6948_CMD_DATA_LEN + (nDevIdx * ADBMS6948_REG_DATA_LEN_WITH_PEC) + nByteIdx];
+					if ((nRdByte & nMask) != (apCfgData[nGrpIdx][nByteIdx] & nMask))
+					{
+						bChainCfgd = FALSE;
+					}
+				}
+			}
+		}
+	}
+
+	if (TRUE == bChainCfgd)
+	{
+		for (nDevIdx = 0u; nDevIdx < poChain->nCurrNoOfDevices; nDevIdx++)
+		{
+			if (ADBMS6948_DEVICE == poChain->Adbms6948_eDevChain[nDevIdx])
+			{
+				/* Latch onto the command count set in the device */
+				poChain->nCmdCnt[nDevIdx] = aanCmdCnt[0u][nDevIdx];
+				poChain->aLastReadCCs[nDevIdx] = aanCmdCnt[0u][nDevIdx];
+			}
+			for (nGrpIdx = 0u; nGrpIdx < ADBMS6948_NUMOF_REGGRP_THREE; nGrpIdx++)
+			{
+				Adbms6948_Cmn_Memcpy(&poChain->aCfgShadow[nGrpIdx][nDevIdx * ADBMS6948_REG_GRP_LEN],
+				&aRdCfgData[nGrpIdx][ADBMS6948_CMD_DATA_LEN + (nDevIdx * ADBMS6948_REG_DATA_LEN_WITH_PEC)], ADBMS6948_REG_GRP_LEN);
+			}
+		}
+		poChain->nCfgShadowValid |= (uint16_t)((1u << ADBMS6948_CONFIG_GROUP_A) |
+		(1u << ADBMS6948_CONFIG_GROUP_B) | (1u << ADBMS6948_CONFIG_GROUP_C));
+	}
+return (bChainCfgd);
+}
+
+/*!
+    @brief  This function loads a configuration register group before a field update: the staged
+    fields while a configuration transaction is open, the shadow copy otherwise.
+
+    @param  [in]   eCfgRegGrpSel  Configuration register group.
+
+    @param  [out]  pCfgData  Register group data of all devices, six bytes per device.
+
+    @param  [in]   knChainID  The daisy chain ID to perform the operation.
+
+    @return  E_OK: Operation was successful
+             E_NOT_OK: Operation failed
+*/
+static Adbms6948_ReturnType  Adbms6948_lLoadCfg
+(
+Adbms6948_ConfigGroupSelection  	 eCfgRegGrpSel,
+uint8_t 							*pCfgData,
+const uint8_t  						 knChainID
+)
+{
+	Adbms6948_ReturnType  nRet = E_OK;
+	Adbms6948_ChainStateInfoType  *poChain = &Adbms6948_aoChainStateInfo[knChainID];
+
+	if (TRUE == poChain->bCfgTxnOpen)
+	{
+		Adbms6948_Cmn_Memcpy(pCfgData, &poChain->aCfgTxnData[eCfgRegGrpSel][0u],
+		(uint32_t)poChain->nCurrNoOfDevices * ADBMS6948_REG_GRP_LEN);
+	}
+	else
+	{
+		nRet = Adbms6948_lReadCfgShadow(eCfgRegGrpSel, pCfgData, knChainID);
+	}
+return (nRet);
+}
+
+/*!
+    @brief  This function stores a configuration register group after a field update: it stages
+    the updated registers while a configuration transaction is open and writes the group otherwise.
+
+    @param  [in]  eCfgRegGrpSel  Configuration register group.
+
+    @param  [in]  nRegId  First updated register in the group.
+
+    @param  [in]  aMask  Masks of the updated fields, one per register.
+
+    @param  [in]  nNoOfRegs  Number of updated registers.
+
+    @param  [in]  pCfgData  Register group data of all devices, six bytes per device.
+
+    @param  [in]  knChainID  The daisy chain ID to perform the operation.
+
+    @return  E_OK: Operation was successful
+             E_NOT_OK: Operation failed
+*/
+static Adbms6948_ReturnType  Adbms6948_lStoreCfg
+(
+Adbms6948_ConfigGroupSelection  	 eCfgRegGrpSel,
+uint8_t 							 nRegId,
+uint8_t 							 aMask[],
+uint8_t 							 nNoOfRegs,
+uint8_t 							*pCfgData,
+const uint8_t  						 knChainID
+)
+{
+	Adbms6948_ReturnType  nRet = E_OK;
+	Adbms6948_ChainStateInfoType  *poChain = &Adbms6948_aoChainStateInfo[knChainID];
+	uint8_t  nRegIdx;
+
+	if (TRUE == poChain->bCfgTxnOpen)
+	{
+		Adbms6948_Cmn_Memcpy(&poChain->aCfgTxnData[eCfgRegGrpSel][0u], pCfgData,
+		(uint32_t)poChain->nCurrNoOfDevices * ADBMS6948_REG_GRP_LEN);
+		for (nRegIdx = 0u; nRegIdx < nNoOfRegs; nRegIdx++)
+		{
+			poChain->aCfgTxnMask[eCfgRegGrpSel][nRegId + nRegIdx] |= aMask[nRegIdx];
+		}
+		poChain->nCfgTxnDirty |= (uint16_t)((uint16_t)1u << (uint8_t)eCfgRegGrpSel);
+	}
+	else
+	{
+		nRet = Adbms6948_lWriteCfgShadow(eCfgRegGrpSel, pCfgData, knChainID);
+	}
+return (nRet);
+}
+
 /*TODO: Remove this code if not to be used*/
 #if 0
 /*!
@@ -2102,6 +2568,120 @@ uint8_t anFCOMM[]
     }
     return nFCOMMStat;
 }
+
+/*!
+    @brief  This function updates the PEC and command counter state of a device after its read data
+    was checked, and reports the runtime errors in the case of PEC or command counter mismatch.
+
+    @param  [in]  bPecMatch  TRUE if the received PEC matches the computed PEC.
+
+    @param  [in]  nCmdCntRcvd  Command counter received in the PEC word.
+
+    @param  [in]  nDeviceId  Device number in chain.
+
+    @param  [in]  knChainID  The Id of the daisy chain on which the operation is done.
+
+    @return  TRUE: PEC valid
+             FALSE: PEC invalid
+*/
+static boolean  Adbms6948_lUpdatePecStatus
+(
+boolean  	 bPecMatch,
+uint8_t  	 nCmdCntRcvd,
+uint8_t  	 nDeviceId,
+uint8_t  	 knChainID
+)
+{
+    boolean  bIsPecValid = TRUE;
+
+    /* Set the PEC error to FALSE in the state variable */
+    Adbms6948_aoChainStateInfo[knChainID].aLastReadPecEr[nDeviceId] = (boolean)FALSE;
+    if (FALSE == bPecMatch)
+    {
+    	if (Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDeviceId] == ADBMS6948_DEVICE)
+    	{
+    		bIsPecValid = FALSE;
+    		Adbms6948_aoChainStateInfo[knChainID].nPECError[nDeviceId]++;
+    		Adbms6948_aoChainStateInfo[knChainID].bCmdCntResync = TRUE;
+    		if (TRUE == Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_Invalid_PEC.nState)
+    		{
+    			Adbms6948_Cmn_ReportRuntimeErr(
+                    Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_Invalid_PEC.nErrID,
+					ADBMS6948_RUNTIME_E_STATUS_FAILED);
+    		}
+    	}
+    	/* Set the PEC error to TRUE in the state variable */
+    	Adbms6948_aoChainStateInfo[knChainID].aLastReadPecEr[nDeviceId] = (boolean)TRUE;
+    }
+    else
+    {
+    	if (Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDeviceId] == ADBMS6948_DEVICE)
+    	{
+			if (nCmdCntRcvd != Adbms6948_aoChainStateInfo[knChainID].nCmdCnt[nDeviceId])
+			{
+				bIsPecValid = FALSE;
+				Adbms6948_aoChainStateInfo[knChainID].nCmdCntError[nDeviceId]++;
+				Adbms6948_aoChainStateInfo[knChainID].bCmdCntResync = TRUE;
+				/* The device missed or saw other commands, it may hold another configuration */
+				Adbms6948_aoChainStateInfo[knChainID].nCfgShadowValid = 0u;
+				/* Latch onto the command count set in the device */
+				Adbms6948_aoChainStateInfo[knChainID].nCmdCnt[nDeviceId] = (uint8_t)nCmdCntRcvd;
+				if (TRUE == Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_CommandCount.nState)
+				{
+					Adbms6948_Cmn_ReportRuntimeErr(
+						  Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_CommandCount.nErrID,
+						  ADBMS6948_RUNTIME_E_STATUS_FAILED);
+				}
+			}
+    	}
+    	Adbms6948_aoChainStateInfo[knChainID].aLastReadCCs[nDeviceId] = (uint8_t)nCmdCntRcvd;
+	}
+return (bIsPecValid);
+}
+
+/*!
+    @brief  This function validates the PEC and command counter of every device in a received
+    register group and copies the data of the valid devices to the caller's buffer.
+
+    @param  [in]  nGrpIdx  Index of the received register group.
+
+    @param  [in]  pContext  Pointer to the validation context, \ref Adbms6948_lRegGrpCtxType.
+
+    @return  None.
+*/
+static void  Adbms6948_lValidateRegGrp
+(
+uint8_t  	 nGrpIdx,
+void 		*pContext
+)
+{
+    Adbms6948_lRegGrpCtxType *poCtx = (Adbms6948_lRegGrpCtxType *)pContext;
+    uint8_t  nDevIdx, nRegGrpDataLen;
+    uint16_t nDevStartIdx, nDevDataIdx;
+    boolean  abValidData[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+
+    (void)Adbms6948_Cmn_ValidateFramePEC((uint8_t*)&poCtx->pRdDataBuff[nGrpIdx][ADBMS6948_CMD_DATA_LEN], ADBMS6948_REG_DATA_LEN_WITH_PEC,
+                                         &abValidData[0], poCtx->nChainID);
+    for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[poCtx->nChainID].nCurrNoOfDevices; nDevIdx++)
+    {
+        nDevStartIdx = (uint16_t)((uint16_t)ADBMS6948_CMD_DATA_LEN + (nDevIdx * (uint16_t)ADBMS6948_REG_DATA_LEN_WITH_PEC));
+        if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[poCtx->nChainID].Adbms6948_eDevChain[nDevIdx])
+        {
+            if (TRUE == abValidData[nDevIdx])
+            {
+                for (nRegGrpDataLen = 0u; nRegGrpDataLen < ADBMS6948_REG_GRP_LEN; nRegGrpDataLen++)
+                {
+                    nDevDataIdx = nDevStartIdx + nRegGrpDataLen;
+                    poCtx->pRxBuff[nGrpIdx][nDevDataIdx] = poCtx->pRdDataBuff[nGrpIdx][nDevDataIdx];
+                }
+            }
+            else
+            {
+                poCtx->nRet |= E_NOT_OK;
+            }
+        }
+    }
+}
 /* End of code section */
 /* Code section stop */
 ADBMS6948_DRV_CODE_STOP
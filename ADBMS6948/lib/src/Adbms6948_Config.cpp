@@ -53,6 +53,12 @@ static void  Adbms6948_lPrepareChain
 const uint8_t 				knChainID
 );
 
+static boolean  Adbms6948_lIsInvalidPwmDuty
+(
+Adbms6948_PwmDutyCfgType *	pPwmDuty,
+const uint8_t 				knChainID
+);
+
 static Adbms6948_ReturnType Adbms6948_lCfgOC1Params
 (
     Adbms6948_OC1CfgType    *poOC1CfgType,
@@ -147,7 +153,7 @@ const Adbms6948_CfgType 	*pkConfig
 			Adbms6948_lPrepareChain(nChainIndex);
 
 			/* Initialization is enabled for the chain.*/
-			nRet |= Adbms6948_Cmn_InitChain(nChainIndex);
+			nRet |= Adbms6948_Cmn_InitChain(nChainIndex, FALSE);
 			if (E_OK != nRet)
 			{
 				/* Chain initialization is failed for the chain. Stop the service. */
@@ -788,6 +794,117 @@ return (nRet);
 
 }
 
+/*****************************************************************************/
+/*!
+    @brief      This internal interface sets the PWM discharge duty cycle of
+				every cell. PWM register groups A and B are packed from the
+				duty cycles and only the groups that differ from the last
+				written values are written and read back. The groups are not
+				staged by a configuration transaction. \n
+
+    @param 	[in]    pPwmDuty  		Pointer to the duty cycles, 16 cells per
+									ADBMS6948 device in chain order, other
+									devices skipped as in the cell data.
+									@range: 0 to ADBMS6948_PWM_DUTY_MAX
+									@resolution: 1/15 of the PWM period
+
+    @param	[in]   	knChainID	    Specifies ID of the daisy chain on
+									which the operation is to be performed.
+									@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+									@resolution: NA
+
+    @return        E_OK: 		Success \n
+                   E_NOT_OK: 	Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_Int_CfgPwmDischarge
+(
+Adbms6948_PwmDutyCfgType 		*pPwmDuty,
+const uint8_t  					 knChainID
+)
+{
+	Adbms6948_ReturnType  	nRet = E_NOT_OK;
+	uint8_t 			aPwmA[ADBMS6948_REG_GRP_LEN * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN] = {0};
+	uint8_t 			aPwmB[ADBMS6948_REG_GRP_LEN * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN] = {0};
+	Adbms6948_PwmDutyCfgType	*pDevDuty = pPwmDuty;
+	uint8_t 			nNoOfDevInChain,nDevIdx,nByteIdx;
+
+	if (ADBMS6948_ST_UNINIT == Adbms6948_eState)
+	{
+		/* Module is not initialized. */
+		#if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID,
+		ADBMS6948_CFGPWMDISCHARGCTRL_ID, ADBMS6948_E_MODULESTATE);
+		#endif
+	}
+	else if ((NULL_PTR == pPwmDuty) || (ADBMS6948_NO_OF_DAISY_CHAIN <= knChainID))
+	{
+		/* Null pointer error. */
+		#if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID,
+		ADBMS6948_CFGPWMDISCHARGCTRL_ID, ADBMS6948_E_INVALID_PARAM);
+		#endif
+	}
+	else if (TRUE == Adbms6948_lIsInvalidPwmDuty(pPwmDuty, knChainID))
+	{
+		/* Duty cycle out of range. */
+		#if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID,
+		ADBMS6948_CFGPWMDISCHARGCTRL_ID, ADBMS6948_E_INVALID_PARAM);
+		#endif
+	}
+	else if (E_NOT_OK == Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_BUSY, knChainID))
+	{
+		/* Chain busy error. */
+		#if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID,
+		ADBMS6948_CFGPWMDISCHARGCTRL_ID, ADBMS6948_E_CHAIN_BUSY);
+		#endif
+	}
+	else
+	{
+		/* Pack four bits per cell, cells 1 to 12 into PWM A and cells 13 to 16 into PWM B. */
+		nNoOfDevInChain = Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices;
+		for (nDevIdx = 0u; nDevIdx < nNoOfDevInChain; nDevIdx++)
+		{
+			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+			{
+				for (nByteIdx = 0u; nByteIdx < ADBMS6948_REG_GRP_LEN; nByteIdx++)
+				{
+					aPwmA[(nDevIdx * ADBMS6948_REG_GRP_LEN) + nByteIdx] =
+					(uint8_t)(pDevDuty[2u * nByteIdx] | (uint8_t)(pDevDuty[(2u * nByteIdx) + 1u] << 4u));
+				}
+				for (nByteIdx = 0u; nByteIdx < 2u; nByteIdx++)
+				{
+					aPwmB[(nDevIdx * ADBMS6948_REG_GRP_LEN) + nByteIdx] =
+					(uint8_t)(pDevDuty[12u + (2u * nByteIdx)] | (uint8_t)(pDevDuty[13u + (2u * nByteIdx)] << 4u));
+				}
+				/* Duty cycles of the next ADBMS6948 device. */
+				pDevDuty = &pDevDuty[ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE];
+			}
+		}
+
+		/* Write the changed PWM register groups over SPI. */
+		nRet = Adbms6948_Cmn_PwmDischarge(&aPwmA[0], &aPwmB[0], knChainID);
+
+		if (E_OK == nRet)
+		{
+			/* Perform platform error check. */
+			if (TRUE == Adbms6948_Cmn_IsError(knChainID))
+			{
+				/* Platform error. */
+				nRet = E_NOT_OK;
+				Adbms6948_Cmn_ReportRuntimeErr(Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_Platform_Error.nErrID,
+						ADBMS6948_RUNTIME_E_STATUS_FAILED);
+			}
+		}
+
+		/* Set chain state to IDLE. */
+		nRet |= Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_IDLE, knChainID);
+	}
+return (nRet);
+}
+
 /*****************************************************************************/
 /*!
     @brief      This internal interface sets pull-down ON/OFF for the particular
@@ -907,7 +1024,8 @@ Adbms6948_ReturnType Adbms6948_Int_CfgCoulombCounter
 {
     Adbms6948_ReturnType    nRet = E_NOT_OK;
     uint8_t                 aMask[2u];
-    uint8_t                 nCfgCReg01[2u];
+    uint8_t                 nCfgCReg01[2u * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+    uint8_t                 nDevIdx;
 
     if (ADBMS6948_ST_UNINIT == Adbms6948_eState)
     {
@@ -932,9 +1050,12 @@ Adbms6948_ReturnType Adbms6948_Int_CfgCoulombCounter
     }
     else
     {
-        /* Prepare config C register 0(TCC[7:0]) and 1(TCC[11:8]) value. */
-        nCfgCReg01[0u] = (uint8_t)((uint8_t)(pnNumConversions[0u] & 0x00FFu));
-        nCfgCReg01[1u] = (uint8_t)(((pnNumConversions[0u] & 0xFF00u)) >> 8u);
+        /* Prepare config C register 0(TCC[7:0]) and 1(TCC[15:8]) value, the same for every device. */
+        for (nDevIdx = 0u; nDevIdx < ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN; nDevIdx++)
+        {
+            nCfgCReg01[(nDevIdx*2u)] = (uint8_t)((uint8_t)(pnNumConversions[0u] & 0x00FFu));
+            nCfgCReg01[(nDevIdx*2u)+1u] = (uint8_t)(((pnNumConversions[0u] & 0xFF00u)) >> 8u);
+        }
 
         aMask[0u] = ADBMS6948_CFGCR0_MASK_TCC_LSB;
         aMask[1u] = ADBMS6948_CFGCR0_MASK_TCC_MSB;
@@ -1096,6 +1217,347 @@ Adbms6948_ReturnType  Adbms6948_Int_CfgOC2Params
     }
 return (nRet);
 }
+
+/*****************************************************************************/
+/*!
+    @brief          This interface checks whether the daisy chain still holds
+                    the configuration applied during initialization. A single
+                    RDCFGA is issued; the PEC and command counter of every
+                    device are validated and the REFON bit is compared against
+                    the configured value. A device which was reset or went to
+                    sleep fails this check.
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+    @return        E_OK:        Chain is configured \n
+                   E_NOT_OK:    Chain needs to be re-initialized \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_Int_CheckChainCfg
+(
+    const uint8_t           knChainID
+)
+{
+    Adbms6948_ReturnType    nRet = E_NOT_OK;
+    uint8_t                 aRdCfgData[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN +
+                            (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)] = {0u};
+    uint16_t                anCmdList[ADBMS6948_NUMOF_REGGRP_ONE];
+    uint8_t                 nNoOfDevInChain, nDevIdx, nRefOn;
+    uint16_t                nDevStartIdx;
+    if (ADBMS6948_ST_UNINIT == Adbms6948_eState)
+    {
+        /* Module is not initialized. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CHECKCHAINCFG_ID, ADBMS6948_E_MODULESTATE);
+        #endif
+    }
+    else if (ADBMS6948_NO_OF_DAISY_CHAIN <= knChainID)
+    {
+        /* Invalid parameter error. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CHECKCHAINCFG_ID, ADBMS6948_E_INVALID_PARAM);
+        #endif
+    }
+    else if (E_NOT_OK == Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_BUSY, knChainID))
+    {
+        /* Chain busy error. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CHECKCHAINCFG_ID, ADBMS6948_E_CHAIN_BUSY);
+        #endif
+    }
+    else
+    {
+        /* Wakeup the chain, a chain which was asleep fails the read below. */
+        Adbms6948_Cmn_WakeUpBmsIC(knChainID);
+
+        /* Read configuration register group A, PEC and command counter are verified per device. */
+        anCmdList[0u] = ADBMS6948_CMD_RDCFGA;
+        nRet = Adbms6948_Cmn_ReadRegGroup(anCmdList, aRdCfgData, ADBMS6948_NUMOF_REGGRP_ONE, knChainID);
+        if (E_OK == nRet)
+        {
+            /* REFON is cleared by a reset, compare it against the configured value. */
+            nRefOn = (uint8_t)((uint8_t)Adbms6948_pDaisyChainCfgInput[knChainID].Adbms6948_bEnableRefOn << ADBMS6948_CFGAR0_POS_REFON);
+            nNoOfDevInChain = Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices;
+            for (nDevIdx = 0u; nDevIdx < nNoOfDevInChain; nDevIdx++)
+            {
+                if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+                {
+                    nDevStartIdx = (uint16_t)((uint16_t)ADBMS6948_CMD_DATA_LEN + (nDevIdx * (uint16_t)ADBMS6948_REG_DATA_LEN_WITH_PEC));
+                    if ((aRdCfgData[0u][nDevStartIdx] & ADBMS6948_CFGAR0_MASK_REFON) != nRefOn)
+                    {
+                        nRet = E_NOT_OK;
+                        break;
+                    }
+                }
+            }
+        }
+        if (E_OK == nRet)
+        {
+            /* Perform platform error check. */
+            if (TRUE == Adbms6948_Cmn_IsError(knChainID))
+            {
+                /* Platform error. */
+                nRet = E_NOT_OK;
+                Adbms6948_Cmn_ReportRuntimeErr(Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_Platform_Error.nErrID, ADBMS6948_RUNTIME_E_STATUS_FAILED);
+            }
+        }
+
+        /*Set chain state to IDLE. */
+        nRet |= Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_IDLE, knChainID);
+    }
+return (nRet);
+}
+
+/*****************************************************************************/
+/*!
+    @brief          This interface re-initializes one daisy chain of the
+                    initialized module without a soft reset. The chain is
+                    taken over when it still holds the configuration, as with
+                    Adbms6948_bWarmInit; otherwise the command counter is
+                    cleared and the configuration written again. The other
+                    chains are not accessed.
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+    @return        E_OK:        Chain is configured \n
+                   E_NOT_OK:    Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_Int_ReInitChain
+(
+    const uint8_t           knChainID
+)
+{
+    Adbms6948_ReturnType    nRet = E_NOT_OK;
+
+    if (ADBMS6948_ST_UNINIT == Adbms6948_eState)
+    {
+        /* Module is not initialized. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_REINITCHAIN_ID, ADBMS6948_E_MODULESTATE);
+        #endif
+    }
+    else if (ADBMS6948_NO_OF_DAISY_CHAIN <= knChainID)
+    {
+        /* Invalid parameter error. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_REINITCHAIN_ID, ADBMS6948_E_INVALID_PARAM);
+        #endif
+    }
+    else if (E_NOT_OK == Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_BUSY, knChainID))
+    {
+        /* Chain busy error. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_REINITCHAIN_ID, ADBMS6948_E_CHAIN_BUSY);
+        #endif
+    }
+    else
+    {
+        /* Clear the state information of the chain, it stays busy until initialized */
+        (void) Adbms6948_Cmn_Memset((uint8_t*)&Adbms6948_aoChainStateInfo[knChainID], 0,
+            sizeof(Adbms6948_ChainStateInfoType));
+        Adbms6948_aoChainStateInfo[knChainID].eChainState = ADBMS6948_ST_CHAIN_BUSY;
+
+        /* Prepare chain of Adbms6948 and non-Adbms6948 devices */
+        Adbms6948_lPrepareChain(knChainID);
+
+        /* Sets the chain state to IDLE on success */
+        nRet = Adbms6948_Cmn_InitChain(knChainID, TRUE);
+        if (E_OK != nRet)
+        {
+            /* The chain can be re-initialized again */
+            (void) Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_IDLE, knChainID);
+        }
+    }
+return (nRet);
+}
+
+/*****************************************************************************/
+/*!
+    @brief          This interface opens a configuration transaction. The
+                    configuration interfaces called until the transaction is
+                    committed stage their fields instead of writing them. \n
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+
+    @return        E_OK:        Success \n
+                   E_NOT_OK:    Failure, e.g. a transaction is already open \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_Int_CfgBegin
+(
+    const uint8_t           knChainID
+)
+{
+    Adbms6948_ReturnType    nRet = E_NOT_OK;
+    if (ADBMS6948_ST_UNINIT == Adbms6948_eState)
+    {
+        /* Module is not initialized. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGBEGIN_ID, ADBMS6948_E_MODULESTATE);
+        #endif
+    }
+    else if (ADBMS6948_NO_OF_DAISY_CHAIN <= knChainID)
+    {
+        /* Invalid parameter error. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGBEGIN_ID, ADBMS6948_E_INVALID_PARAM);
+        #endif
+    }
+    else if (TRUE == Adbms6948_aoChainStateInfo[knChainID].bCfgTxnOpen)
+    {
+        /* Transaction already open or not open. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGBEGIN_ID, ADBMS6948_E_MODULESTATE);
+        #endif
+    }
+    else if (E_NOT_OK == Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_BUSY, knChainID))
+    {
+        /* Chain busy error. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGBEGIN_ID, ADBMS6948_E_CHAIN_BUSY);
+        #endif
+    }
+    else
+    {
+        Adbms6948_Cmn_BeginCfgTxn(knChainID);
+
+        /*Set chain state to IDLE. */
+        nRet = Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_IDLE, knChainID);
+    }
+return (nRet);
+}
+
+/*****************************************************************************/
+/*!
+    @brief          This interface commits a configuration transaction. Each
+                    configuration register group with staged fields is written
+                    once and all of them are verified with one read of the
+                    register groups. \n
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+
+    @return        E_OK:        Success \n
+                   E_NOT_OK:    Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_Int_CfgCommit
+(
+    const uint8_t           knChainID
+)
+{
+    Adbms6948_ReturnType    nRet = E_NOT_OK;
+    if (ADBMS6948_ST_UNINIT == Adbms6948_eState)
+    {
+        /* Module is not initialized. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGCOMMIT_ID, ADBMS6948_E_MODULESTATE);
+        #endif
+    }
+    else if (ADBMS6948_NO_OF_DAISY_CHAIN <= knChainID)
+    {
+        /* Invalid parameter error. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGCOMMIT_ID, ADBMS6948_E_INVALID_PARAM);
+        #endif
+    }
+    else if (FALSE == Adbms6948_aoChainStateInfo[knChainID].bCfgTxnOpen)
+    {
+        /* Transaction already open or not open. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGCOMMIT_ID, ADBMS6948_E_MODULESTATE);
+        #endif
+    }
+    else if (E_NOT_OK == Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_BUSY, knChainID))
+    {
+        /* Chain busy error. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGCOMMIT_ID, ADBMS6948_E_CHAIN_BUSY);
+        #endif
+    }
+    else
+    {
+        nRet = Adbms6948_Cmn_CommitCfgTxn(knChainID);
+
+        if (E_OK == nRet)
+        {
+            /* Perform platform error check. */
+            if (TRUE == Adbms6948_Cmn_IsError(knChainID))
+            {
+                /* Platform error. */
+                nRet = E_NOT_OK;
+                Adbms6948_Cmn_ReportRuntimeErr(Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_Platform_Error.nErrID, ADBMS6948_RUNTIME_E_STATUS_FAILED);
+            }
+        }
+
+        /*Set chain state to IDLE. */
+        nRet |= Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_IDLE, knChainID);
+    }
+return (nRet);
+}
+
+/*****************************************************************************/
+/*!
+    @brief          This interface aborts a configuration transaction and
+                    discards the staged fields. \n
+    @param  [in]    knChainID       Specifies ID of the daisy chain on
+                                    which the operation is to be performed.
+                                    @range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+                                    @resolution: NA
+
+    @return        E_OK:        Success \n
+                   E_NOT_OK:    Failure, e.g. no transaction is open \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_Int_CfgAbort
+(
+    const uint8_t           knChainID
+)
+{
+    Adbms6948_ReturnType    nRet = E_NOT_OK;
+    if (ADBMS6948_ST_UNINIT == Adbms6948_eState)
+    {
+        /* Module is not initialized. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGABORT_ID, ADBMS6948_E_MODULESTATE);
+        #endif
+    }
+    else if (ADBMS6948_NO_OF_DAISY_CHAIN <= knChainID)
+    {
+        /* Invalid parameter error. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGABORT_ID, ADBMS6948_E_INVALID_PARAM);
+        #endif
+    }
+    else if (FALSE == Adbms6948_aoChainStateInfo[knChainID].bCfgTxnOpen)
+    {
+        /* Transaction already open or not open. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGABORT_ID, ADBMS6948_E_MODULESTATE);
+        #endif
+    }
+    else if (E_NOT_OK == Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_BUSY, knChainID))
+    {
+        /* Chain busy error. */
+        #if (ADBMS6948_DEVELOPMENT_MODE_EN == TRUE)
+        Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CFGABORT_ID, ADBMS6948_E_CHAIN_BUSY);
+        #endif
+    }
+    else
+    {
+        Adbms6948_Cmn_AbortCfgTxn(knChainID);
+
+        /*Set chain state to IDLE. */
+        nRet = Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_IDLE, knChainID);
+    }
+return (nRet);
+}
 /*! @}*/
 
 /*! @}*/
@@ -1172,6 +1634,43 @@ static void  Adbms6948_lPrepareChain
 	}
 }
 
+/*!
+    @brief  This function validates the PWM discharge duty cycles of a chain.
+
+    @param  [in]   pPwmDuty         Duty cycles, 16 cells per ADBMS6948 device in chain order.
+
+    @param  [in]   knChainID        Chain Id
+
+    @return    True : A duty cycle of an ADBMS6948 device is out of range. \n
+               False: Valid duty cycles. \n
+*/
+static boolean  Adbms6948_lIsInvalidPwmDuty
+(
+    Adbms6948_PwmDutyCfgType *	pPwmDuty,
+    const uint8_t 				knChainID
+)
+{
+	boolean  bRet = FALSE;
+	uint16_t nBufIdx = 0u;
+	uint8_t  nDevIdx,nCellIdx;
+
+	for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
+	{
+		if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+		{
+			for (nCellIdx = 0u; nCellIdx < ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE; nCellIdx++)
+			{
+				if (pPwmDuty[nBufIdx] > ADBMS6948_PWM_DUTY_MAX)
+				{
+					bRet = TRUE;
+				}
+				nBufIdx++;
+			}
+		}
+	}
+return bRet;
+}
+
 /*!
     @brief  This checks if any of the chain is in busy state.
 
@@ -1226,7 +1725,7 @@ static Adbms6948_ReturnType Adbms6948_lCfgOC1Params
 	uint8_t  nCfgDData[ADBMS6948_REG_GRP_LEN] = {0};
 	uint8_t  nCfgEData[ADBMS6948_REG_GRP_LEN] = {0};
 	uint8_t  nCfgFData[ADBMS6948_REG_GRP_LEN] = {0};
-    uint8_t anReadDataBuf[ADBMS6948_REG_DATA_LEN_WITH_PEC] = {0};
+    uint8_t anReadDataBuf[ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN] = {0};
 
     /* Prepare config D register values. */
     nCfgDData[0] =  ((poOC1CfgType->Adbms6948_nCyclesW1 & 0x1F) << ADBMS6948_CFGDR0_POS_CYCLES_W1) |
@@ -1253,6 +1752,9 @@ static Adbms6948_ReturnType Adbms6948_lCfgOC1Params
         nCfgFData[i] = poOC1CfgType->Adbms6948_panOC1Thresh[i] & 0xFF;
     }
 
+    /* Configuration D, E and F are written directly, drop their shadow copies */
+    Adbms6948_Cmn_InvalidateCfgShadow((uint16_t)((1u << ADBMS6948_CONFIG_GROUP_D) |
+    (1u << ADBMS6948_CONFIG_GROUP_E) | (1u << ADBMS6948_CONFIG_GROUP_F)), knChainID);
     /* Write the configuration D to the device */
     Adbms6948_Cmd_ExecuteCmdWR(ADBMS6948_CMD_WRCFGD, &nCfgDData[0], knChainID);
     /* Write the configuration E to the device */
@@ -1337,7 +1839,7 @@ static Adbms6948_ReturnType Adbms6948_lCfgOC2Params
 	uint8_t  nCfgGData[ADBMS6948_REG_GRP_LEN] = {0};
 	uint8_t  nCfgHData[ADBMS6948_REG_GRP_LEN] = {0};
 	uint8_t  nCfgIData[ADBMS6948_REG_GRP_LEN] = {0};
-    uint8_t  anReadDataBuf[ADBMS6948_REG_DATA_LEN_WITH_PEC] = {0};
+    uint8_t  anReadDataBuf[ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN] = {0};
 
     /* Prepare config G register values. */
     for(int i = 0; i < ADBMS6948_REG_GRP_LEN; ++i)
@@ -1358,6 +1860,9 @@ static Adbms6948_ReturnType Adbms6948_lCfgOC2Params
     nCfgIData[2] = STATUS_CFG_VAL & 0xFF;
     nCfgIData[3] = poOC2CfgType->Adbms6948_nGainCtrl2 & 0xFF;
 
+    /* Configuration G, H and I are written directly, drop their shadow copies */
+    Adbms6948_Cmn_InvalidateCfgShadow((uint16_t)((1u << ADBMS6948_CONFIG_GROUP_G) |
+    (1u << ADBMS6948_CONFIG_GROUP_H) | (1u << ADBMS6948_CONFIG_GROUP_I)), knChainID);
     /* Write the configuration G to the device */
     Adbms6948_Cmd_ExecuteCmdWR(ADBMS6948_CMD_WRCFGG, &nCfgGData[0], knChainID);
     /* Write the configuration H to the device */
@@ -28,6 +28,21 @@ static void  Adbms6948_lIncCmdCntAllDev
 const uint8_t  knChainID
 );
 
+static void  Adbms6948_lPrepRdTxBuf
+(
+uint16_t 	*pnCmdLst,
+uint8_t      pTxBuf[][ADBMS6948_MAX_FRAME_SIZE],
+uint16_t     nRegGroups,
+uint16_t     nGroupDataLen
+);
+
+#if (ADBMS6948_SPI_ASYNC_EN == TRUE)
+static Adbms6948_ReturnType  Adbms6948_lWaitSpiTransfer
+(
+const uint8_t  knChainID
+);
+#endif
+
 /*============= C O D E =============*/
 /* Start of code section */
 /* Code section start */
@@ -67,8 +82,8 @@ const uint8_t   knChainID
 
     aCmd[0] = (uint8_t)((nCommand & 0xFF00u) >> ADBMS6948_SHIFT_BY_8);
     aCmd[1] = (uint8_t)((nCommand & 0x00FFu));
-    /* Calculate the 15-bit PEC for the command bytes */
-    nCmdPec = (uint16_t)Adbms6948_Pec15Calculate(&aCmd[0], 2u);
+    /* Look up the 15-bit PEC of the command */
+    nCmdPec = Adbms6948_Pec15Command(nCommand);
     /* Append the PEC to the command buffer */
     aCmd[2] = (uint8_t)(nCmdPec >> ADBMS6948_SHIFT_BY_8);
     aCmd[3] = (uint8_t)(nCmdPec);
@@ -91,6 +106,11 @@ const uint8_t   knChainID
          * chain */
         Adbms6948_lIncCmdCntAllDev(knChainID);
     }
+    /* A soft reset restores the default configuration, the shadow copy is stale */
+    if (nCommand == ADBMS6948_CMD_SRST)
+    {
+        Adbms6948_Cmn_InvalidateCfgShadow(ADBMS6948_CFG_SHADOW_ALL_GRPS, knChainID);
+    }
     /* Is the command to be sent RSTCC */
     if (nCommand == ADBMS6948_CMD_RSTCC)
     {
@@ -140,8 +160,8 @@ void Adbms6948_Cmd_ExecuteCmdCLR
 
     aTxBuf[nLen++] = (uint8_t)((uint16_t)(nCommand & (uint16_t)0xFF00U) >> 8U);
     aTxBuf[nLen++] = (uint8_t)(nCommand & (uint16_t)0x00FFU);
-    /* Calculate the 15-bit PEC for the command bytes */
-    nCmdPec = (uint16_t)Adbms6948_Pec15Calculate(&aTxBuf[0], 2u);
+    /* Look up the 15-bit PEC of the command */
+    nCmdPec = Adbms6948_Pec15Command(nCommand);
     /* Append the command PEC to the transmit buffer */
     aTxBuf[nLen++] = (uint8_t)(nCmdPec >> 8U);
     aTxBuf[nLen++] = (uint8_t)(nCmdPec);
@@ -201,8 +221,8 @@ void  Adbms6948_Cmd_ExecuteCmdWR
 
     aTxBuf[nLen++] = (uint8_t)((uint16_t)(nCommand & (uint16_t)0xFF00U) >> 8U);
     aTxBuf[nLen++] = (uint8_t)(nCommand & (uint16_t)0x00FFU);
-    /* Calculate the 15-bit PEC for the command bytes */
-    nCmdPec = (uint16_t)Adbms6948_Pec15Calculate(&aTxBuf[0], 2u);
+    /* Look up the 15-bit PEC of the command */
+    nCmdPec = Adbms6948_Pec15Command(nCommand);
     /* Append the command PEC to the transmit buffer */
     aTxBuf[nLen++] = (uint8_t)(nCmdPec >> 8U);
     aTxBuf[nLen++] = (uint8_t)(nCmdPec);
@@ -262,32 +282,11 @@ void  Adbms6948_Cmd_ExecuteCmdRD
 )
 {
     uint8_t   aTxBuf[ADBMS6948_CMD_MAX_RX_FRAMES][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)];
-    uint16_t  nCmdPec;
     uint16_t  nRegGroups, nGroupDataLen;
-    uint16_t   nGrpIdx, nGrpDataIdx;
-    uint16_t  nFrameStartIdx;
 
     nRegGroups = (uint16_t)(nDataCfg >> 16u);
     nGroupDataLen = (uint16_t)(((uint16_t)nDataCfg) - ADBMS6948_CMD_DATA_LEN);
-    for (nGrpIdx = 0u; nGrpIdx < nRegGroups; nGrpIdx++)
-    {
-    	nFrameStartIdx = 0u;
-    	/* Populate the command code */
-    	aTxBuf[nGrpIdx][nFrameStartIdx++] = (uint8_t)((uint16_t)(pnCmdLst[nGrpIdx] & (uint16_t)0xFF00U) >> 8U);
-    	aTxBuf[nGrpIdx][nFrameStartIdx++] = (uint8_t)(pnCmdLst[nGrpIdx] & (uint16_t)0x00FFU);
-
-        /* Calculate the 15-bit PEC for the command bytes */
-        nCmdPec = Adbms6948_Pec15Calculate((uint8_t*)&aTxBuf[nGrpIdx][0u], 2u);
-
-        /* Append the PEC to the command buffer */
-        aTxBuf[nGrpIdx][nFrameStartIdx++] = (uint8_t)(nCmdPec >> 8U);
-        aTxBuf[nGrpIdx][nFrameStartIdx++] = (uint8_t)(nCmdPec);
-
-        for (nGrpDataIdx = 0u; nGrpDataIdx < nGroupDataLen; nGrpDataIdx++)
-        {
-			aTxBuf[nGrpIdx][nFrameStartIdx++] = (uint8_t)0xFFu;
-        }
-    }
+    Adbms6948_lPrepRdTxBuf(pnCmdLst, aTxBuf, nRegGroups, nGroupDataLen);
 
     /* Transmit the command buffer on the SPI bus */
     ADI_PAL_SPIWRITEREADS(aTxBuf, pRxBuf, nDataCfg, knChainID);
@@ -301,6 +300,85 @@ void  Adbms6948_Cmd_ExecuteCmdRD
 return;
 }
 
+/*!
+    @brief  This function executes the read commands like Adbms6948_Cmd_ExecuteCmdRD, but hands
+    each register group to the callback as soon as it has been received. With the asynchronous
+    SPI transport the transfer of group N+1 is started before the callback of group N runs, so
+    the processing of a group overlaps the transfer of the next one. A transfer that fails or does
+    not complete within ADBMS6948_SPI_ASYNC_TIMEOUT_US stops the read.
+
+    @param  [in]  pnCmdLst  The list of read commands to be executed.
+
+    @param  [out]  pRxBuf  The buffer to receive the register groups.
+
+    @param  [in]  nDataCfg  Bits [15:0] frame length of a group, bits [31:16] number of groups.
+
+    @param  [in]  pfRxGrpCallback  Callback invoked with the index of every received group.
+
+    @param  [in]  pContext  Context passed to the callback.
+
+    @param  [in]  knChainID  The daisy chain ID to perform the operation.
+
+    @return  E_OK: Success \n
+             E_NOT_OK: A transfer failed or timed out, the remaining groups are not read \n
+*/
+Adbms6948_ReturnType  Adbms6948_Cmd_ExecuteCmdRDPipelined
+(
+    uint16_t 						*pnCmdLst,
+    uint8_t     					 pRxBuf[][ADBMS6948_MAX_FRAME_SIZE],
+    uint32_t  						 nDataCfg,
+    Adbms6948_Cmd_RxGrpCallbackType  pfRxGrpCallback,
+    void 							*pContext,
+    const uint8_t    				 knChainID
+)
+{
+    uint8_t   aTxBuf[ADBMS6948_CMD_MAX_RX_FRAMES][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)];
+    uint16_t  nRegGroups, nGroupDataLen, nFrameLen;
+    uint16_t  nGrpIdx;
+    Adbms6948_ReturnType  nRet = E_OK;
+
+    nRegGroups = (uint16_t)(nDataCfg >> 16u);
+    nFrameLen = (uint16_t)nDataCfg;
+    nGroupDataLen = (uint16_t)(nFrameLen - ADBMS6948_CMD_DATA_LEN);
+    Adbms6948_lPrepRdTxBuf(pnCmdLst, aTxBuf, nRegGroups, nGroupDataLen);
+
+#if (ADBMS6948_SPI_ASYNC_EN == TRUE)
+    if (nRegGroups > 0u)
+    {
+        /* Start the transfer of the first register group */
+        ADI_PAL_SPIWRITEREADS_ASYNC(&aTxBuf[0u][0u], &pRxBuf[0u][0u], nFrameLen, knChainID);
+    }
+    for (nGrpIdx = 0u; (nGrpIdx < nRegGroups) && (E_OK == nRet); nGrpIdx++)
+    {
+        /* Wait for the transfer of the current register group */
+        nRet = Adbms6948_lWaitSpiTransfer(knChainID);
+        if (E_OK == nRet)
+        {
+            if ((nGrpIdx + 1u) < nRegGroups)
+            {
+                /* Start the next transfer before the current group is processed */
+                ADI_PAL_SPIWRITEREADS_ASYNC(&aTxBuf[nGrpIdx + 1u][0u], &pRxBuf[nGrpIdx + 1u][0u], nFrameLen, knChainID);
+            }
+            if (NULL_PTR != pfRxGrpCallback)
+            {
+                pfRxGrpCallback((uint8_t)nGrpIdx, pContext);
+            }
+        }
+    }
+#else
+    /* Transmit the command buffer on the SPI bus */
+    ADI_PAL_SPIWRITEREADS(aTxBuf, pRxBuf, nDataCfg, knChainID);
+    for (nGrpIdx = 0u; nGrpIdx < nRegGroups; nGrpIdx++)
+    {
+        if (NULL_PTR != pfRxGrpCallback)
+        {
+            pfRxGrpCallback((uint8_t)nGrpIdx, pContext);
+        }
+    }
+#endif
+return nRet;
+}
+
 /*!
     @brief  This function is used to send the dummy bytes to the device in case of wakeup and I2C
      	 	functionality
@@ -349,8 +427,8 @@ const uint8_t  	knChainID
 
     aCmd[0] = (uint8_t)((nCommand & 0xFF00u) >> ADBMS6948_SHIFT_BY_8);
     aCmd[1] = (uint8_t)((nCommand & 0x00FFu));
-    /* Calculate the 15-bit PEC for the command bytes */
-    nCmdPec = (uint16_t)Adbms6948_Pec15Calculate(&aCmd[0], 2u);
+    /* Look up the 15-bit PEC of the command */
+    nCmdPec = Adbms6948_Pec15Command(nCommand);
 
     /*Flip the Nth PEC bit */
     nBitPosToFlip = (uint8_t)(nPECBitToFlip + 1u);
@@ -397,8 +475,8 @@ void Adbms6948_Cmd_ExecCmdWRWithDPECBitFLip
 
     aTxBuf[nLen++] = (uint8_t)((uint16_t)(nCommand & (uint16_t)0xFF00U) >> 8U);
     aTxBuf[nLen++] = (uint8_t)(nCommand & (uint16_t)0x00FFU);
-    /* Calculate the 15-bit PEC for the command bytes */
-    nCmdPec = (uint16_t)Adbms6948_Pec15Calculate(&aTxBuf[0], 2u);
+    /* Look up the 15-bit PEC of the command */
+    nCmdPec = Adbms6948_Pec15Command(nCommand);
     /* Append the command PEC to the transmit buffer */
     aTxBuf[nLen++] = (uint8_t)(nCmdPec >> 8U);
     aTxBuf[nLen++] = (uint8_t)(nCmdPec);
@@ -470,7 +548,7 @@ const uint8_t  knChainID
 
     @param[in]      nCmd        Command to send
     @param[in]      pRxBuf      Pointer to the receive buffer
-    @param[in]      nRegGrps    Number of register groups to read
+    @param[in]      nDataLen    Number of bytes to read, the data and PEC of every device
     @param[in]      bIsPollCmd  Specifies poll command
     @param[in]      knChainID   The daisy chain ID to perform the operation.
  */
@@ -478,7 +556,7 @@ void  Adbms6948_Cmd_ExecuteCmdRDAll
 (
     uint8_t             *pRxBuf,
     uint16_t            nCmd,
-    uint8_t             nRegGrps,
+    uint16_t            nDataLen,
     boolean             bIsPollCmd,
     const uint8_t       knChainID
 )
@@ -493,15 +571,15 @@ void  Adbms6948_Cmd_ExecuteCmdRDAll
     aTxBuf[nFrameStartIdx++] = (uint8_t)((uint16_t)(nCmd & (uint16_t)0xFF00U) >> 8U);
     aTxBuf[nFrameStartIdx++] = (uint8_t)(nCmd & (uint16_t)0x00FFU);
 
-    /* Calculate the 15-bit PEC for the command bytes */
-    nCmdPec = Adbms6948_Pec15Calculate((uint8_t*)&aTxBuf[0u], 2u);
+    /* Look up the 15-bit PEC of the command */
+    nCmdPec = Adbms6948_Pec15Command(nCmd);
 
     /* Append the PEC to the command buffer */
     aTxBuf[nFrameStartIdx++] = (uint8_t)(nCmdPec >> 8U);
     aTxBuf[nFrameStartIdx++] = (uint8_t)(nCmdPec);
 
     /* Transmit the command buffer on the SPI bus */
-    ADI_PAL_SPIWRITEREADALL(aTxBuf, pRxBuf, nRegGrps, knChainID);
+    ADI_PAL_SPIWRITEREADALL(aTxBuf, pRxBuf, nDataLen, knChainID);
 
     /* Does the command increment the device command count */
     if (bIsPollCmd == TRUE)
@@ -512,6 +590,88 @@ void  Adbms6948_Cmd_ExecuteCmdRDAll
 return;
 }
 
+/*!
+    @brief  This function prepares the transmit frames of the read commands. Each frame holds
+    the command, its PEC and 0xFF filler bytes for the data clocked in from the chain.
+
+    @param  [in]  pnCmdLst  The list of read commands.
+
+    @param  [out]  pTxBuf  The buffer to hold the transmit frames.
+
+    @param  [in]  nRegGroups  Number of register groups to be read.
+
+    @param  [in]  nGroupDataLen  Length of the data of one register group for the whole chain.
+
+    @return  None.
+*/
+static void  Adbms6948_lPrepRdTxBuf
+(
+uint16_t 	*pnCmdLst,
+uint8_t      pTxBuf[][ADBMS6948_MAX_FRAME_SIZE],
+uint16_t     nRegGroups,
+uint16_t     nGroupDataLen
+)
+{
+    uint16_t  nCmdPec;
+    uint16_t  nGrpIdx, nGrpDataIdx;
+    uint16_t  nFrameStartIdx;
+
+    for (nGrpIdx = 0u; nGrpIdx < nRegGroups; nGrpIdx++)
+    {
+    	nFrameStartIdx = 0u;
+    	/* Populate the command code */
+    	pTxBuf[nGrpIdx][nFrameStartIdx++] = (uint8_t)((uint16_t)(pnCmdLst[nGrpIdx] & (uint16_t)0xFF00U) >> 8U);
+    	pTxBuf[nGrpIdx][nFrameStartIdx++] = (uint8_t)(pnCmdLst[nGrpIdx] & (uint16_t)0x00FFU);
+
+        /* Look up the 15-bit PEC of the command */
+        nCmdPec = Adbms6948_Pec15Command(pnCmdLst[nGrpIdx]);
+
+        /* Append the PEC to the command buffer */
+        pTxBuf[nGrpIdx][nFrameStartIdx++] = (uint8_t)(nCmdPec >> 8U);
+        pTxBuf[nGrpIdx][nFrameStartIdx++] = (uint8_t)(nCmdPec);
+
+        for (nGrpDataIdx = 0u; nGrpDataIdx < nGroupDataLen; nGrpDataIdx++)
+        {
+			pTxBuf[nGrpIdx][nFrameStartIdx++] = (uint8_t)0xFFu;
+        }
+    }
+}
+
+#if (ADBMS6948_SPI_ASYNC_EN == TRUE)
+/*!
+    @brief  This function waits for the asynchronous transfer of a chain, bounded by the PAL timer
+    of the chain. A transfer still in progress after ADBMS6948_SPI_ASYNC_TIMEOUT_US is aborted.
+
+    @param  [in]  knChainID  The daisy chain ID to perform the operation.
+
+    @return  E_OK: The transfer is complete \n
+             E_NOT_OK: The transfer failed or was aborted, the platform error is consumed \n
+*/
+static Adbms6948_ReturnType  Adbms6948_lWaitSpiTransfer
+(
+const uint8_t  knChainID
+)
+{
+    Adbms6948_ReturnType  nRet = E_OK;
+
+    ADI_PAL_TIMER_START(ADBMS6948_SPI_ASYNC_TIMEOUT_US, knChainID);
+    while (FALSE == ADI_PAL_SPI_TRANSFER_DONE(knChainID))
+    {
+        if (TRUE == ADI_PAL_GET_TIMEOUT_STATUS(knChainID))
+        {
+            /* Stop the transfer, its buffers are released to the caller */
+            ADI_PAL_SPI_TRANSFER_ABORT(knChainID);
+        }
+    }
+    ADI_PAL_TIMER_STOP(knChainID);
+    if (TRUE == ADI_PAL_ISERROR(knChainID))
+    {
+        nRet = E_NOT_OK;
+    }
+return nRet;
+}
+#endif
+
 /* End of code section */
 /* Code section stop */
 ADBMS6948_DRV_CODE_STOP
@@ -286,6 +286,26 @@ static Adbms6948_ReturnType  Adbms6948_lReadCellOVUVStatus
 	Adbms6948_SnapSelType 	 eSnapSel,
 	const uint8_t  			 knChainID
 );
+static uint8_t  Adbms6948_lGetOWStatus
+(
+	uint32_t 				nDelta,
+	uint32_t 				nOpenLimit,
+	uint32_t 				nClosedLimit
+);
+static Adbms6948_ReturnType Adbms6948_lReadCellVoltCS
+(
+	int16_t					*pnCellData,
+	int16_t					*pnSCellData,
+	uint16_t				*pnCSFltStatus,
+	Adbms6948_SnapSelType	eSnapSel,
+	const uint8_t			knChainID
+);
+static Adbms6948_ReturnType  Adbms6948_lReadCSFltStatus
+(
+	uint16_t 				*pnCSFltStatus,
+	boolean 				*pbClrSent,
+	const uint8_t  			 knChainID
+);
 #endif /*  ADI_DISABLE_DOCUMENTATION */
 /*
  * Function Definition section
@@ -2177,6 +2197,247 @@ Adbms6948_ReturnType Adbms6948_Int_ClearAllFlags
 return(nRet);
 }
 
+/*****************************************************************************/
+/*!
+    @brief	This function evaluates the open wire status of every cell of the
+			daisy chain from a normal measurement and a measurement taken with
+			the open wire switches on. No command is sent to the devices, so
+			the chain state is not changed.\n
+
+			The status of a cell is the status of the wire at its top, Cn for
+			cell n. An open wire pulled by its switch moves the measurement
+			of the cell by a large part of the cell voltage, so the absolute
+			difference of the two measurements is compared with the cell
+			voltage divided by the OW divide factors of the ADC used:
+			above 1/MIN_DIV_FACTOR the wire is open, below 1/MAX_DIV_FACTOR
+			it is closed, in between the result is undecided. Only the cells
+			whose switch was on during the open wire measurement carry
+			information; the caller selects them by the OW selection used.
+
+    @param [in]		pnCellData		Cell voltage codes measured with the open
+									wire switches off, all the cells of a
+									device before the next device.
+									@range: NA
+									@resolution: NA
+
+    @param [in]		pnCellOWData	Cell voltage codes measured with the open
+									wire switches on, same layout.
+									@range: NA
+									@resolution: NA
+
+    @param [in]		bIsCADCUsed		TRUE if the open wire measurement was
+									taken with the C-ADC, FALSE for the S-ADC.
+									@range: TRUE, FALSE
+									@resolution: NA
+
+    @param [out]	pbCellOWStatus	Place holder to report one ADBMS6948_OW_*
+									status per cell, same layout.
+									@range: NA
+									@resolution: NA
+
+    @param [in]		knChainID		Specifies ID of the daisy chain on
+									which the operation is to be performed.
+									@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+									@resolution: NA
+
+    @return        E_OK: 		Success \n
+                   E_NOT_OK: 	Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_Int_CellOWDiag
+(
+    const int16_t 		*pnCellData,
+    const int16_t 		*pnCellOWData,
+	boolean				 bIsCADCUsed,
+    uint8_t 			*pbCellOWStatus,
+    const uint8_t 		 knChainID
+)
+{
+	Adbms6948_ReturnType  	nRet = E_NOT_OK;
+	uint16_t  nMaxDivFactor, nMinDivFactor, nBufIdx = 0u;
+	int32_t   nCellVolt, nDelta;
+	uint8_t   nDevIdx, nCellIdx;
+
+	if (ADBMS6948_ST_UNINIT == Adbms6948_eState)
+	{
+		/* Module is not initialized. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CELLOWDIAG_ID, ADBMS6948_E_MODULESTATE);
+		#endif
+	}
+	else if ((NULL_PTR == pnCellData) || (NULL_PTR == pnCellOWData) || (NULL_PTR == pbCellOWStatus))
+	{
+		/* Null pointer error. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CELLOWDIAG_ID, ADBMS6948_E_PARAM_POINTER);
+		#endif
+	}
+	else if (ADBMS6948_NO_OF_DAISY_CHAIN <= knChainID)
+	{
+		/* Invalid chain ID. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CELLOWDIAG_ID, ADBMS6948_E_INVALID_PARAM);
+		#endif
+	}
+	else
+	{
+		if (TRUE == bIsCADCUsed)
+		{
+			nMaxDivFactor = ADBMS6948_CADC_OW_MAX_DIV_FACTOR;
+			nMinDivFactor = ADBMS6948_CADC_OW_MIN_DIV_FACTOR;
+		}
+		else
+		{
+			nMaxDivFactor = ADBMS6948_SADC_OW_MAX_DIV_FACTOR;
+			nMinDivFactor = ADBMS6948_SADC_OW_MIN_DIV_FACTOR;
+		}
+
+		for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
+		{
+			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+			{
+				for (nCellIdx = 0u; nCellIdx < ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE; nCellIdx++)
+				{
+					/* Codes are centred on 1.5 V, the thresholds scale with the absolute cell voltage */
+					nCellVolt = (int32_t)pnCellData[nBufIdx] + ADBMS6948_OW_CODE_OFFSET;
+					nDelta = (int32_t)pnCellOWData[nBufIdx] - (int32_t)pnCellData[nBufIdx];
+					if (nDelta < 0)
+					{
+						nDelta = -nDelta;
+					}
+					if (nCellVolt <= 0)
+					{
+						/* No cell voltage to scale the thresholds with. */
+						pbCellOWStatus[nBufIdx] = ADBMS6948_OW_UNDECIDED;
+					}
+					else
+					{
+						pbCellOWStatus[nBufIdx] = Adbms6948_lGetOWStatus((uint32_t)nDelta,
+																		 (uint32_t)nCellVolt / nMinDivFactor,
+																		 (uint32_t)nCellVolt / nMaxDivFactor);
+					}
+					nBufIdx++;
+				}
+			}
+		}
+		nRet = E_OK;
+	}
+return(nRet);
+}
+
+/*****************************************************************************/
+/*!
+    @brief	This function evaluates the open wire status of the current
+			inputs of every device of the daisy chain from a normal current
+			measurement and a measurement taken with the open wire switches
+			on. No command is sent to the devices, so
+			the chain state is not changed.\n
+
+			The absolute difference of the two measurements is compared with
+			the OW thresholds of the ADC used: above the open threshold the
+			input is open, below the closed threshold it is closed, in
+			between the result is undecided.
+
+    @param [in]		pnCurrentData		Current codes measured with the open
+										wire switches off, one per device.
+										@range: NA
+										@resolution: NA
+
+    @param [in]		pnCurrentOWData		Current codes measured with the open
+										wire switches on, one per device.
+										@range: NA
+										@resolution: NA
+
+    @param [in]		bIsI1ADCUsed		TRUE if the measurements were taken
+										with the I1-ADC, FALSE for the I2-ADC.
+										@range: TRUE, FALSE
+										@resolution: NA
+
+    @param [out]	pbCurrentOWStatus	Place holder to report one
+										ADBMS6948_OW_* status per device.
+										@range: NA
+										@resolution: NA
+
+    @param [in]		knChainID			Specifies ID of the daisy chain on
+										which the operation is to be performed.
+										@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+										@resolution: NA
+
+    @return        E_OK: 		Success \n
+                   E_NOT_OK: 	Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_Int_CurrentOWDiag
+(
+	const int32_t 		*pnCurrentData,
+	const int32_t 		*pnCurrentOWData,
+	boolean				 bIsI1ADCUsed,
+	uint8_t 			*pbCurrentOWStatus,
+	const uint8_t 		 knChainID
+)
+{
+	Adbms6948_ReturnType  	nRet = E_NOT_OK;
+	uint32_t  nOpenDelta, nClosedDelta;
+	int64_t   nDelta;
+	uint8_t   nDevIdx, nBufIdx = 0u;
+
+	if (ADBMS6948_ST_UNINIT == Adbms6948_eState)
+	{
+		/* Module is not initialized. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CURRENTOWDIAG_ID, ADBMS6948_E_MODULESTATE);
+		#endif
+	}
+	else if ((NULL_PTR == pnCurrentData) || (NULL_PTR == pnCurrentOWData) || (NULL_PTR == pbCurrentOWStatus))
+	{
+		/* Null pointer error. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CURRENTOWDIAG_ID, ADBMS6948_E_PARAM_POINTER);
+		#endif
+	}
+	else if (ADBMS6948_NO_OF_DAISY_CHAIN <= knChainID)
+	{
+		/* Invalid chain ID. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_CURRENTOWDIAG_ID, ADBMS6948_E_INVALID_PARAM);
+		#endif
+	}
+	else
+	{
+		if (TRUE == bIsI1ADCUsed)
+		{
+			nOpenDelta = ADBMS6948_I1ADC_OW_OPEN_DELTA;
+			nClosedDelta = ADBMS6948_I1ADC_OW_CLOSED_DELTA;
+		}
+		else
+		{
+			nOpenDelta = ADBMS6948_I2ADC_OW_OPEN_DELTA;
+			nClosedDelta = ADBMS6948_I2ADC_OW_CLOSED_DELTA;
+		}
+
+		for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
+		{
+			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+			{
+				/* The difference of two signed codes may exceed 31 bits */
+				nDelta = (int64_t)pnCurrentOWData[nBufIdx] - (int64_t)pnCurrentData[nBufIdx];
+				if (nDelta < 0)
+				{
+					nDelta = -nDelta;
+				}
+				if (nDelta > (int64_t)0xFFFFFFFFu)
+				{
+					nDelta = (int64_t)0xFFFFFFFFu;
+				}
+				pbCurrentOWStatus[nBufIdx] = Adbms6948_lGetOWStatus((uint32_t)nDelta, nOpenDelta, nClosedDelta);
+				nBufIdx++;
+			}
+		}
+		nRet = E_OK;
+	}
+return(nRet);
+}
+
 /*****************************************************************************/
 /*!
     @brief	This function gets the status of all the OV/UV diagnostic flags
@@ -2259,6 +2520,199 @@ const uint8_t  			 knChainID
 return(nRet);
 }
 
+/*****************************************************************************/
+/*!
+    @brief          This function reads the C-ADC and the S-ADC results of all
+					the cells with a single RDCSVALL frame, followed by the
+					C vs S fault flags of Status register C. The flags that
+					were read are cleared, so the next read reports the
+					comparisons made since this one. The C-ADC runs with
+					redundancy for the S-ADC results and the flags to be
+					meaningful.
+
+    @param	[out]	pnCellData 		Placeholder to report the C-ADC cell voltage
+									data, 16 cells of every device of the chain
+									@range: NA
+									@resolution: NA
+    @param	[out]	pnSCellData 	Placeholder to report the S-ADC cell voltage
+									data, 16 cells of every device of the chain
+									@range: NA
+									@resolution: NA
+    @param	[out]	pnCSFltStatus 	Placeholder to report the C vs S fault
+									flags, one per device of the chain, bit n
+									for cell n + 1
+									@range: NA
+									@resolution: NA
+    @param	[in]	eSnapSel		Specifies the snapshot command/s to be sent.
+							        @range: Enumeration.
+							        @resolution: NA
+	@param 	[in]	knChainID		Specifies ID of the daisy chain on which the
+	                        		operation is to be performed.
+									@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+									@resolution: NA
+    @return     E_OK: Success   \n
+                E_NOT_OK: Failed\n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType Adbms6948_Int_ReadCellVoltCS
+(
+	int16_t			    	*pnCellData,
+	int16_t			    	*pnSCellData,
+	uint16_t			    *pnCSFltStatus,
+	Adbms6948_SnapSelType	eSnapSel,
+	const uint8_t			knChainID
+)
+{
+	Adbms6948_ReturnType  	nRet = E_NOT_OK;
+	if (ADBMS6948_ST_UNINIT == Adbms6948_eState)
+	{
+		/* Module is not initialized. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_READCELLVOLTCS_ID, ADBMS6948_E_MODULESTATE);
+		#endif
+	}
+	else if ((NULL_PTR ==  pnCellData) || (NULL_PTR == pnSCellData) || (NULL_PTR == pnCSFltStatus))
+	{
+		/* Null pointer error. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_READCELLVOLTCS_ID, ADBMS6948_E_PARAM_POINTER);
+		#endif
+	}
+	else if ((TRUE == Adbms6948_Cmn_IsInvalidSnapSelType(eSnapSel)) || (ADBMS6948_NO_OF_DAISY_CHAIN <= knChainID))
+	{
+		/* Invalid chain ID. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_READCELLVOLTCS_ID, ADBMS6948_E_INVALID_PARAM);
+		#endif
+	}
+	else if (E_NOT_OK == Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_BUSY, knChainID))
+	{
+		/* Chain busy error. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_READCELLVOLTCS_ID, ADBMS6948_E_CHAIN_BUSY);
+		#endif
+	}
+	else
+	{
+		/* Read C and S-ADC voltages using RDCSVALL command and the C vs S faults */
+		nRet = Adbms6948_lReadCellVoltCS(pnCellData, pnSCellData, pnCSFltStatus, eSnapSel, knChainID);
+		if (E_OK == nRet)
+		{
+			/* Perform platform error check. */
+			if (TRUE == Adbms6948_Cmn_IsError(knChainID))
+			{
+				/* Platform error. */
+				nRet = E_NOT_OK;
+				Adbms6948_Cmn_ReportRuntimeErr(Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_Platform_Error.nErrID, ADBMS6948_RUNTIME_E_STATUS_FAILED);
+			}
+		}
+
+		/* Set chain state to IDLE. */
+		nRet |= Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_IDLE, knChainID);
+	}
+return(nRet);
+}
+
+/*****************************************************************************/
+/*!
+    @brief	This function reads the C vs S fault flags of all the devices in
+			the chain and clears the flags that were set.
+
+    @param [out]	pnCSFltStatus  		Place holder to report the C vs S fault
+										flags, one per device of the chain.
+										Bit n reports that the C-ADC and S-ADC
+										results of cell n + 1 differed by more
+										than the configured comparison threshold
+										in a redundant conversion.
+										@range: NA
+										@resolution: NA
+
+	@param 	[in] 	eSnapSel	Specifies the snapshot command/s to be sent.
+								@range: Enumeration
+								@resolution: NA
+
+    @param	[in]   	knChainID	Specifies ID of the daisy chain on
+								which the operation is to be performed.
+								@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+								@resolution: NA
+
+    @return        E_OK: 		Success \n
+                   E_NOT_OK: 	Failure \n
+ */
+/*****************************************************************************/
+Adbms6948_ReturnType  Adbms6948_Int_ReadCSFltStatus
+(
+uint16_t 				*pnCSFltStatus,
+Adbms6948_SnapSelType 	 eSnapSel,
+const uint8_t  			 knChainID
+)
+{
+	Adbms6948_ReturnType  	nRet = E_NOT_OK;
+	boolean  bCfgRead = FALSE;
+
+	if (ADBMS6948_ST_UNINIT == Adbms6948_eState)
+	{
+		/* Module is not initialized. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_READCSFLTSTATUS_ID, ADBMS6948_E_MODULESTATE);
+		#endif
+	}
+	else if (NULL_PTR == pnCSFltStatus)
+	{
+		/* Null pointer error. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_READCSFLTSTATUS_ID, ADBMS6948_E_PARAM_POINTER);
+		#endif
+	}
+	else if ((TRUE == Adbms6948_Cmn_IsInvalidSnapSelType(eSnapSel)) || (ADBMS6948_NO_OF_DAISY_CHAIN <= knChainID))
+	{
+		/* Invalid chain ID. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_READCSFLTSTATUS_ID, ADBMS6948_E_INVALID_PARAM);
+		#endif
+	}
+	else if (E_NOT_OK == Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_BUSY, knChainID))
+	{
+		/* Chain busy error. */
+		#if (TRUE == ADBMS6948_DEVELOPMENT_MODE_EN)
+		Adbms6948_Cmn_ReportDevErr(ADBMS6948_MODULE_ID, ADBMS6948_INSTANCE_ID, ADBMS6948_READCSFLTSTATUS_ID, ADBMS6948_E_CHAIN_BUSY);
+		#endif
+	}
+	else
+	{
+		if ((ADBMS6948_SEND_SNAP == eSnapSel) || (ADBMS6948_SEND_BOTH == eSnapSel))
+		{
+			Adbms6948_Cmn_SendCommandOnly(ADBMS6948_CMD_SNAP, TRUE, knChainID);
+		}
+
+		/* Read and clear the C vs S faults */
+		nRet = Adbms6948_lReadCSFltStatus(pnCSFltStatus, &bCfgRead, knChainID);
+
+		if ((ADBMS6948_SEND_UNSNAP == eSnapSel) || (ADBMS6948_SEND_BOTH == eSnapSel))
+		{
+			Adbms6948_Cmn_SendCommandOnly(ADBMS6948_CMD_UNSNAP, TRUE, knChainID);
+			bCfgRead = TRUE;
+		}
+
+		/* Verify the command counter if either CLRFLAG command or UNSNAP was sent*/
+		nRet |= Adbms6948_Cmn_VerifyCmdCnt(bCfgRead, knChainID);
+		if (E_OK == nRet)
+		{
+			/* Perform platform error check. */
+			if (TRUE == Adbms6948_Cmn_IsError(knChainID))
+			{
+				/* Platform error. */
+				nRet = E_NOT_OK;
+				Adbms6948_Cmn_ReportRuntimeErr(Adbms6948_pConfig->Adbms6948_pRunTimeErrCfg->Adbms6948_E_Platform_Error.nErrID, ADBMS6948_RUNTIME_E_STATUS_FAILED);
+			}
+		}
+
+		/* Set chain state to IDLE. */
+		nRet |= Adbms6948_Cmn_UpdateChainStatus(ADBMS6948_ST_CHAIN_IDLE, knChainID);
+	}
+return(nRet);
+}
+
 /*****************************************************************************/
 /*!
     @brief          This function clears all the cell voltage registers and also
@@ -2489,7 +2943,7 @@ static Adbms6948_ReturnType  Adbms6948_lReadI1ADCConvCnt
 {
     Adbms6948_ReturnType  nRet;
     uint16_t  nCmdCode;
-    uint8_t  anRdBuf[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + ADBMS6948_REG_DATA_LEN_WITH_PEC];
+    uint8_t  anRdBuf[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)];
     uint16_t  anCmdList[ADBMS6948_NUMOF_REGGRP_CONVCNT];
     uint16_t  nConvCnt, nRdBufIdx;
     boolean bCfgRead = FALSE;
@@ -2553,7 +3007,7 @@ static Adbms6948_ReturnType  Adbms6948_lReadVoltageCurrentCTValues
 {
     Adbms6948_ReturnType  nRet;
     uint16_t nCmdCode;
-    uint8_t  anRdBuf[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + ADBMS6948_REG_DATA_LEN_WITH_PEC];
+    uint8_t  anRdBuf[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)];
     uint16_t anCmdList[ADBMS6948_NUMOF_REGGRP_CONVCNT];
     uint16_t nRdBufIdx;
     boolean  bCfgRead = FALSE;
@@ -2808,14 +3262,12 @@ static Adbms6948_ReturnType  Adbms6948_lReadAllCellVolt
 )
 {
 	Adbms6948_ReturnType  nRet;
-	uint8_t  anReadCellDataBuf[ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITHOUT_PEC * ADBMS6948_MAX_CELLDATA_REGGRPS) + ADBMS6948_PEC_LEN];
+	uint8_t  anReadCellDataBuf[ADBMS6948_RDALL_CELLVOLTAGES_BYTES * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
 	uint16_t  nCmd;
-	uint16_t  nCmdCode, nCellData, nRdBufIdx;
-	uint8_t  nDataLenBytesWithPec;
+	uint16_t  nCmdCode, nCellData, nRdBufIdx, nBufIdx = 0u;
+	uint8_t  nDataLenBytesWithPec, nDevIdx;
 	boolean  bSendSnap, bSendUnsnap;
 
-	nRdBufIdx = 0u;
-
 	bSendSnap = (boolean)((uint8_t)eSnapSel & 0x01u);
 	bSendUnsnap = (boolean)(((uint8_t)eSnapSel & 0x02u) >> 1u);
 	nDataLenBytesWithPec = Adbms6948_ReadAllCommandBytes[ADBMS6948_READALL_CELLVOLTAGES];
@@ -2832,12 +3284,19 @@ static Adbms6948_ReturnType  Adbms6948_lReadAllCellVolt
 
 	if (E_OK == nRet)
 	{
-		for(uint8_t nCellIdx = 0; nCellIdx < ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE; ++nCellIdx)
+		/* Populate the user data buffer, all the cells of a device before the next device. */
+		for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
 		{
-			/* Populate the user data buffer. */
-        	nCellData = (int16_t)(((uint16_t)anReadCellDataBuf[nRdBufIdx + 1u] << 8u) | (uint16_t)anReadCellDataBuf[nRdBufIdx]);
-        	pnCellData[nCellIdx] = nCellData;
-			nRdBufIdx += 2;
+			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+			{
+				nRdBufIdx = (uint16_t)(nDevIdx * (uint16_t)nDataLenBytesWithPec);
+				for(uint8_t nCellIdx = 0; nCellIdx < ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE; ++nCellIdx)
+				{
+					nCellData = (int16_t)(((uint16_t)anReadCellDataBuf[nRdBufIdx + 1u] << 8u) | (uint16_t)anReadCellDataBuf[nRdBufIdx]);
+					pnCellData[nBufIdx++] = nCellData;
+					nRdBufIdx += 2;
+				}
+			}
 		}
 	}
 	if ((E_OK == nRet) && (TRUE == bSendUnsnap))
@@ -2890,12 +3349,13 @@ static Adbms6948_ReturnType  Adbms6948_lReadAllAverageCellVoltages
 )
 {
 	Adbms6948_ReturnType  nRet;
-	uint8_t anRDSTATBuff[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + ADBMS6948_REG_DATA_LEN_WITH_PEC];
-	uint8_t anReadDataBuf[(ADBMS6948_REG_DATA_LEN_WITHOUT_PEC * ADBMS6948_MAX_CELLDATA_REGGRPS) + ADBMS6948_PEC_LEN];
+	uint8_t anRDSTATBuff[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)];
+	uint8_t anReadDataBuf[ADBMS6948_RDALL_CELLVOLTAGES_BYTES * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
 	uint16_t nVoltageCT;
-	uint16_t nRdBufIdx = 0u;
+	uint16_t nRdBufIdx, nBufIdx = 0u;
 	uint16_t nCellData, nCmd;
-	uint8_t nDataLenBytesWithPec;
+	uint8_t nDataLenBytesWithPec = Adbms6948_ReadAllCommandBytes[ADBMS6948_READALL_CELLVOLTAGES];
+	uint8_t nDevIdx;
 	boolean bResultsReady = FALSE;
 
 	while(1)
@@ -2928,18 +3388,24 @@ static Adbms6948_ReturnType  Adbms6948_lReadAllAverageCellVoltages
 	{
 		/*Send RDACALL command to read average C-ADC cell voltage values*/
 		nCmd = ADBMS6948_CMD_RDACALL;
-		nDataLenBytesWithPec = Adbms6948_ReadAllCommandBytes[ADBMS6948_READALL_CELLVOLTAGES];
 		nRet = Adbms6948_Cmn_ReadAllRegGroups(nCmd, anReadDataBuf, nDataLenBytesWithPec, knChainID);
 		Adbms6948_lSendUnsnap(knChainID);
 	}
 	if (E_OK == nRet)
 	{
-		for(uint8_t nCellIdx = 0; nCellIdx < ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE; ++nCellIdx)
+		/* Populate the user data buffer, all the cells of a device before the next device. */
+		for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
 		{
-			/* Populate the user data buffer. */
-        	nCellData = (int16_t)(((uint16_t)anReadDataBuf[nRdBufIdx + 1u] << 8u) | (uint16_t)anReadDataBuf[nRdBufIdx]);
-        	pnCellData[nCellIdx] = nCellData;
-			nRdBufIdx += 2;
+			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+			{
+				nRdBufIdx = (uint16_t)(nDevIdx * (uint16_t)nDataLenBytesWithPec);
+				for(uint8_t nCellIdx = 0; nCellIdx < ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE; ++nCellIdx)
+				{
+					nCellData = (int16_t)(((uint16_t)anReadDataBuf[nRdBufIdx + 1u] << 8u) | (uint16_t)anReadDataBuf[nRdBufIdx]);
+					pnCellData[nBufIdx++] = nCellData;
+					nRdBufIdx += 2;
+				}
+			}
 		}
 	}
 
@@ -2990,7 +3456,7 @@ static Adbms6948_ReturnType  Adbms6948_lReadCurrent
 )
 {
 	Adbms6948_ReturnType  nRet;
-	uint8_t		anReadCurrentDataBuf[ADBMS6948_MAX_CURRENT_REGGRPS][ADBMS6948_CMD_DATA_LEN + ADBMS6948_REG_DATA_LEN_WITH_PEC];
+	uint8_t		anReadCurrentDataBuf[ADBMS6948_MAX_CURRENT_REGGRPS][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)];
 	uint16_t	anCmdList[ADBMS6948_MAX_CURRENT_REGGRPS];
 	uint16_t	nCmdCode, nRdBufIdx, nBufIdx = 0u;
 	uint32_t	nCurrentData;
@@ -3136,15 +3602,13 @@ static Adbms6948_ReturnType Adbms6948_lReadCADCI1ADC
 )
 {
 	Adbms6948_ReturnType  nRet;
-	uint8_t  anReadDataBuf[ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITHOUT_PEC * ADBMS6948_NUMOF_REGGRP_RDCIV) + ADBMS6948_PEC_LEN];
+	uint8_t  anReadDataBuf[ADBMS6948_RDALL_VOLT_CURRENT_BYTES * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
 	uint16_t  nCmd;
-	uint16_t  nCmdCode, nCellData, nRdBufIdx;
+	uint16_t  nCmdCode, nCellData, nRdBufIdx, nBufIdx = 0u;
 	uint32_t nCurrentData;
-	uint8_t  nDataLenBytesWithPec;
+	uint8_t  nDataLenBytesWithPec, nDevIdx, nCurrIdx = 0u;
 	boolean  bSendSnap, bSendUnsnap;
 
-	nRdBufIdx = 0u;
-
 	bSendSnap = (boolean)((uint8_t)eSnapSel & 0x01u);
 	bSendUnsnap = (boolean)(((uint8_t)eSnapSel & 0x02u) >> 1u);
 	nDataLenBytesWithPec = Adbms6948_ReadAllCommandBytes[ADBMS6948_READALL_VOLT_CURRENT];
@@ -3160,22 +3624,29 @@ static Adbms6948_ReturnType Adbms6948_lReadCADCI1ADC
 
 	if (E_OK == nRet)
 	{
-		for(uint8_t nCellIdx = 0; nCellIdx < ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE; ++nCellIdx)
+		/* Populate the user data buffers, the cells and the current of every device. */
+		for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
 		{
-			/* Populate the user data buffer. */
-        	nCellData = (uint16_t)(((uint16_t)anReadDataBuf[nRdBufIdx + 1u] << 8u) |
-									(uint16_t)anReadDataBuf[nRdBufIdx]);
-        	pnCellData[nCellIdx] = nCellData;
-			nRdBufIdx += 2;
+			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+			{
+				nRdBufIdx = (uint16_t)(nDevIdx * (uint16_t)nDataLenBytesWithPec);
+				for(uint8_t nCellIdx = 0; nCellIdx < ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE; ++nCellIdx)
+				{
+					nCellData = (uint16_t)(((uint16_t)anReadDataBuf[nRdBufIdx + 1u] << 8u) |
+											(uint16_t)anReadDataBuf[nRdBufIdx]);
+					pnCellData[nBufIdx++] = nCellData;
+					nRdBufIdx += 2;
+				}
+				nCurrentData = (uint32_t)(((((uint32_t)anReadDataBuf[nRdBufIdx + 2u]) & 0x07) << 16u) |
+											((uint32_t)anReadDataBuf[nRdBufIdx + 1u] << 8u) |
+											((uint32_t)anReadDataBuf[nRdBufIdx]));
+				if (nCurrentData & (0x00040000))
+				{
+					nCurrentData |= 0xFFF80000;
+				}
+				pnCurrentData[nCurrIdx++] = nCurrentData;
+			}
 		}
-		nCurrentData = (uint32_t)(((((uint32_t)anReadDataBuf[nRdBufIdx + 2u]) & 0x07) << 16u) |
-									((uint32_t)anReadDataBuf[nRdBufIdx + 1u] << 8u) |
-									((uint32_t)anReadDataBuf[nRdBufIdx]));
-        if (nCurrentData & (0x00040000))
-        {
-            nCurrentData |= 0xFFF80000;
-        }
-        pnCurrentData[0] = nCurrentData;
 	}
 	if ((E_OK == nRet) && (TRUE == bSendUnsnap))
 	{
@@ -3234,13 +3705,14 @@ static Adbms6948_ReturnType  Adbms6948_lReadCellVoltCurrentAverage
 )
 {
 	Adbms6948_ReturnType  nRet;
-	uint8_t anRDSTATBuff[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + ADBMS6948_REG_DATA_LEN_WITH_PEC];
-	uint8_t anReadDataBuf[ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITHOUT_PEC * ADBMS6948_NUMOF_REGGRP_RDCIV) + ADBMS6948_PEC_LEN];
+	uint8_t anRDSTATBuff[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)];
+	uint8_t anReadDataBuf[ADBMS6948_RDALL_VOLT_CURRENT_BYTES * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
 	uint16_t nVoltageCT, nCurrentCT;
-	uint16_t nRdBufIdx = 0u;
+	uint16_t nRdBufIdx, nBufIdx = 0u;
 	uint16_t nCellData, nCmd;
 	uint32_t nCurrentData;
-	uint8_t nDataLenBytesWithPec;
+	uint8_t nDataLenBytesWithPec = Adbms6948_ReadAllCommandBytes[ADBMS6948_READALL_VOLT_CURRENT];
+	uint8_t nDevIdx, nCurrIdx = 0u;
 	boolean bCfgRead = FALSE;
     boolean bResultsReady = FALSE;
     while(1)
@@ -3285,30 +3757,35 @@ static Adbms6948_ReturnType  Adbms6948_lReadCellVoltCurrentAverage
 	{
 		/*Send RDACIV command to read average current and voltage values*/
 		nCmd = ADBMS6948_CMD_RDACIV;
-		nDataLenBytesWithPec = Adbms6948_ReadAllCommandBytes[ADBMS6948_READALL_VOLT_CURRENT];
 		nRet = Adbms6948_Cmn_ReadAllRegGroups(nCmd, anReadDataBuf, nDataLenBytesWithPec, knChainID);
         /*TODO:SA Add CLRCELL, CLRCI, CLRSI commands here*/
 	}
 	if (E_OK == nRet)
 	{
-		for(uint8_t nCellIdx = 0; nCellIdx < ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE; ++nCellIdx)
+		/* Populate the user data buffers, the cells and the current of every device. */
+		for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
 		{
-			/* Populate the user data buffer. */
-        	nCellData = (uint16_t)(((uint16_t)anReadDataBuf[nRdBufIdx + 1u] << 8u) |
-									(uint16_t)anReadDataBuf[nRdBufIdx]);
-        	pnCellData[nCellIdx] = nCellData;
-			nRdBufIdx += 2;
+			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+			{
+				nRdBufIdx = (uint16_t)(nDevIdx * (uint16_t)nDataLenBytesWithPec);
+				for(uint8_t nCellIdx = 0; nCellIdx < ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE; ++nCellIdx)
+				{
+					nCellData = (uint16_t)(((uint16_t)anReadDataBuf[nRdBufIdx + 1u] << 8u) |
+											(uint16_t)anReadDataBuf[nRdBufIdx]);
+					pnCellData[nBufIdx++] = nCellData;
+					nRdBufIdx += 2;
+				}
+				/*I1*/
+				nCurrentData = (uint32_t)(((((uint32_t)anReadDataBuf[nRdBufIdx + 2u]) & 0xFFu) << 16u) |
+										   (((uint32_t)anReadDataBuf[nRdBufIdx + 1u]) & 0xFFu) << 8u) |
+										   (((uint32_t)anReadDataBuf[nRdBufIdx + 0u]) & 0xFFu);
+				if (nCurrentData & (0x00800000))
+				{
+					nCurrentData |= 0xFF000000;
+				}
+				pnCurrentData[nCurrIdx++] = nCurrentData;
+			}
 		}
-        /*I1*/
-		nCurrentData = (uint32_t)(((((uint32_t)anReadDataBuf[nRdBufIdx + 2u]) & 0xFFu) << 16u) |
-								   (((uint32_t)anReadDataBuf[nRdBufIdx + 1u]) & 0xFFu) << 8u) |
-								   (((uint32_t)anReadDataBuf[nRdBufIdx + 0u]) & 0xFFu);
-        if (nCurrentData & (0x00800000))
-        {
-            nCurrentData |= 0xFF000000;
-        }
-
-		*pnCurrentData = nCurrentData;
 
         if (TRUE == bSendUnsnapAtEnd)
         {
@@ -3573,8 +4050,11 @@ static Adbms6948_ReturnType  Adbms6948_lReadAllAuxStatusRegisters
 )
 {
     Adbms6948_ReturnType nRet;
-    uint8_t  anReadAuxStatusBuf[ADBMS6948_RDALL_AUX_STATUS_BYTES] = {0u};
+    uint8_t  anReadAuxStatusBuf[ADBMS6948_RDALL_AUX_STATUS_BYTES * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN] = {0u};
+    uint8_t  *pSlice;
+    Adbms6948_StatusRegValsType *poStatus;
     uint8_t  nDataBytesLenWithPec;
+    uint8_t  nDevIdx, nOutIdx = 0u;
     uint16_t nRdBufIdx;
 
     nDataBytesLenWithPec = Adbms6948_ReadAllCommandBytes[ADBMS6948_READALL_AUX_STATUS];
@@ -3584,98 +4064,108 @@ static Adbms6948_ReturnType  Adbms6948_lReadAllAuxStatusRegisters
 
     if (E_OK == nRet)
     {
-        /*Populate the user buffer for GPIO data*/
-        ADI_PAL_MEMCPY((uint8_t *)panGpioData, anReadAuxStatusBuf, ADBMS6948_RDASALL_GPIO_BYTES);
-        /*Populate the user buffer for Redundant GPIO data*/
-        ADI_PAL_MEMCPY((uint8_t *)panRedundantGpioData, anReadAuxStatusBuf + ADBMS6948_RDASALL_GPIO_BYTES, ADBMS6948_RDASALL_RD_GPIO_BYTES);
-        /*Populate the user buffer for Status Register A*/
-        nRdBufIdx = ADBMS6948_RDASALL_GPIO_BYTES + ADBMS6948_RDASALL_RD_GPIO_BYTES;
-        poStatusRegsVal->nVRef2 =   (uint16_t)(((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 1u] << 8u) |
-                                                (uint16_t)anReadAuxStatusBuf[nRdBufIdx]);
-        poStatusRegsVal->nITMP  =   (uint16_t)(((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 3u] << 8u) |
-                                                (uint16_t)anReadAuxStatusBuf[nRdBufIdx + 2u]);
-        poStatusRegsVal->nVRef3 =   (uint16_t)(((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 5u] << 8u) |
-                                                (uint16_t)anReadAuxStatusBuf[nRdBufIdx + 4u]);
-        nRdBufIdx += ADBMS6948_RDASALL_STATUSA_BYTES;
-
-        /*Populate the user buffer for Status Register B*/
-        poStatusRegsVal->nVD    =   (uint16_t)(((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 1u] << 8u) |
-                                                (uint16_t)anReadAuxStatusBuf[nRdBufIdx]);
-        poStatusRegsVal->nVA    =   (uint16_t)(((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 3u] << 8u) |
-                                                (uint16_t)anReadAuxStatusBuf[nRdBufIdx + 2u]);
-        poStatusRegsVal->nVR4K  =   (uint16_t)(((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 5u] << 8u) |
-                                                (uint16_t)anReadAuxStatusBuf[nRdBufIdx + 4u]);
-        nRdBufIdx += ADBMS6948_RDASALL_STATUSB_BYTES;
-
-        /*Populate the user buffer for Status Register C*/
-        poStatusRegsVal->nCSxFault      =   (uint16_t)(((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 1u] << 8u) |
-                                                        (uint16_t)anReadAuxStatusBuf[nRdBufIdx]);
-        poStatusRegsVal->nCompI         =   (anReadAuxStatusBuf[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_COMP_I) >> ADBMS6948_STCR2_POS_COMP_I;
-        poStatusRegsVal->nOC1           =   (anReadAuxStatusBuf[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_OC1) >> ADBMS6948_STCR2_POS_OC1;
-        poStatusRegsVal->nOC2           =   (anReadAuxStatusBuf[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_OC2) >> ADBMS6948_STCR2_POS_OC2;
-        poStatusRegsVal->nOCWarn1       =   (anReadAuxStatusBuf[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_OCW1) >> ADBMS6948_STCR2_POS_OCW1;
-        poStatusRegsVal->nOCWarn2       =   (anReadAuxStatusBuf[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_OCW2) >> ADBMS6948_STCR2_POS_OCW2;
-        poStatusRegsVal->nCoulCntFlt    =   (anReadAuxStatusBuf[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_CCFLT) >> ADBMS6948_STCR2_POS_CCFLT;
-        poStatusRegsVal->nTimeBaseFlt   =   (anReadAuxStatusBuf[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_TB_OF) >> ADBMS6948_STCR2_POS_TB_OF;
-        poStatusRegsVal->nCoulCntSeqErr =   (anReadAuxStatusBuf[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_SEQCC) >> ADBMS6948_STCR2_POS_SEQCC;
-
-        poStatusRegsVal->nSMED          =   (anReadAuxStatusBuf[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_SMED) >> ADBMS6948_STCR4_POS_SMED;
-        poStatusRegsVal->nSED           =   (anReadAuxStatusBuf[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_SED) >> ADBMS6948_STCR4_POS_SED;
-        poStatusRegsVal->nCMED          =   (anReadAuxStatusBuf[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_CMED) >> ADBMS6948_STCR4_POS_CMED;
-        poStatusRegsVal->nCED           =   (anReadAuxStatusBuf[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_CED) >> ADBMS6948_STCR4_POS_CED;
-        poStatusRegsVal->nVD_UV         =   (anReadAuxStatusBuf[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_VD_UV) >> ADBMS6948_STCR4_POS_VD_UV;
-        poStatusRegsVal->nVD_OV         =   (anReadAuxStatusBuf[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_VD_OV) >> ADBMS6948_STCR4_POS_VD_OV;
-        poStatusRegsVal->nVA_UV         =   (anReadAuxStatusBuf[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_VA_UV) >> ADBMS6948_STCR4_POS_VA_UV;
-        poStatusRegsVal->nVA_OV         =   (anReadAuxStatusBuf[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_VA_OV) >> ADBMS6948_STCR4_POS_VA_OV;
-
-        poStatusRegsVal->nOscChk        =   (anReadAuxStatusBuf[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_OSCHK) >> ADBMS6948_STCR5_POS_OSCHK;
-        poStatusRegsVal->nTModChk       =   (anReadAuxStatusBuf[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_TMODCHK) >> ADBMS6948_STCR5_POS_TMODCHK;
-        poStatusRegsVal->nThSd          =   (anReadAuxStatusBuf[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_THSD) >> ADBMS6948_STCR5_POS_THSD;
-        poStatusRegsVal->nSleep         =   (anReadAuxStatusBuf[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_SLEEP) >> ADBMS6948_STCR5_POS_SLEEP;
-        poStatusRegsVal->nSpiFlt        =   (anReadAuxStatusBuf[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_SPIFLT) >> ADBMS6948_STCR5_POS_SPIFLT;
-        poStatusRegsVal->nCompV         =   (anReadAuxStatusBuf[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_COMP_V) >> ADBMS6948_STCR5_POS_COMP_V;
-        poStatusRegsVal->nVDeLatent     =   (anReadAuxStatusBuf[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_VDEL) >> ADBMS6948_STCR5_POS_VDEL;
-        poStatusRegsVal->nVDe           =   (anReadAuxStatusBuf[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_VDE) >> ADBMS6948_STCR5_POS_VDE;
-
-        nRdBufIdx += ADBMS6948_RDASALL_STATUSC_BYTES;
-
-        /*Populate the user buffer for Status Register D*/
-        poStatusRegsVal->nCellOVUVStatus  = (uint32_t)anReadAuxStatusBuf[nRdBufIdx];
-        poStatusRegsVal->nCellOVUVStatus |= (uint32_t)((uint32_t)anReadAuxStatusBuf[nRdBufIdx + 1u] << 8u);
-        poStatusRegsVal->nCellOVUVStatus |= (uint32_t)((uint32_t)anReadAuxStatusBuf[nRdBufIdx + 2u] << 16u);
-        poStatusRegsVal->nCellOVUVStatus |= (uint32_t)((uint32_t)anReadAuxStatusBuf[nRdBufIdx + 3u] << 24u);
-        poStatusRegsVal->nOscChkCnt       = anReadAuxStatusBuf[nRdBufIdx + 5u];
-
-        nRdBufIdx += ADBMS6948_RDASALL_STATUSD_BYTES;
-
-        /*Populate the user buffer for Status Register E*/
-        poStatusRegsVal->nOC1Val            = (uint16_t)(((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 1u] << 8u) |
-                                                         ((uint16_t)anReadAuxStatusBuf[nRdBufIdx]));
-        poStatusRegsVal->nOC2Val            = (uint16_t)(((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 3u] << 8u) |
-                                                         ((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 2u]));
-
-        poStatusRegsVal->nGpioPinStates     =  (uint16_t)((((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 5u] & ADBMS6948_STER5_MASK_GPI) << 8u) |
-                                                            ((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 4u]));
-
-        poStatusRegsVal->nLPCMFltBStatus    = (anReadAuxStatusBuf[nRdBufIdx + 5u] & ADBMS6948_STER5_MASK_FAULTB) >> ADBMS6948_STER5_POS_FAULTB;
-        poStatusRegsVal->nDevRevCode        = (anReadAuxStatusBuf[nRdBufIdx + 5u] & ADBMS6948_STER5_MASK_REV) >> ADBMS6948_STER5_POS_REV;
-
-        nRdBufIdx += ADBMS6948_RDASALL_STATUSE_BYTES;
-
-        /*Populate the user buffer for Status Register F*/
-        poStatusRegsVal->nVMV               = (uint16_t)(((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 1u] << 8u) |
-                                               ((uint16_t)anReadAuxStatusBuf[nRdBufIdx]));
-        poStatusRegsVal->nVP                = (uint16_t)(((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 3u] << 8u) |
-                                               ((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 2u]));
-        nRdBufIdx += ADBMS6948_RDASALL_STATUSF_BYTES;
-
-        /*Populate the user buffer for Status Register G*/
-        poStatusRegsVal->nCTV   = (uint16_t)(((uint16_t)(anReadAuxStatusBuf[nRdBufIdx + 1u] & ADBMS6948_STGR1_MASK_CT_V) >> ADBMS6948_STGR1_POS_CT_V) |
-                                             (((uint16_t)anReadAuxStatusBuf[nRdBufIdx] & ADBMS6948_STGR0_MASK_CT_V) << 6u));
-        poStatusRegsVal->nCTSV  = (anReadAuxStatusBuf[nRdBufIdx + 1u] & ADBMS6948_STGR1_MASK_CTS_V) >> ADBMS6948_STGR1_POS_CTS_V;
-        poStatusRegsVal->nCTI   = (uint16_t)(((uint16_t)(anReadAuxStatusBuf[nRdBufIdx + 3u] & ADBMS6948_STGR3_MASK_CT_I) >> ADBMS6948_STGR3_POS_CT_I) |
-                                             (((uint16_t)anReadAuxStatusBuf[nRdBufIdx + 2u] & ADBMS6948_STGR2_MASK_CT_I) << 6u));
-        poStatusRegsVal->nCTSV  = (anReadAuxStatusBuf[nRdBufIdx + 3u] & ADBMS6948_STGR3_MASK_CTS_I) >> ADBMS6948_STGR3_POS_CTS_I;
+        for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
+        {
+            if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+            {
+                pSlice = &anReadAuxStatusBuf[nDevIdx * nDataBytesLenWithPec];
+                poStatus = &poStatusRegsVal[nOutIdx];
+
+                /*Populate the user buffer for GPIO data*/
+                ADI_PAL_MEMCPY((uint8_t *)&panGpioData[nOutIdx * ADBMS6948_RDASALL_NO_OF_GPIOS], pSlice, ADBMS6948_RDASALL_GPIO_BYTES);
+                /*Populate the user buffer for Redundant GPIO data*/
+                ADI_PAL_MEMCPY((uint8_t *)&panRedundantGpioData[nOutIdx * ADBMS6948_RDASALL_NO_OF_GPIOS], pSlice + ADBMS6948_RDASALL_GPIO_BYTES, ADBMS6948_RDASALL_RD_GPIO_BYTES);
+                /*Populate the user buffer for Status Register A*/
+                nRdBufIdx = ADBMS6948_RDASALL_GPIO_BYTES + ADBMS6948_RDASALL_RD_GPIO_BYTES;
+                poStatus->nVRef2 =   (uint16_t)(((uint16_t)pSlice[nRdBufIdx + 1u] << 8u) |
+                                                 (uint16_t)pSlice[nRdBufIdx]);
+                poStatus->nITMP  =   (uint16_t)(((uint16_t)pSlice[nRdBufIdx + 3u] << 8u) |
+                                                 (uint16_t)pSlice[nRdBufIdx + 2u]);
+                poStatus->nVRef3 =   (uint16_t)(((uint16_t)pSlice[nRdBufIdx + 5u] << 8u) |
+                                                 (uint16_t)pSlice[nRdBufIdx + 4u]);
+                nRdBufIdx += ADBMS6948_RDASALL_STATUSA_BYTES;
+
+                /*Populate the user buffer for Status Register B*/
+                poStatus->nVD    =   (uint16_t)(((uint16_t)pSlice[nRdBufIdx + 1u] << 8u) |
+                                                 (uint16_t)pSlice[nRdBufIdx]);
+                poStatus->nVA    =   (uint16_t)(((uint16_t)pSlice[nRdBufIdx + 3u] << 8u) |
+                                                 (uint16_t)pSlice[nRdBufIdx + 2u]);
+                poStatus->nVR4K  =   (uint16_t)(((uint16_t)pSlice[nRdBufIdx + 5u] << 8u) |
+                                                 (uint16_t)pSlice[nRdBufIdx + 4u]);
+                nRdBufIdx += ADBMS6948_RDASALL_STATUSB_BYTES;
+
+                /*Populate the user buffer for Status Register C*/
+                poStatus->nCSxFault      =   (uint16_t)(((uint16_t)pSlice[nRdBufIdx + 1u] << 8u) |
+                                                         (uint16_t)pSlice[nRdBufIdx]);
+                poStatus->nCompI         =   (pSlice[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_COMP_I) >> ADBMS6948_STCR2_POS_COMP_I;
+                poStatus->nOC1           =   (pSlice[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_OC1) >> ADBMS6948_STCR2_POS_OC1;
+                poStatus->nOC2           =   (pSlice[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_OC2) >> ADBMS6948_STCR2_POS_OC2;
+                poStatus->nOCWarn1       =   (pSlice[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_OCW1) >> ADBMS6948_STCR2_POS_OCW1;
+                poStatus->nOCWarn2       =   (pSlice[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_OCW2) >> ADBMS6948_STCR2_POS_OCW2;
+                poStatus->nCoulCntFlt    =   (pSlice[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_CCFLT) >> ADBMS6948_STCR2_POS_CCFLT;
+                poStatus->nTimeBaseFlt   =   (pSlice[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_TB_OF) >> ADBMS6948_STCR2_POS_TB_OF;
+                poStatus->nCoulCntSeqErr =   (pSlice[nRdBufIdx + 2u] & ADBMS6948_STCR2_MASK_SEQCC) >> ADBMS6948_STCR2_POS_SEQCC;
+
+                poStatus->nSMED          =   (pSlice[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_SMED) >> ADBMS6948_STCR4_POS_SMED;
+                poStatus->nSED           =   (pSlice[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_SED) >> ADBMS6948_STCR4_POS_SED;
+                poStatus->nCMED          =   (pSlice[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_CMED) >> ADBMS6948_STCR4_POS_CMED;
+                poStatus->nCED           =   (pSlice[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_CED) >> ADBMS6948_STCR4_POS_CED;
+                poStatus->nVD_UV         =   (pSlice[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_VD_UV) >> ADBMS6948_STCR4_POS_VD_UV;
+                poStatus->nVD_OV         =   (pSlice[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_VD_OV) >> ADBMS6948_STCR4_POS_VD_OV;
+                poStatus->nVA_UV         =   (pSlice[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_VA_UV) >> ADBMS6948_STCR4_POS_VA_UV;
+                poStatus->nVA_OV         =   (pSlice[nRdBufIdx + 4u] & ADBMS6948_STCR4_MASK_VA_OV) >> ADBMS6948_STCR4_POS_VA_OV;
+
+                poStatus->nOscChk        =   (pSlice[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_OSCHK) >> ADBMS6948_STCR5_POS_OSCHK;
+                poStatus->nTModChk       =   (pSlice[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_TMODCHK) >> ADBMS6948_STCR5_POS_TMODCHK;
+                poStatus->nThSd          =   (pSlice[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_THSD) >> ADBMS6948_STCR5_POS_THSD;
+                poStatus->nSleep         =   (pSlice[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_SLEEP) >> ADBMS6948_STCR5_POS_SLEEP;
+                poStatus->nSpiFlt        =   (pSlice[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_SPIFLT) >> ADBMS6948_STCR5_POS_SPIFLT;
+                poStatus->nCompV         =   (pSlice[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_COMP_V) >> ADBMS6948_STCR5_POS_COMP_V;
+                poStatus->nVDeLatent     =   (pSlice[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_VDEL) >> ADBMS6948_STCR5_POS_VDEL;
+                poStatus->nVDe           =   (pSlice[nRdBufIdx + 5u] & ADBMS6948_STCR5_MASK_VDE) >> ADBMS6948_STCR5_POS_VDE;
+
+                nRdBufIdx += ADBMS6948_RDASALL_STATUSC_BYTES;
+
+                /*Populate the user buffer for Status Register D*/
+                poStatus->nCellOVUVStatus  = (uint32_t)pSlice[nRdBufIdx];
+                poStatus->nCellOVUVStatus |= (uint32_t)((uint32_t)pSlice[nRdBufIdx + 1u] << 8u);
+                poStatus->nCellOVUVStatus |= (uint32_t)((uint32_t)pSlice[nRdBufIdx + 2u] << 16u);
+                poStatus->nCellOVUVStatus |= (uint32_t)((uint32_t)pSlice[nRdBufIdx + 3u] << 24u);
+                poStatus->nOscChkCnt       = pSlice[nRdBufIdx + 5u];
+
+                nRdBufIdx += ADBMS6948_RDASALL_STATUSD_BYTES;
+
+                /*Populate the user buffer for Status Register E*/
+                poStatus->nOC1Val            = (uint16_t)(((uint16_t)pSlice[nRdBufIdx + 1u] << 8u) |
+                                                          ((uint16_t)pSlice[nRdBufIdx]));
+                poStatus->nOC2Val            = (uint16_t)(((uint16_t)pSlice[nRdBufIdx + 3u] << 8u) |
+                                                          ((uint16_t)pSlice[nRdBufIdx + 2u]));
+
+                poStatus->nGpioPinStates     =  (uint16_t)((((uint16_t)pSlice[nRdBufIdx + 5u] & ADBMS6948_STER5_MASK_GPI) << 8u) |
+                                                             ((uint16_t)pSlice[nRdBufIdx + 4u]));
+
+                poStatus->nLPCMFltBStatus    = (pSlice[nRdBufIdx + 5u] & ADBMS6948_STER5_MASK_FAULTB) >> ADBMS6948_STER5_POS_FAULTB;
+                poStatus->nDevRevCode        = (pSlice[nRdBufIdx + 5u] & ADBMS6948_STER5_MASK_REV) >> ADBMS6948_STER5_POS_REV;
+
+                nRdBufIdx += ADBMS6948_RDASALL_STATUSE_BYTES;
+
+                /*Populate the user buffer for Status Register F*/
+                poStatus->nVMV               = (uint16_t)(((uint16_t)pSlice[nRdBufIdx + 1u] << 8u) |
+                                                ((uint16_t)pSlice[nRdBufIdx]));
+                poStatus->nVP                = (uint16_t)(((uint16_t)pSlice[nRdBufIdx + 3u] << 8u) |
+                                                ((uint16_t)pSlice[nRdBufIdx + 2u]));
+                nRdBufIdx += ADBMS6948_RDASALL_STATUSF_BYTES;
+
+                /*Populate the user buffer for Status Register G*/
+                poStatus->nCTV   = (uint16_t)(((uint16_t)(pSlice[nRdBufIdx + 1u] & ADBMS6948_STGR1_MASK_CT_V) >> ADBMS6948_STGR1_POS_CT_V) |
+                                              (((uint16_t)pSlice[nRdBufIdx] & ADBMS6948_STGR0_MASK_CT_V) << 6u));
+                poStatus->nCTSV  = (pSlice[nRdBufIdx + 1u] & ADBMS6948_STGR1_MASK_CTS_V) >> ADBMS6948_STGR1_POS_CTS_V;
+                poStatus->nCTI   = (uint16_t)(((uint16_t)(pSlice[nRdBufIdx + 3u] & ADBMS6948_STGR3_MASK_CT_I) >> ADBMS6948_STGR3_POS_CT_I) |
+                                              (((uint16_t)pSlice[nRdBufIdx + 2u] & ADBMS6948_STGR2_MASK_CT_I) << 6u));
+                poStatus->nCTSV  = (pSlice[nRdBufIdx + 3u] & ADBMS6948_STGR3_MASK_CTS_I) >> ADBMS6948_STGR3_POS_CTS_I;
+                nOutIdx++;
+            }
+        }
     }
 return(nRet);
 }
@@ -3944,7 +4434,7 @@ static Adbms6948_ReturnType Adbms6948_lReadCoulombCountAndTimeBase
 {
     Adbms6948_ReturnType  nRet;
     uint16_t  nCmdCode;
-    uint8_t  anRdBuf[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + ADBMS6948_REG_DATA_LEN_WITH_PEC];
+    uint8_t  anRdBuf[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)];
     uint16_t  anCmdList[ADBMS6948_NUMOF_REGGRP_ONE];
     uint16_t  nTimeBase, nRdBufIdx;
     uint32_t nCoulombCnt;
@@ -4002,7 +4492,7 @@ static Adbms6948_ReturnType Adbms6948_lClearFlags
     Adbms6948_ReturnType nRet;
     uint16_t  nCmdCode;
 
-    uint8_t anWrBuf[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + ADBMS6948_REG_DATA_LEN_WITH_PEC];
+    uint8_t anWrBuf[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)];
 
     /*Set all the bits that have to be cleared*/
     anWrBuf[0][ADBMS6948_CMD_DATA_LEN] = 0xFF;
@@ -4014,7 +4504,7 @@ static Adbms6948_ReturnType Adbms6948_lClearFlags
 
     /*Send CLRFLAG command along with all the Status C flags set to clear them*/
     nCmdCode = ADBMS6948_CMD_CLRFLAG;
-    Adbms6948_Cmn_WriteRegGroup(&nCmdCode, ADBMS6948_REG_GRP_LEN, anWrBuf, 0u);
+    Adbms6948_Cmn_WriteRegGroup(&nCmdCode, ADBMS6948_REG_GRP_LEN, anWrBuf, knChainID);
 
     /*Verify command counter after issuing CLRFLAG command*/
     nRet = Adbms6948_Cmn_VerifyCmdCnt(TRUE, knChainID);
@@ -4522,6 +5012,202 @@ static boolean  Adbms6948_lIsInvalidADCSelType
     return(bRet);
 }
 
+/*****************************************************************************/
+/*!
+    @brief	Local function to classify the difference of a normal and an open
+			wire measurement.
+
+    @param [in]	nDelta			Absolute difference of the measurements.
+    @param [in]	nOpenLimit		Differences above are an open wire.
+    @param [in]	nClosedLimit	Differences below are a closed wire.
+
+    @return     ADBMS6948_OW_OPEN, ADBMS6948_OW_CLOSED or ADBMS6948_OW_UNDECIDED
+ */
+/*****************************************************************************/
+static uint8_t  Adbms6948_lGetOWStatus
+(
+	uint32_t 				nDelta,
+	uint32_t 				nOpenLimit,
+	uint32_t 				nClosedLimit
+)
+{
+	uint8_t  nStatus = ADBMS6948_OW_UNDECIDED;
+
+	if (nDelta > nOpenLimit)
+	{
+		nStatus = ADBMS6948_OW_OPEN;
+	}
+	else if (nDelta < nClosedLimit)
+	{
+		nStatus = ADBMS6948_OW_CLOSED;
+	}
+	else
+	{
+		/* Between the thresholds, leave undecided. */
+	}
+return(nStatus);
+}
+
+/*****************************************************************************/
+/*!
+	@brief	Local function to read the C-ADC and S-ADC cell voltages and the
+			C vs S faults.
+
+	@param [out] 	pnCellData		Place holder to report the C-ADC cell
+									measurement data.
+									@range: NA
+									@resolution: NA
+	@param [out] 	pnSCellData		Place holder to report the S-ADC cell
+									measurement data.
+									@range: NA
+									@resolution: NA
+	@param [out] 	pnCSFltStatus	Place holder to report the C vs S faults,
+									one per device.
+									@range: NA
+									@resolution: NA
+    @param	[in]    eSnapSel		Specifies the snapshot command/s to be sent.
+							        @range: Enumeration.
+							        @resolution: NA
+	@param 	[in] 	knChainID		Specifies ID of the daisy chain on which the
+	                        		operation is to be performed.
+									@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+									@resolution: NA
+    @return     E_OK: Success   \n
+                E_NOT_OK: Failed\n
+ */
+/*****************************************************************************/
+static Adbms6948_ReturnType Adbms6948_lReadCellVoltCS
+(
+	int16_t					*pnCellData,
+	int16_t					*pnSCellData,
+	uint16_t				*pnCSFltStatus,
+	Adbms6948_SnapSelType	eSnapSel,
+	const uint8_t			knChainID
+)
+{
+	Adbms6948_ReturnType  nRet;
+	uint8_t  anReadDataBuf[ADBMS6948_RDALL_CSVOLTAGES_BYTES * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+	uint16_t  nCmdCode, nRdBufIdx, nBufIdx = 0u;
+	uint8_t  nDataLenBytesWithPec, nDevIdx, nCellIdx;
+	boolean  bSendSnap, bSendUnsnap, bClrSent = FALSE;
+
+	bSendSnap = (boolean)((uint8_t)eSnapSel & 0x01u);
+	bSendUnsnap = (boolean)(((uint8_t)eSnapSel & 0x02u) >> 1u);
+	nDataLenBytesWithPec = Adbms6948_ReadAllCommandBytes[ADBMS6948_READALL_CSVOLTAGES];
+	if(TRUE == bSendSnap)
+	{
+		/*Send SNAP command, the results and the faults are of the same conversion */
+		nCmdCode = ADBMS6948_CMD_SNAP;
+		Adbms6948_Cmn_SendCommandOnly(nCmdCode, TRUE, knChainID);
+	}
+	/* Send RDCSVALL command, C-ADC and S-ADC results of all the cells in one frame */
+	nCmdCode = ADBMS6948_CMD_RDCSVALL;
+	nRet = Adbms6948_Cmn_ReadAllRegGroups(nCmdCode, anReadDataBuf, nDataLenBytesWithPec, knChainID);
+
+	if (E_OK == nRet)
+	{
+		/* Populate the user data buffers, the C-ADC results are followed by the S-ADC results of every device. */
+		for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
+		{
+			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+			{
+				nRdBufIdx = (uint16_t)(nDevIdx * (uint16_t)nDataLenBytesWithPec);
+				for (nCellIdx = 0u; nCellIdx < ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE; nCellIdx++)
+				{
+					pnCellData[nBufIdx] = (int16_t)(((uint16_t)anReadDataBuf[nRdBufIdx + 1u] << 8u) |
+													(uint16_t)anReadDataBuf[nRdBufIdx]);
+					pnSCellData[nBufIdx] = (int16_t)(((uint16_t)anReadDataBuf[nRdBufIdx + ADBMS6948_RDCSALL_C_BYTES + 1u] << 8u) |
+													 (uint16_t)anReadDataBuf[nRdBufIdx + ADBMS6948_RDCSALL_C_BYTES]);
+					nBufIdx++;
+					nRdBufIdx += 2u;
+				}
+			}
+		}
+
+		/* Read the C vs S faults of the same snapshot */
+		nRet = Adbms6948_lReadCSFltStatus(pnCSFltStatus, &bClrSent, knChainID);
+	}
+	if ((E_OK == nRet) && (TRUE == bSendUnsnap))
+	{
+		nCmdCode = ADBMS6948_CMD_UNSNAP;
+		Adbms6948_Cmn_SendCommandOnly(nCmdCode, TRUE, knChainID);
+	}
+
+	/*Send CLRCELL and CLRSPIN commands to clear the C-ADC and S-ADC results*/
+	nCmdCode = ADBMS6948_CMD_CLRCELL;
+	Adbms6948_Cmn_SendCommandOnly(nCmdCode, TRUE, knChainID);
+	nCmdCode = ADBMS6948_CMD_CLRSPIN;
+	Adbms6948_Cmn_SendCommandOnly(nCmdCode, TRUE, knChainID);
+
+	/* Verify the command counter as CLRCELL and CLRSPIN commands were sent*/
+	nRet |= Adbms6948_Cmn_VerifyCmdCnt(TRUE, knChainID);
+
+return(nRet);
+}
+
+/*****************************************************************************/
+/*!
+    @brief	Local function to read the C vs S faults of Status register C of
+			every device and to clear the faults that were read.
+
+    @param [out]	pnCSFltStatus  	Place holder to report the C vs S faults,
+									one per device.
+									@range: NA
+									@resolution: NA
+    @param [out]	pbClrSent  		Set to TRUE when CLRFLAG was sent, left
+									unchanged otherwise.
+									@range: NA
+									@resolution: NA
+    @param	[in]   	knChainID		Specifies ID of the daisy chain on
+									which the operation is to be performed.
+									@range: 0 to (ADBMS6948_NO_OF_DAISY_CHAIN-1)
+									@resolution: NA
+
+    @return        E_OK: 		Success \n
+                   E_NOT_OK: 	Failure \n
+ */
+/*****************************************************************************/
+static Adbms6948_ReturnType  Adbms6948_lReadCSFltStatus
+(
+	uint16_t 				*pnCSFltStatus,
+	boolean 				*pbClrSent,
+	const uint8_t  			 knChainID
+)
+{
+	Adbms6948_ReturnType  nRet;
+	uint8_t  anRdBuf[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)] = {0u};
+	uint8_t  anWrBuf[ADBMS6948_NUMOF_REGGRP_ONE][ADBMS6948_CMD_DATA_LEN + (ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)] = {0u};
+	uint16_t anCmdList[ADBMS6948_NUMOF_REGGRP_ONE], nRdBufIdx, nCSFlt, nCSFltSet = 0u;
+	uint8_t  nDevIdx, nBufIdx = 0u;
+
+	anCmdList[0u] = ADBMS6948_CMD_RDSTATC;
+	nRet = Adbms6948_Cmn_ReadRegGroup(anCmdList, anRdBuf, ADBMS6948_NUMOF_REGGRP_ONE, knChainID);
+	if (E_OK == nRet)
+	{
+		for (nDevIdx = 0u; nDevIdx < Adbms6948_aoChainStateInfo[knChainID].nCurrNoOfDevices; nDevIdx++)
+		{
+			if (ADBMS6948_DEVICE == Adbms6948_aoChainStateInfo[knChainID].Adbms6948_eDevChain[nDevIdx])
+			{
+				nRdBufIdx = (uint16_t)((uint16_t)ADBMS6948_CMD_DATA_LEN + (nDevIdx * (uint16_t)ADBMS6948_REG_DATA_LEN_WITH_PEC));
+				nCSFlt = (uint16_t)(((uint16_t)anRdBuf[0u][nRdBufIdx + 1u] << 8u) | (uint16_t)anRdBuf[0u][nRdBufIdx]);
+				pnCSFltStatus[nBufIdx++] = nCSFlt;
+				nCSFltSet |= nCSFlt;
+			}
+		}
+
+		if (0u != nCSFltSet)
+		{
+			/* CLRFLAG clears the same flags on every device, only the ones set on any device are cleared */
+			anWrBuf[0u][ADBMS6948_CMD_DATA_LEN] = (uint8_t)nCSFltSet;
+			anWrBuf[0u][ADBMS6948_CMD_DATA_LEN + 1u] = (uint8_t)(nCSFltSet >> 8u);
+			anCmdList[0u] = ADBMS6948_CMD_CLRFLAG;
+			Adbms6948_Cmn_WriteRegGroup(anCmdList, ADBMS6948_REG_GRP_LEN, anWrBuf, knChainID);
+			*pbClrSent = TRUE;
+		}
+	}
+return(nRet);
+}
+
 /*****************************************************************************/
 /*!
     @brief	Local function to read the OV/UV diagnostic flags.
@@ -561,9 +561,11 @@ const uint8_t				knChainID
 )
 {
 	Adbms6948_ReturnType nRet;
+	uint8_t anReadDataBuf[ADBMS6948_REG_DATA_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
 
-    /*Read "Always On" memory and store into data buffer*/
-    nRet = Adbms6948_Cmn_ReadAllRegGroups(ADBMS6948_CMD_RDAO, panData, ADBMS6948_REG_DATA_LEN_WITH_PEC, knChainID);
+    /*Read "Always On" memory of the chain, the data buffer receives the first device*/
+    nRet = Adbms6948_Cmn_ReadAllRegGroups(ADBMS6948_CMD_RDAO, &anReadDataBuf[0], ADBMS6948_REG_DATA_LEN_WITH_PEC, knChainID);
+    ADI_PAL_MEMCPY(panData, &anReadDataBuf[0], ADBMS6948_REG_DATA_LEN_WITH_PEC);
 
 	return nRet;
 }
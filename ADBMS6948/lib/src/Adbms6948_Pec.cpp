@@ -48,7 +48,7 @@ static const uint16_t Adbms6948_Crc15Table[256] = {0x0u,0xc599u, 0xceabu, 0xb32u
         };
 
 /* Pre-computed CRC10 Table */
-static const uint16_t  Adbms6948_Crc10Table[256] =
+static constexpr uint16_t  Adbms6948_Crc10Table[256] =
 {
     0x000, 0x08f, 0x11e, 0x191, 0x23c, 0x2b3, 0x322, 0x3ad, 0x0f7, 0x078, 0x1e9, 0x166, 0x2cb, 0x244, 0x3d5, 0x35a,
     0x1ee, 0x161, 0x0f0, 0x07f, 0x3d2, 0x35d, 0x2cc, 0x243, 0x119, 0x196, 0x007, 0x088, 0x325, 0x3aa, 0x23b, 0x2b4,
@@ -67,6 +67,102 @@ static const uint16_t  Adbms6948_Crc10Table[256] =
     0x20a, 0x285, 0x314, 0x39b, 0x036, 0x0b9, 0x128, 0x1a7, 0x2fd, 0x272, 0x3e3, 0x36c, 0x0c1, 0x04e, 0x1df, 0x150,
     0x3e4, 0x36b, 0x2fa, 0x275, 0x1d8, 0x157, 0x0c6, 0x049, 0x313, 0x39c, 0x20d, 0x282, 0x12f, 0x1a0, 0x031, 0x0be
 };
+
+/*!
+    @brief  Compile time evaluation of the 15-bit PEC of a command code, bit by bit.
+
+    @param  [in]  nCommand  11-bit command code.
+
+    @return  15-bit PEC value, left aligned.
+ */
+static constexpr uint16_t Adbms6948_lPec15CmdConst
+(
+    uint16_t  nCommand
+)
+{
+    uint16_t  nRemainder = 16u;/* initialize the PEC */
+
+    for (uint8_t nBitIndex = 16u; nBitIndex > 0u; nBitIndex--)
+    {
+        if ((((nRemainder >> 14u) ^ (nCommand >> (nBitIndex - 1u))) & 0x1u) != 0u)
+        {
+            nRemainder = (uint16_t)((uint16_t)(nRemainder << 1u) ^ (uint16_t)0x4599u);
+        }
+        else
+        {
+            nRemainder = (uint16_t)(nRemainder << 1u);
+        }
+        nRemainder = (uint16_t)(nRemainder & (uint16_t)0x7FFFu);
+    }
+    return ((uint16_t)(nRemainder << 1u));
+}
+
+/*!
+    @brief  Table of the 15-bit PEC of every command code, generated at compile time.
+ */
+typedef struct Adbms6948_CmdPecTableType
+{
+    uint16_t  anCmdPec[ADBMS6948_CMD_PEC_TABLE_SIZE];
+
+    constexpr Adbms6948_CmdPecTableType() : anCmdPec()
+    {
+        for (uint16_t nCommand = 0u; nCommand < ADBMS6948_CMD_PEC_TABLE_SIZE; nCommand++)
+        {
+            anCmdPec[nCommand] = Adbms6948_lPec15CmdConst(nCommand);
+        }
+    }
+} Adbms6948_CmdPecTableType;
+
+/* Pre-computed command PEC15 table */
+static constexpr Adbms6948_CmdPecTableType  Adbms6948_koCmdPecTable;
+
+/* RDCFGA is transmitted as 0x00 0x02 0x2B 0x0A */
+static_assert(Adbms6948_koCmdPecTable.anCmdPec[0x0002u] == (uint16_t)0x2B0Au, "Command PEC table generation failed");
+
+/*!
+    @brief  Slice tables of the CRC10, generated at compile time. aanSlice[k][x] is the remainder
+    of byte x followed by k zero bytes, so four data bytes are folded with four independent
+    lookups. anTail[x] is the remainder after shifting the 6 bit value x through the 6-bit
+    command counter tail.
+ */
+typedef struct Adbms6948_Crc10SliceTableType
+{
+    uint16_t  aanSlice[ADBMS6948_PEC10_NO_OF_SLICES][256];
+    uint16_t  anTail[64];
+
+    constexpr Adbms6948_Crc10SliceTableType() : aanSlice(), anTail()
+    {
+        for (uint16_t nTableAddr = 0u; nTableAddr < 256u; nTableAddr++)
+        {
+            aanSlice[0][nTableAddr] = Adbms6948_Crc10Table[nTableAddr];
+            for (uint8_t nSlice = 1u; nSlice < ADBMS6948_PEC10_NO_OF_SLICES; nSlice++)
+            {
+                /* Shift one zero byte through the remainder of the previous slice */
+                aanSlice[nSlice][nTableAddr] = (uint16_t)((uint16_t)((aanSlice[nSlice - 1u][nTableAddr] & 0x3u) << 8u) ^
+                                               Adbms6948_Crc10Table[aanSlice[nSlice - 1u][nTableAddr] >> 2u]);
+            }
+        }
+        for (uint16_t nTailAddr = 0u; nTailAddr < 64u; nTailAddr++)
+        {
+            uint16_t nRemainder = (uint16_t)(nTailAddr << 4u);
+            for (uint8_t nBitIndex = 6u; nBitIndex > 0u; nBitIndex--)
+            {
+                if ((nRemainder & 0x200u) > 0u)
+                {
+                    nRemainder = (uint16_t)((uint16_t)(nRemainder << 1u) ^ (uint16_t)0x8Fu);
+                }
+                else
+                {
+                    nRemainder = (uint16_t)(nRemainder << 1u);
+                }
+            }
+            anTail[nTailAddr] = (uint16_t)(nRemainder & 0x3FFu);
+        }
+    }
+} Adbms6948_Crc10SliceTableType;
+
+/* Pre-computed CRC10 slice tables */
+static constexpr Adbms6948_Crc10SliceTableType  Adbms6948_koCrc10Slices;
 /* Const 16 section stop */
 ADBMS6948_DRV_CONST_DATA_16_STOP
 
@@ -76,6 +172,44 @@ ADBMS6948_DRV_CONST_DATA_16_STOP
 /* Code section start */
 ADBMS6948_DRV_CODE_START
 
+/*!
+    @brief  This function folds a data buffer into the 10-bit CRC remainder, four bytes per step
+    with the slice tables and the remaining bytes one at a time.
+
+    @param  [in]  pDataBuf  Buffer containing the data.
+
+    @param  [in]  nLength  Length of the data buffer.
+
+    @param  [in]  nRemainder  Remainder to start from.
+
+    @return  10-bit remainder before the command counter tail.
+*/
+static uint16_t Adbms6948_lPec10Fold
+(
+const uint8_t 	*pDataBuf,
+uint8_t   	 	 nLength,
+uint16_t  	 	 nRemainder
+)
+{
+    uint8_t   nByteIndex = 0u;
+
+    /* The remainder lines up with the first byte and the upper 2 bits of the second byte */
+    while ((uint8_t)(nLength - nByteIndex) >= ADBMS6948_PEC10_NO_OF_SLICES)
+    {
+        nRemainder = (uint16_t)(Adbms6948_koCrc10Slices.aanSlice[3][((nRemainder >> 2u) ^ pDataBuf[nByteIndex]) & 0xFFu] ^
+                                Adbms6948_koCrc10Slices.aanSlice[2][(((nRemainder & 0x3u) << 6u) ^ pDataBuf[nByteIndex + 1u]) & 0xFFu] ^
+                                Adbms6948_koCrc10Slices.aanSlice[1][pDataBuf[nByteIndex + 2u]] ^
+                                Adbms6948_koCrc10Slices.aanSlice[0][pDataBuf[nByteIndex + 3u]]);
+        nByteIndex = (uint8_t)(nByteIndex + ADBMS6948_PEC10_NO_OF_SLICES);
+    }
+    for (; nByteIndex < nLength; nByteIndex++)
+    {
+        nRemainder = (uint16_t)((uint16_t)((nRemainder & 0x3u) << 8u) ^
+                                Adbms6948_Crc10Table[((nRemainder >> 2u) ^ pDataBuf[nByteIndex]) & 0xFFu]);
+    }
+    return (nRemainder);
+}
+
 /*!
     @brief  This function is used to calculate the 15-bit PEC for a data buffer. It is used for
     command words.
@@ -109,6 +243,35 @@ uint16_t Adbms6948_Pec15Calculate
     return(nRemainder * 2u);
 }
 
+/*!
+    @brief  This function returns the 15-bit PEC of a command code from the table generated at
+    compile time, without running the CRC over the command bytes.
+
+    @param  [in]  nCommand  Command code.
+
+    @return  15-bit PEC value of the command.
+ */
+uint16_t Adbms6948_Pec15Command
+(
+    uint16_t  nCommand
+)
+{
+    uint16_t  nCmdPec;
+    uint8_t   aCmd[2u];
+
+    if (nCommand < ADBMS6948_CMD_PEC_TABLE_SIZE)
+    {
+        nCmdPec = Adbms6948_koCmdPecTable.anCmdPec[nCommand];
+    }
+    else
+    {
+        aCmd[0] = (uint8_t)(nCommand >> 8u);
+        aCmd[1] = (uint8_t)(nCommand);
+        nCmdPec = Adbms6948_Pec15Calculate(&aCmd[0], 2u);
+    }
+    return (nCmdPec);
+}
+
 /*!
     @brief  This function is used to calculate the 10-bit PEC for a data buffer. It is used for
     data words.
@@ -129,38 +292,66 @@ uint8_t   	 nLength
 )
 {
     uint16_t   nRemainder = 16u;/* PEC_SEED */
-    /* x10 + x7 + x3 + x2 + x + 1 <- the CRC10 polynomial 100 1000 1111 */
-    uint16_t   nPolynomial = 0x8Fu;
-    uint8_t   nByteIndex, nBitIndex;
-    uint16_t   nTableAddr;
+    uint8_t    nCmdCnt = 0u;
 
-    for (nByteIndex = 0u; nByteIndex < nLength; ++nByteIndex)
-    {
-        /* calculate PEC table address */
-        nTableAddr = (uint16_t)(((uint16_t)(nRemainder >> 2) ^ (uint8_t)pDataBuf[nByteIndex]) &
-                (uint8_t)0xff);
-        nRemainder = (uint16_t)(((uint16_t)(nRemainder << 8)) ^ Adbms6948_Crc10Table[nTableAddr]);
-    }
+    nRemainder = Adbms6948_lPec10Fold(pDataBuf, nLength, nRemainder);
     /* If array is from received buffer add command counter to crc calculation */
     if (bIsRxCmd == TRUE)
     {
-        nRemainder ^= (uint16_t)(((uint16_t)pDataBuf[nLength] & (uint8_t)0xFC) << 2u);
+        nCmdCnt = (uint8_t)(((uint8_t)pDataBuf[nLength] & (uint8_t)0xFC) >> 2u);
     }
-    /* Perform modulo-2 division, a bit at a time */
-    for (nBitIndex = 6u; nBitIndex > 0u; --nBitIndex)
+    /* The modulo-2 division over the 6 command counter bits only depends on the upper 6 bits of
+       the remainder, the lower 4 bits are shifted out unchanged */
+    return ((uint16_t)(Adbms6948_koCrc10Slices.anTail[((nRemainder >> 4u) ^ nCmdCnt) & 0x3Fu] ^
+                       (uint16_t)((nRemainder & 0xFu) << 6u)));
+}
+
+/*!
+    @brief  This function validates the 10-bit PEC of every device slice of a received frame in
+    one pass. Each slice holds the register data followed by the PEC word, whose upper 6 bits
+    carry the command counter.
+
+    @param  [in]  pFrameBuf  Buffer containing the slices of all devices, device 0 first.
+
+    @param  [in]  nSliceLen  Length of one slice, including the 2 byte PEC word.
+
+    @param  [in]  nNoOfSlices  Number of slices in the frame.
+
+    @param  [out]  pbPecMatch  Per slice result, TRUE if the received PEC matches.
+
+    @param  [out]  pnCmdCnt  Per slice command counter received in the PEC word.
+
+    @return  Number of slices whose PEC does not match.
+*/
+uint8_t Adbms6948_Pec10ValidateSlices
+(
+uint8_t 	*pFrameBuf,
+uint8_t   	 nSliceLen,
+uint8_t   	 nNoOfSlices,
+boolean  	*pbPecMatch,
+uint8_t  	*pnCmdCnt
+)
+{
+    uint8_t    nSliceIdx, nNoOfMismatch = 0u;
+    uint8_t    nDataLen = (uint8_t)(nSliceLen - 2u);
+    uint16_t   nRcvdPec, nRemainder;
+    uint8_t    *pSlice;
+
+    for (nSliceIdx = 0u; nSliceIdx < nNoOfSlices; nSliceIdx++)
     {
-        /* Try to divide the current data bit */
-        if ((nRemainder & 0x200u) > 0u)
-        {
-            nRemainder = (uint16_t)((nRemainder << 1u));
-            nRemainder = (uint16_t)(nRemainder ^ nPolynomial);
-        }
-        else
+        pSlice = &pFrameBuf[(uint16_t)nSliceIdx * nSliceLen];
+        nRcvdPec = (uint16_t)(((uint16_t)pSlice[nDataLen] << 8u) | (uint16_t)pSlice[nDataLen + 1u]);
+        pnCmdCnt[nSliceIdx] = (uint8_t)(nRcvdPec >> 10u);
+        nRemainder = Adbms6948_lPec10Fold(pSlice, nDataLen, 16u);
+        nRemainder = (uint16_t)(Adbms6948_koCrc10Slices.anTail[((nRemainder >> 4u) ^ pnCmdCnt[nSliceIdx]) & 0x3Fu] ^
+                                (uint16_t)((nRemainder & 0xFu) << 6u));
+        pbPecMatch[nSliceIdx] = (boolean)(nRemainder == (nRcvdPec & 0x3FFu));
+        if (FALSE == pbPecMatch[nSliceIdx])
         {
-            nRemainder = (uint16_t)((nRemainder << 1u));
+            nNoOfMismatch++;
         }
     }
-    return ((uint16_t)(nRemainder & 0x3FFu));
+    return (nNoOfMismatch);
 }
 
 /* End of code section */
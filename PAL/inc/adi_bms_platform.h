@@ -16,14 +16,20 @@ Analog Devices License Agreement.
 #define ADI_BMS_PLATFORM_H_
 
 #include "Std_Types.h"
+#ifndef ADI_PAL_HOST
 #include "common.h"
 #include "mbed.h"
 #include "SPI.h"
 #include "Timer.h"
+#endif
 #include "bms_configuration.h"
 
 /*! Number of bytes of data per register group*/
 #define PAL_MUL_SPI_BUFF_SIZE 	(4+(8 * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN))
+/*! Longest "read all" response of one device, bytes including PEC (RDASALL)*/
+#define ADI_PAL_RDALL_MAX_DEV_BYTES	(84u)
+/*! Frame arena of a daisy chain, command and the longest "read all" response of the full chain*/
+#define ADI_PAL_FRAME_ARENA_SIZE	(4+(ADI_PAL_RDALL_MAX_DEV_BYTES * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN))
 /*! Delay of 8 ms in microseconds*/
 #define ADI_PAL_DELAY_8MS 		((uint32_t)8000u)
 /*! Delay of 1 ms in microseconds*/
@@ -39,17 +45,34 @@ Analog Devices License Agreement.
 #define ADI_PAL_SPIWRITE(pData, nDataLen, nChainID)					    adi_pal_SpiWrite(pData, nDataLen, nChainID)
 #define ADI_PAL_SPIWRITEREADS(pTxBuf, pRxBuf, DataCfg, nChainID)		adi_pal_SpiWriteReads(pTxBuf, pRxBuf, DataCfg, nChainID)
 #define ADI_PAL_SPIWRITEREADALL(pTxBuf, pRxBuf, nDataLen, nChainID)     adi_pal_SpiWriteReadAll(pTxBuf, pRxBuf, nDataLen, nChainID)
+#define ADI_PAL_SPIWRITEREADS_ASYNC(pTxBuf, pRxBuf, nDataLen, nChainID)  adi_pal_SpiWriteReadAsync(pTxBuf, pRxBuf, nDataLen, nChainID)
+#define ADI_PAL_SPI_TRANSFER_DONE(nChainID)                             adi_pal_IsSpiTransferDone(nChainID)
+#define ADI_PAL_SPI_TRANSFER_ABORT(nChainID)                            adi_pal_AbortSpiTransfer(nChainID)
 #define ADI_PAL_TIMERDELAY(uS, nChainID)								adi_pal_TimerDelay(uS, nChainID)
 #define ADI_PAL_ISERROR(nChainID)										adi_pal_IsError(nChainID)
 #define ADI_PAL_GET_TIMEOUT_STATUS(nChainID)                            adi_pal_GetTimeoutStatus(nChainID)
 #define ADI_PAL_TIMER_START(nDelay, nChainID)                           adi_pal_TimerStart(nDelay, nChainID)
+#define ADI_PAL_TIMER_START_CB(nDelay, pfCallback, nChainID)            adi_pal_TimerStartCallback(nDelay, pfCallback, nChainID)
+#define ADI_PAL_TIMER_STOP(nChainID)                                    adi_pal_TimerStop(nChainID)
+#define ADI_PAL_GET_TIME_US()                                           adi_pal_GetTimeUs()
 
 #define ADI_PAL_CS_Pin 
 
-extern mbed::SPI spi;
-extern Timer timer;
-extern DigitalOut chip_select;
-extern Timeout timeout;
+/*! Function called when the non-blocking timer of a daisy chain expires */
+typedef void (*adi_pal_TimerCallbackType)(uint8 nChainID);
+
+#ifndef ADI_PAL_HOST
+/*! SPI bus and chip select wired to one daisy chain. Chains may share a bus,
+    each chain needs its own chip select. */
+typedef struct
+{
+    mbed::SPI   *poSpi;             /*!< SPI bus of the daisy chain */
+    DigitalOut  *poChipSelect;      /*!< Chip select of the daisy chain */
+} adi_pal_ChainBindingType;
+
+/*! Binding of every daisy chain, indexed by chain ID. Defined by the application. */
+extern const adi_pal_ChainBindingType adi_pal_aoChainBinding[ADBMS6948_NO_OF_DAISY_CHAIN];
+#endif
 
 void adi_pal_Init
 (
@@ -112,6 +135,24 @@ uint32 nRegGrps,
 uint8 nChainID
 );
 
+void adi_pal_SpiWriteReadAsync
+(
+uint8 *pTxBuf,
+uint8 *pRxBuf,
+uint16 nDataLen,
+uint8 nChainID
+);
+
+boolean adi_pal_IsSpiTransferDone
+(
+uint8 nChainID
+);
+
+void adi_pal_AbortSpiTransfer
+(
+uint8 nChainID
+);
+
 boolean adi_pal_IsError
 (
 uint8 nChainID
@@ -139,5 +180,22 @@ uint32  nDelay,
 uint8  nChainID
 );
 
+void adi_pal_TimerStartCallback
+(
+uint32  nDelay,
+adi_pal_TimerCallbackType  pfCallback,
+uint8  nChainID
+);
+
+void adi_pal_TimerStop
+(
+uint8  nChainID
+);
+
+uint64 adi_pal_GetTimeUs
+(
+void
+);
+
 #endif /* ADI_BMS_PLATFORM_H */
 
@@ -0,0 +1,120 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+* @file   : adi_bms_sim.h
+* @brief  : Register level simulator of an ADBMS6948 daisy chain, used by the
+*           host platform layer.
+* @version: $Revision$
+* @date   : $Date$
+* Developed by: BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+#ifndef ADI_BMS_SIM_H_
+#define ADI_BMS_SIM_H_
+
+#include "Std_Types.h"
+#include "bms_configuration.h"
+
+/*! Number of simulated daisy chains */
+#define ADI_BMS_SIM_MAX_CHAINS          ADBMS6948_NO_OF_DAISY_CHAIN
+/*! Maximum number of simulated devices in the daisy chain */
+#define ADI_BMS_SIM_MAX_DEVICES         ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN
+/*! Number of cell inputs of a simulated device */
+#define ADI_BMS_SIM_NO_OF_CELLS         (16u)
+
+/*! Time to clock one byte over SPI at 2 MHz, in microseconds */
+#define ADI_BMS_SIM_SPI_BYTE_TIME_US    ((uint32_t)4u)
+/*! Conversion time of the C-ADC, in microseconds */
+#define ADI_BMS_SIM_T_CADC_US           ((uint32_t)1000u)
+/*! Conversion time of the S-ADC over all the cells, in microseconds */
+#define ADI_BMS_SIM_T_SADC_US           ((uint32_t)8000u)
+/*! Conversion time of the I1-ADC and I2-ADC, in microseconds */
+#define ADI_BMS_SIM_T_IADC_US           ((uint32_t)1000u)
+/*! Conversion time of the AUX-ADC over all the channels, in microseconds */
+#define ADI_BMS_SIM_T_AUX_US            ((uint32_t)10000u)
+/*! Time for a sleeping device to become ready after the wake-up edge, in microseconds */
+#define ADI_BMS_SIM_T_WAKE_US           ((uint32_t)400u)
+
+void adi_bms_sim_Init
+(
+uint8 nChainID,
+uint8 nNoOfDevices
+);
+
+void adi_bms_sim_Transfer
+(
+uint8 nChainID,
+const uint8 *pTxBuf,
+uint8 *pRxBuf,
+uint16 nDataLen
+);
+
+void adi_bms_sim_AdvanceTime
+(
+uint32 nPeriodInUS
+);
+
+uint64 adi_bms_sim_GetTimeUs
+(
+void
+);
+
+void adi_bms_sim_SetCellVoltage
+(
+uint8 nChainID,
+uint8 nDevIdx,
+uint8 nCellIdx,
+sint16 nCode
+);
+
+void adi_bms_sim_SetCurrent
+(
+uint8 nChainID,
+uint8 nDevIdx,
+sint32 nI1Code,
+sint32 nI2Code
+);
+
+void adi_bms_sim_SetOpenWire
+(
+uint8 nChainID,
+uint8 nDevIdx,
+uint8 nWire,
+boolean bOpen
+);
+
+void adi_bms_sim_SetSAdcError
+(
+uint8 nChainID,
+uint8 nDevIdx,
+uint8 nCellIdx,
+sint16 nErrCode
+);
+
+void adi_bms_sim_SetSleepTimeout
+(
+uint32 nTimeoutInUS
+);
+
+void adi_bms_sim_InjectPecError
+(
+uint8 nChainID,
+uint8 nDevIdx
+);
+
+uint8 adi_bms_sim_GetCmdCount
+(
+uint8 nChainID,
+uint8 nDevIdx
+);
+
+uint32 adi_bms_sim_GetFrameCount
+(
+uint8 nChainID
+);
+
+#endif /* ADI_BMS_SIM_H_ */
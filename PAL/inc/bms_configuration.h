@@ -54,6 +54,44 @@ Analog Devices License Agreement.
 #define SYS_CELL_UV_LIMIT						(-1400000) /*-1.4 V *(10^6)*/
 #define SYS_CELL_OV_LIMIT						(4100000) /*4.1 V *(10^6)*/
 
+/* Cell balancing, add ENABLE_CELL_BALANCING to SYSTEM_CONFIG_WORD; ENABLE_SOC_CELL_BALANCING targets the lowest state of charge */
+#define SYS_BAL_MIN_CELL_VOLT					(2500000) /*2.5 V *(10^6), no discharge below*/
+#define SYS_BAL_START_VOLT						(10000) /*10 mV *(10^6) above the lowest cell*/
+#define SYS_BAL_STOP_VOLT						(5000) /*5 mV *(10^6) above the lowest cell*/
+#define SYS_BAL_FULL_DUTY_VOLT					(50000) /*50 mV *(10^6) above the lowest cell*/
+#define SYS_BAL_START_SOC						(100) /*1 % *(10^2) above the lowest cell*/
+#define SYS_BAL_STOP_SOC						(50) /*0.5 % *(10^2) above the lowest cell*/
+#define SYS_BAL_FULL_DUTY_SOC					(500) /*5 % *(10^2) above the lowest cell*/
+#define SYS_BAL_PERIOD_MS						(1000)
+
+/* Charge accounting on the coulomb counter */
+#define SYS_CC_SHUNT_MICRO_OHM					(100) /*100 uOhm *(10^6)*/
+#define SYS_CC_CONV_PERIOD_NS					(1000000) /*1 ms *(10^9), I1-ADC conversion period*/
+#define SYS_CC_CAPACITY_MAH						(50000) /*50 Ah *(10^3)*/
+#define SYS_CC_INITIAL_SOC						(5000) /*50 % *(10^2)*/
+#define SYS_CC_TIME_BASE_CONV					(65535) /*Coulomb counter time base TCC, conversions*/
+#define SYS_CC_POLL_MS							(1000) /*Well below 65536 conversions*/
+
+/* State of charge estimation, first order RC model of a cell */
+#define SYS_SOC_OCV_TABLE_UV					{3000000, 3450000, 3550000, 3620000, 3680000, 3740000, \
+												 3820000, 3900000, 3980000, 4070000, 4180000} /*0 % to 100 % in 10 % steps*/
+#define SYS_SOC_R0_MICRO_OHM					(1500) /*1.5 mOhm *(10^6), series resistance*/
+#define SYS_SOC_R1_MICRO_OHM					(1000) /*1 mOhm *(10^6), RC pair resistance*/
+#define SYS_SOC_TAU1_MS							(20000) /*20 s *(10^3), RC pair time constant*/
+#define SYS_SOC_CAPACITY_MAH					(SYS_CC_CAPACITY_MAH) /*Cells in series*/
+#define SYS_SOC_PRINT_MS						(1000)
+
+/* Open wire diagnostics interleaved into the scan plan */
+#define SYS_OW_PERIOD_MS						(50) /*S-ADC pass of the odd or the even wires, every wire every 100 ms*/
+#define SYS_OW_CONFIRM_PASSES					(3) /*Agreeing passes of a wire for a verdict*/
+
+/* Cross check of the redundant C-ADC and S-ADC cell voltages */
+#define SYS_CS_PERIOD_MS						(10) /*Read of C, S and the C vs S faults, replaces the cell read*/
+#define SYS_CS_THRESHOLD						(ADBMS6948_CTH_VOLT_22_5mv) /*C vs S threshold of the devices, written by the chain configuration*/
+#define SYS_CS_MAX_DELTA_UV						(ADBMS6948_CTH_VOLT_TO_UV(SYS_CS_THRESHOLD)) /*Software comparison at the threshold of the devices*/
+#define SYS_CS_RAISE_SCANS						(5) /*Consecutive disagreeing scans raising the diagnostic of a cell*/
+#define SYS_CS_CLEAR_SCANS						(20) /*Consecutive agreeing scans clearing it*/
+
 #define SYS_GPIO_UV_LIMIT						(-1400000) /*-1.4 V *(10^6)*/
 #define SYS_GPIO_OV_LIMIT						(5000000) /*5.0 V *(10^6)*/
 
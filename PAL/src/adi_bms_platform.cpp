@@ -20,6 +20,8 @@ Analog Devices License Agreement.
  *  @{
  */
 
+#ifndef ADI_PAL_HOST
+
 /*============= I N C L U D E S =============*/
 #include "adi_bms_platform.h"
 #include "mbed.h"
@@ -36,6 +38,18 @@ Analog Devices License Agreement.
 /*! PEC length */
 #define ADBMS6948_PEC_LEN                       ((uint8_t)0x02u)
 
+/*! Shortest delay yielding the CPU to other threads, microseconds */
+#define ADI_PAL_DELAY_SLEEP_MIN_US              (2000U)
+
+/*! Non-blocking timer of a daisy chain */
+typedef struct
+{
+    uint64                      nDeadlineUs;    /*!< Expiry time on the PAL time base */
+    boolean                     bArmed;         /*!< Timer started and not stopped */
+    adi_pal_TimerCallbackType   pfCallback;     /*!< Called on expiry, NULL_PTR if none */
+    uint8                       nChainID;       /*!< Daisy chain owning the timer */
+} adi_pal_TimerSlotType;
+
 /*Uncomment below macro to print each SPI transaction data*/
 /*! Macro to enable printing of SPI values sent/received from BMS IC*/
 //#define _ADI_BMS_DEBUG_
@@ -45,24 +59,50 @@ Analog Devices License Agreement.
 /******************************************************************************/
 /* Globals */
 uint32 ErrorCounter = 0;
-uint32 timer_period = 0;
+/*! Free running time base of the non-blocking timers, never stopped nor reset */
+static Timer oPalTimeBase;
+/*! Non-blocking timer of every daisy chain */
+static adi_pal_TimerSlotType aoPalTimer[ADBMS6948_NO_OF_DAISY_CHAIN];
+/*! Expiry event of every daisy chain, attached only when a callback is given */
+static Timeout aoPalTimeout[ADBMS6948_NO_OF_DAISY_CHAIN];
+/*! Asynchronous SPI transfer in progress on every daisy chain, cleared from the SPI event handler */
+static volatile boolean abSpiTransferBusy[ADBMS6948_NO_OF_DAISY_CHAIN];
+/*! Bus of every daisy chain locked for an asynchronous transfer, until its completion is seen */
+static boolean abSpiBusLocked[ADBMS6948_NO_OF_DAISY_CHAIN];
+/*! Platform error of every daisy chain, latched until reported by adi_pal_IsError() */
+static volatile boolean abPalError[ADBMS6948_NO_OF_DAISY_CHAIN];
+/*! Receive arena of every daisy chain for "read all" frames, used under the bus lock */
+static uint8 aanPalRxArena[ADBMS6948_NO_OF_DAISY_CHAIN][ADI_PAL_FRAME_ARENA_SIZE];
 
 void Det_ReportError(uint16 ModId,uint8 InstId,uint8 ApiId,uint8 ErrCode);
 
 /*!
     @brief          Initializes the PAL layer.
 
+    Starts the time base of the non-blocking timers and stops the timer of
+    every daisy chain.
  */
 void adi_pal_Init(void)
 {
+    for (uint8_t nChainIdx = 0u; nChainIdx < ADBMS6948_NO_OF_DAISY_CHAIN; nChainIdx++) {
+        adi_pal_TimerStop(nChainIdx);
+    }
+    oPalTimeBase.start();
 }
 
 /*!
     @brief          Initializes the SPI module for BMS IC.
 
+    Deasserts the chip select of every daisy chain and sets the byte clocked
+    out after a command while the response is received. The other bus
+    settings are applied by the application.
  */
 void adi_pal_SPI_Init(void)
 {
+    for (uint8_t nChainIdx = 0u; nChainIdx < ADBMS6948_NO_OF_DAISY_CHAIN; nChainIdx++) {
+        *adi_pal_aoChainBinding[nChainIdx].poChipSelect = 1;
+        adi_pal_aoChainBinding[nChainIdx].poSpi->set_default_write_value((char)0xFF);
+    }
 }
 
 /*!
@@ -155,13 +195,14 @@ void adi_pal_SpiWrite
     uint8  nChainID
 )
 {
-    uint8_t rx_data[nDataLen];
-
-    spi.lock();
-    chip_select = 0;
-    spi.write((char *)pData, nDataLen, (char *)rx_data, nDataLen);
-    chip_select = 1;
-    spi.unlock();
+    const adi_pal_ChainBindingType *poBinding = &adi_pal_aoChainBinding[nChainID];
+
+    poBinding->poSpi->lock();
+    *poBinding->poChipSelect = 0;
+    /* Write only, the bytes clocked in are discarded by the SPI driver */
+    poBinding->poSpi->write((char *)pData, nDataLen, NULL, 0);
+    *poBinding->poChipSelect = 1;
+    poBinding->poSpi->unlock();
 #ifdef _ADI_BMS_DEBUG_
     printf("Data TX: \n");
     for(uint8 nIdx = 0; nIdx < nDataLen; ++nIdx) {
@@ -178,6 +219,12 @@ void adi_pal_SpiWrite
     @brief          Sends data and then receives the response data from BMS IC
                     over SPI.
 
+    All the register groups are transferred as one burst under a single bus
+    lock. Chip select is still toggled around every group, since the device
+    requires CS to frame each command. The response of every group is received
+    directly into the corresponding row of @c pRxBuf; bytes [3:0] of a row hold
+    whatever was clocked in during the command phase and are not used.
+
     @param[in]      pTxBuf      Pointer to the buffer to transmit.
     @param[in]      pRxBuf      Pointer to the buffer to receive data in.
     @param[in]      DataCfg     Specifies the data buffers.
@@ -191,19 +238,18 @@ void adi_pal_SpiWriteReads (uint8 pTxBuf[8][PAL_MUL_SPI_BUFF_SIZE], uint8 pRxBuf
     uint8_t reg_group_total = (DataCfg >> 16u);
     uint16_t nGroupDataLen = (uint16_t)(((uint16_t)DataCfg) - ADBMS6948_CMD_DATA_LEN);
     uint16_t data_size = (ADBMS6948_CMD_DATA_LEN + nGroupDataLen);
-    uint8_t cmd[data_size];
+    const adi_pal_ChainBindingType *poBinding = &adi_pal_aoChainBinding[knChainId];
 
+    poBinding->poSpi->lock();
     for (reg_group_cnt = 0; reg_group_cnt < reg_group_total ; reg_group_cnt++) {
-        spi.lock();
-        chip_select = 0;
-
-        memcpy(&cmd[0], &pTxBuf[reg_group_cnt][0], ADBMS6948_CMD_DATA_LEN); /* dst, src, size */
-        spi.write((char *)cmd, data_size,(char *)cmd, data_size);
-        memcpy(&pRxBuf[reg_group_cnt][ADBMS6948_CMD_DATA_LEN], &cmd[ADBMS6948_CMD_DATA_LEN], nGroupDataLen); /* dst, src, size */
+        *poBinding->poChipSelect = 0;
+        poBinding->poSpi->write((char *)&pTxBuf[reg_group_cnt][0], data_size, (char *)&pRxBuf[reg_group_cnt][0], data_size);
+        *poBinding->poChipSelect = 1;
+    }
+    poBinding->poSpi->unlock();
 
-        chip_select = 1;
-        spi.unlock();
 #ifdef _ADI_BMS_DEBUG_
+    for (reg_group_cnt = 0; reg_group_cnt < reg_group_total ; reg_group_cnt++) {
         printf("Data TX: \n");
         uint8_t nDataLen = ADBMS6948_CMD_DATA_LEN;
         for(uint8_t nIdx = 0; nIdx < nDataLen; ++nIdx) {
@@ -223,13 +269,17 @@ void adi_pal_SpiWriteReads (uint8 pTxBuf[8][PAL_MUL_SPI_BUFF_SIZE], uint8 pRxBuf
                 printf("0x%02X\n", pRxBuf[reg_group_cnt][nIdx]);
             }
         }
-#endif
     }
+#endif
 }
 
 /*!
     @brief          Write "Read All" command and receive the data over SPI.
 
+    Only the command is transmitted, the SPI driver clocks out the default
+    write value while the response is received into the frame arena of the
+    daisy chain. Responses longer than the arena are truncated.
+
     @param[in]      pTxBuf      Pointer to the transmit buffer.
     @param[in]      pRxBuf      Pointer to the receive buffer.
     @param[in]      nDataLen    Length of data to receive.
@@ -237,24 +287,164 @@ void adi_pal_SpiWriteReads (uint8 pTxBuf[8][PAL_MUL_SPI_BUFF_SIZE], uint8 pRxBuf
  */
 void adi_pal_SpiWriteReadAll(uint8 *pTxBuf, uint8 *pRxBuf, uint32 nDataLen, uint8 nChainID)
 {
-    uint16_t data_size = (ADBMS6948_CMD_DATA_LEN + nDataLen);
-    uint8_t cmd[data_size];
+    uint8 *pArena = &aanPalRxArena[nChainID][0];
+    const adi_pal_ChainBindingType *poBinding = &adi_pal_aoChainBinding[nChainID];
+
+    if (nDataLen > (ADI_PAL_FRAME_ARENA_SIZE - ADBMS6948_CMD_DATA_LEN)) {
+        nDataLen = ADI_PAL_FRAME_ARENA_SIZE - ADBMS6948_CMD_DATA_LEN;
+    }
+
+    poBinding->poSpi->lock();
+    *poBinding->poChipSelect = 0;
+    poBinding->poSpi->write((char *)pTxBuf, ADBMS6948_CMD_DATA_LEN, (char *)pArena, (int)(ADBMS6948_CMD_DATA_LEN + nDataLen));
+    *poBinding->poChipSelect = 1;
+    poBinding->poSpi->unlock();
+
+    memcpy(pRxBuf, &pArena[ADBMS6948_CMD_DATA_LEN], nDataLen); /* dst, src, size */
+}
+
+#if DEVICE_SPI_ASYNCH
+/*!
+    @brief          SPI event handler of the asynchronous transfer. Runs in
+                    interrupt context once the frame has been clocked out or
+                    the transfer has failed.
+
+    @param[in]      poBinding   Binding of the daisy chain the handler is bound to.
+    @param[in]      nEvent      SPI event flags.
+ */
+static void adi_pal_lSpiEventHandler(const adi_pal_ChainBindingType *poBinding, int nEvent)
+{
+    uint8 nChainID = (uint8)(poBinding - &adi_pal_aoChainBinding[0]);
+
+    *poBinding->poChipSelect = 1;
+    if ((nEvent & (SPI_EVENT_ERROR | SPI_EVENT_RX_OVERFLOW)) != 0) {
+        abPalError[nChainID] = TRUE;
+    }
+    abSpiTransferBusy[nChainID] = FALSE;
+}
+#endif
+
+/*!
+    @brief          Releases the bus locked for the asynchronous transfer of a
+                    daisy chain.
+
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+static void adi_pal_lSpiReleaseBus(uint8 nChainID)
+{
+    if (abSpiBusLocked[nChainID] == TRUE) {
+        abSpiBusLocked[nChainID] = FALSE;
+        adi_pal_aoChainBinding[nChainID].poSpi->unlock();
+    }
+}
 
-    spi.lock();
-    chip_select = 0;
+/*!
+    @brief          Starts the transfer of one frame to the BMS IC without
+                    waiting for it to complete. The response is received into
+                    @c pRxBuf, completion is reported through
+                    adi_pal_IsSpiTransferDone(). Both buffers must stay valid
+                    until the transfer is done.
+
+    The bus is locked against the blocking transfers of the other chains
+    until the completion is seen by adi_pal_IsSpiTransferDone(), which must
+    be called by the same thread. A transfer refused by the SPI driver or
+    ended by an SPI error latches a platform error. On targets without
+    asynchronous SPI support the frame is transferred before the function
+    returns.
+
+    @param[in]      pTxBuf      Pointer to the frame to transmit.
+    @param[in]      pRxBuf      Pointer to the buffer to receive data in.
+    @param[in]      nDataLen    Number of bytes of the frame.
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+void adi_pal_SpiWriteReadAsync
+(
+    uint8 *pTxBuf,
+    uint8 *pRxBuf,
+    uint16 nDataLen,
+    uint8  nChainID
+)
+{
+    const adi_pal_ChainBindingType *poBinding = &adi_pal_aoChainBinding[nChainID];
+
+#if DEVICE_SPI_ASYNCH
+    poBinding->poSpi->lock();
+    abSpiBusLocked[nChainID] = TRUE;
+    abSpiTransferBusy[nChainID] = TRUE;
+    *poBinding->poChipSelect = 0;
+    if (poBinding->poSpi->transfer((const char *)pTxBuf, nDataLen, (char *)pRxBuf, nDataLen,
+                                   callback(adi_pal_lSpiEventHandler, poBinding), SPI_EVENT_ALL) != 0) {
+        /* Refused, e.g. a transfer of another owner is in progress, nothing is clocked */
+        *poBinding->poChipSelect = 1;
+        abPalError[nChainID] = TRUE;
+        abSpiTransferBusy[nChainID] = FALSE;
+        adi_pal_lSpiReleaseBus(nChainID);
+    }
+#else
+    poBinding->poSpi->lock();
+    *poBinding->poChipSelect = 0;
+    poBinding->poSpi->write((char *)pTxBuf, nDataLen, (char *)pRxBuf, nDataLen);
+    *poBinding->poChipSelect = 1;
+    poBinding->poSpi->unlock();
+    abSpiTransferBusy[nChainID] = FALSE;
+#endif
+}
 
-    memcpy(&cmd[0], pTxBuf, ADBMS6948_CMD_DATA_LEN); /* dst, src, size */
-    spi.write((char *)cmd, data_size,(char *)cmd, data_size);
-    memcpy(pRxBuf, &cmd[ADBMS6948_CMD_DATA_LEN], nDataLen); /* dst, src, size */
+/*!
+    @brief          Returns the completion status of the transfer started by
+                    adi_pal_SpiWriteReadAsync(). Once done, the bus is
+                    released.
 
-    chip_select = 1;
-    spi.unlock();
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+    @return         @c TRUE  - If the transfer is complete or has failed.  \n
+                    @c FALSE - If the transfer is in progress.
+ */
+boolean adi_pal_IsSpiTransferDone
+(
+    uint8 nChainID
+)
+{
+    boolean bRet = FALSE;
 
+    if (abSpiTransferBusy[nChainID] == FALSE) {
+        adi_pal_lSpiReleaseBus(nChainID);
+        bRet = TRUE;
+    }
+    return bRet;
+}
+
+/*!
+    @brief          Stops the asynchronous transfer of a daisy chain which did
+                    not complete in time and latches a platform error. The
+                    buffers of the transfer are no longer accessed once the
+                    function returns.
+
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+void adi_pal_AbortSpiTransfer
+(
+    uint8 nChainID
+)
+{
+    const adi_pal_ChainBindingType *poBinding = &adi_pal_aoChainBinding[nChainID];
+
+    if (abSpiTransferBusy[nChainID] == TRUE) {
+#if DEVICE_SPI_ASYNCH
+        poBinding->poSpi->abort_transfer();
+#endif
+        *poBinding->poChipSelect = 1;
+        abPalError[nChainID] = TRUE;
+        abSpiTransferBusy[nChainID] = FALSE;
+    }
+    adi_pal_lSpiReleaseBus(nChainID);
 }
 
 /*!
     @brief          Returns status to indicate whether the platform layer has error.
 
+    The error of a failed or aborted asynchronous transfer is latched until
+    it is reported here.
+
     @param[in]      nChainID    Daisy chain ID to perform the operation.
     @return         @c TRUE  - If Platform error is there.  \n
                     @c FALSE - If Platform error is not there.
@@ -264,14 +454,18 @@ boolean adi_pal_IsError
     uint8 nChainID
 )
 {
-    boolean bRet = FALSE;
+    boolean bRet = abPalError[nChainID];
 
+    /* Reported once, the next operation starts without error */
+    abPalError[nChainID] = FALSE;
     return bRet;
 }
 
 /*!
-    @brief          Starts a blocking timer with @c nPeriodInUS number of
-                    microseconds as the delay.
+    @brief          Blocks the calling thread for @c nPeriodInUS number of
+                    microseconds. Delays above ADI_PAL_DELAY_SLEEP_MIN_US
+                    sleep for all but the last tick, so other threads run
+                    meanwhile; the remainder is spun on the time base.
 
     @param[in]      nPeriodInUS     Delay in microseconds.
     @param[in]      nChainID        Daisy chain ID to perform the operation.
@@ -282,8 +476,16 @@ void adi_pal_TimerDelay
     uint8  nChainID
 )
 {
-    wait_us(nPeriodInUS);
+    uint64 nEndUs = (uint64)oPalTimeBase.elapsed_time().count() + nPeriodInUS;
 
+    if(nPeriodInUS >= ADI_PAL_DELAY_SLEEP_MIN_US)
+    {
+        /* The tick may expire up to 1ms early, sleep one tick less */
+        ThisThread::sleep_for(std::chrono::milliseconds((nPeriodInUS / 1000U) - 1U));
+    }
+    while((uint64)oPalTimeBase.elapsed_time().count() < nEndUs)
+    {
+    }
 }
 
 /*!
@@ -295,11 +497,24 @@ void adi_pal_DeInit(void)
 
 }
 
+/*!
+    @brief          Expiry event of a non-blocking timer, runs in interrupt
+                    context.
+
+    @param[in]      poSlot      Timer of the daisy chain.
+ */
+static void adi_pal_lTimerExpired(adi_pal_TimerSlotType *poSlot)
+{
+    if (poSlot->pfCallback != NULL_PTR) {
+        poSlot->pfCallback(poSlot->nChainID);
+    }
+}
+
 /*!
     @brief          Returns the timeout status of non-blocking timer.
 
     @param[in]      nChainID    Daisy chain ID to perform the operation.
-    @return         @c TRUE  - If the timer has expired.    \n
+    @return         @c TRUE  - If the timer has expired or is stopped.  \n
                     @c FALSE - If the timer has not expired.
  */
 boolean adi_pal_GetTimeoutStatus
@@ -308,7 +523,7 @@ boolean adi_pal_GetTimeoutStatus
 )
 {
     boolean bRet = 1;
-    if(timer_period > timer.elapsed_time().count()) {
+    if((aoPalTimer[nChainID].bArmed == TRUE) && (aoPalTimer[nChainID].nDeadlineUs > adi_pal_GetTimeUs())) {
         bRet = 0;
     }
     return bRet;
@@ -326,8 +541,65 @@ void adi_pal_TimerStart
     uint8  nChainID
 )
 {
-    timer_period = nDelay;
-    timer.start();
+    adi_pal_TimerStartCallback(nDelay, NULL_PTR, nChainID);
+}
+
+/*!
+    @brief          Starts a non-blocking timer with the delay provided and
+                    calls @c pfCallback when it expires.
+
+    A running timer of the chain is restarted, its pending callback is
+    dropped. The callback runs in interrupt context.
+
+    @param[in]      nDelay      Delay in microseconds.
+    @param[in]      pfCallback  Function called on expiry, NULL_PTR for none.
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+void adi_pal_TimerStartCallback
+(
+    uint32  nDelay,
+    adi_pal_TimerCallbackType  pfCallback,
+    uint8  nChainID
+)
+{
+    adi_pal_TimerSlotType *poSlot = &aoPalTimer[nChainID];
+
+    aoPalTimeout[nChainID].detach();
+    poSlot->nChainID = nChainID;
+    poSlot->pfCallback = pfCallback;
+    poSlot->nDeadlineUs = adi_pal_GetTimeUs() + nDelay;
+    poSlot->bArmed = TRUE;
+    if (pfCallback != NULL_PTR) {
+        aoPalTimeout[nChainID].attach(callback(adi_pal_lTimerExpired, poSlot), std::chrono::microseconds(nDelay));
+    }
+}
+
+/*!
+    @brief          Stops the non-blocking timer of a daisy chain, its pending
+                    callback is dropped.
+
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+void adi_pal_TimerStop
+(
+    uint8  nChainID
+)
+{
+    aoPalTimeout[nChainID].detach();
+    aoPalTimer[nChainID].bArmed = FALSE;
+}
+
+/*!
+    @brief          Returns the time elapsed since adi_pal_Init().
+
+    @return         Monotonic time in microseconds.
+ */
+uint64 adi_pal_GetTimeUs
+(
+    void
+)
+{
+    return (uint64)oPalTimeBase.elapsed_time().count();
 }
 
 /*!
@@ -345,6 +617,8 @@ void Det_ReportError(uint16 ModId, uint8 InstId, uint8 ApiId, uint8 ErrCode)
 #endif
 }
 
+#endif /* ADI_PAL_HOST */
+
 /*! @} */ /*BMS Platform Abstraction Layer*/
 /*! @} */ /*Platform Abstraction Layer*/
 
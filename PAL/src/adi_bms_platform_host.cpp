@@ -0,0 +1,546 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+* @file   : adi_bms_platform_host.cpp
+* @brief  : Platform functions for building the BMS driver on a host. The SPI
+*           bus is served by the ADBMS6948 simulator and all delays run in
+*           the virtual time of the simulator. Asynchronous transfers run on
+*           a worker thread per transfer. Selected with ADI_PAL_HOST.
+* @version: $Revision$
+* @date   : $Date$
+* Developed by: BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup PAL Platform Abstraction Layer
+ *  @{
+ */
+
+/*! \addtogroup BMS_PAL BMS Platform Abstraction Layer
+ *  @{
+ */
+
+#ifdef ADI_PAL_HOST
+
+/*============= I N C L U D E S =============*/
+#include "adi_bms_platform.h"
+#include "adi_bms_sim.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+
+/*============== D E F I N E S ===============*/
+/*! Register Data length with PEC  */
+#define ADBMS6948_CMD_DATA_LEN                  ((uint8_t)0x04u)
+
+/*! Non-blocking timer of a daisy chain */
+typedef struct
+{
+    uint64                      nDeadlineUs;    /*!< Expiry time in virtual time */
+    boolean                     bArmed;         /*!< Timer started and not stopped */
+    adi_pal_TimerCallbackType   pfCallback;     /*!< Called on expiry, NULL_PTR if none or already called */
+} adi_pal_TimerSlotType;
+
+/*! Asynchronous transfer of a daisy chain */
+typedef struct
+{
+    std::thread                 oWorker;        /*!< Thread clocking the frame, joined once the transfer is seen done */
+    std::atomic<bool>           bBusy;          /*!< Transfer started and not yet complete */
+} adi_pal_AsyncXferType;
+
+/*Uncomment below macro to print each SPI transaction data*/
+/*! Macro to enable printing of SPI values sent/received from BMS IC*/
+//#define _ADI_BMS_DEBUG_
+
+/******************************************************************************/
+/****************************** PLATFORM DATA *********************************/
+/******************************************************************************/
+/* Globals */
+uint32 ErrorCounter = 0;
+/*! Non-blocking timer of every daisy chain */
+static adi_pal_TimerSlotType aoPalTimer[ADBMS6948_NO_OF_DAISY_CHAIN];
+/*! Frame arena of every daisy chain for "read all" frames */
+static uint8 aanPalFrameArena[ADBMS6948_NO_OF_DAISY_CHAIN][ADI_PAL_FRAME_ARENA_SIZE];
+/*! Asynchronous transfer of every daisy chain */
+static adi_pal_AsyncXferType aoPalAsyncXfer[ADBMS6948_NO_OF_DAISY_CHAIN];
+/*! Platform error of every daisy chain, latched until reported by adi_pal_IsError() */
+static boolean abPalError[ADBMS6948_NO_OF_DAISY_CHAIN];
+
+void Det_ReportError(uint16 ModId,uint8 InstId,uint8 ApiId,uint8 ErrCode);
+static void adi_pal_lRunExpiredTimers(void);
+static void adi_pal_lAsyncWorker(uint8 *pTxBuf, uint8 *pRxBuf, uint16 nDataLen, uint8 nChainID);
+static void adi_pal_lJoinAsync(uint8 nChainID);
+
+/*!
+    @brief          Initializes the PAL layer.
+
+ */
+void adi_pal_Init(void)
+{
+    uint8 nChainIdx;
+
+    for (nChainIdx = 0u; nChainIdx < ADBMS6948_NO_OF_DAISY_CHAIN; nChainIdx++)
+    {
+        adi_bms_sim_Init(nChainIdx, ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN);
+        adi_pal_TimerStop(nChainIdx);
+    }
+}
+
+/*!
+    @brief          Initializes the SPI module for BMS IC.
+
+ */
+void adi_pal_SPI_Init(void)
+{
+}
+
+/*!
+    @brief          Reports the development error.
+
+    @param[in]      ModId   ID of the module.
+    @param[in]      InstId  ID of the instance.
+    @param[in]      ApiId   ID of the API.
+    @param[in]      ErrCode Error code returned by the API.
+ */
+void adi_pal_ReportDevelopmentError
+(
+    uint16  ModId,
+    uint8  InstId,
+    uint8  ApiId,
+    uint8  ErrCode
+)
+{
+    Det_ReportError(ModId, InstId, ApiId, ErrCode);
+}
+
+/*!
+    @brief          Reports runtime error with Error ID and status
+
+    @param[in]      ErrorId Error ID.
+    @param[in]      Status  Status of the error.
+ */
+void adi_pal_ReportRuntimeError
+(
+    uint16  ErrorId,
+    uint8  Status
+)
+{
+    (void)ErrorId;
+    (void)Status;
+    ErrorCounter++;
+#ifdef _ADI_DEBUG_
+    printf("Runtime error- ErrID: 0x%04X, Status: 0x%02X", ErrorId, Status);
+#endif
+}
+
+/*!
+    @brief          Platform layer implementation of memset function.
+
+    @param[in]      pAddr   Pointer to the location to start setting values.
+    @param[in]      nVal    Value to set.
+    @param[in]      nSize   Number of elements to set.
+ */
+void adi_pal_Memset
+(
+    uint8 *  pAddr,
+    uint8  nVal,
+    uint32  nSize
+)
+{
+    (void) memset(pAddr, nVal, nSize);
+}
+
+/*!
+    @brief          Platform layer implementation of memcpy function.
+
+    @param[in]      pDstAddr    Pointer to the destination address.
+    @param[in]      pSrcAddr    Pointer to the source address.
+    @param[in]      nSize       Number of elements to copy.
+ */
+void adi_pal_Memcpy
+(
+    uint8 *  pDstAddr,
+    uint8 *  pSrcAddr,
+    uint32  nSize
+)
+{
+    memcpy(pDstAddr, pSrcAddr, nSize);
+}
+
+/*!
+    @brief          Transmits data pointed to by @c pData to the simulated
+                    daisy chain.
+
+    @param[in]      pData       Pointer to the data to transmit.
+    @param[in]      nDataLen    Number of bytes of data to transmit.
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+void adi_pal_SpiWrite
+(
+    uint8 *pData,
+    uint16 nDataLen,
+    uint8  nChainID
+)
+{
+    adi_bms_sim_Transfer(nChainID, pData, NULL_PTR, nDataLen);
+    adi_pal_lRunExpiredTimers();
+#ifdef _ADI_BMS_DEBUG_
+    printf("Data TX: \n");
+    for(uint8 nIdx = 0; nIdx < nDataLen; ++nIdx) {
+        if (nIdx != nDataLen-1) {
+            printf("0x%02X, ", pData[nIdx]);
+        } else {
+            printf("0x%02X\n", pData[nIdx]);
+        }
+    }
+#endif
+}
+
+/*!
+    @brief          Sends data and then receives the response data from the
+                    simulated daisy chain, one chip-select frame per register
+                    group.
+
+    @param[in]      pTxBuf      Pointer to the buffer to transmit.
+    @param[in]      pRxBuf      Pointer to the buffer to receive data in.
+    @param[in]      DataCfg     Specifies the data buffers.
+                                DataCfg[15:0]: Specifies length of all data buffer.
+                                DataCfg[31:16]: Specifies number of data buffer.
+    @param[in]      knChainId   Daisy chain ID to perform the operation.
+ */
+void adi_pal_SpiWriteReads (uint8 pTxBuf[8][PAL_MUL_SPI_BUFF_SIZE], uint8 pRxBuf[8][PAL_MUL_SPI_BUFF_SIZE],  uint32 DataCfg, uint8 knChainId )
+{
+    uint8_t reg_group_cnt;
+    uint8_t reg_group_total = (DataCfg >> 16u);
+    uint16_t data_size = (uint16_t)DataCfg;
+
+    for (reg_group_cnt = 0; reg_group_cnt < reg_group_total ; reg_group_cnt++) {
+        adi_bms_sim_Transfer(knChainId, &pTxBuf[reg_group_cnt][0], &pRxBuf[reg_group_cnt][0], data_size);
+    }
+    adi_pal_lRunExpiredTimers();
+}
+
+/*!
+    @brief          Write "Read All" command and receive the data from the
+                    simulated daisy chain.
+
+    @param[in]      pTxBuf      Pointer to the transmit buffer.
+    @param[in]      pRxBuf      Pointer to the receive buffer.
+    @param[in]      nDataLen    Length of data to receive.
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+void adi_pal_SpiWriteReadAll(uint8 *pTxBuf, uint8 *pRxBuf, uint32 nDataLen, uint8 nChainID)
+{
+    uint8 *pArena = &aanPalFrameArena[nChainID][0];
+    uint16_t data_size;
+
+    if (nDataLen > (ADI_PAL_FRAME_ARENA_SIZE - ADBMS6948_CMD_DATA_LEN)) {
+        nDataLen = ADI_PAL_FRAME_ARENA_SIZE - ADBMS6948_CMD_DATA_LEN;
+    }
+    data_size = (uint16_t)(ADBMS6948_CMD_DATA_LEN + nDataLen);
+
+    memset(pArena, 0xFF, data_size);
+    memcpy(&pArena[0], pTxBuf, ADBMS6948_CMD_DATA_LEN); /* dst, src, size */
+    adi_bms_sim_Transfer(nChainID, pArena, pArena, data_size);
+    memcpy(pRxBuf, &pArena[ADBMS6948_CMD_DATA_LEN], nDataLen); /* dst, src, size */
+    adi_pal_lRunExpiredTimers();
+}
+
+/*!
+    @brief          Starts the transfer of one frame to the simulated daisy
+                    chain on a worker thread and returns without waiting for
+                    it. Completion is reported through
+                    adi_pal_IsSpiTransferDone(). Both buffers must stay valid
+                    and the chain must not be accessed until the transfer is
+                    done, as on the target.
+
+    @param[in]      pTxBuf      Pointer to the frame to transmit.
+    @param[in]      pRxBuf      Pointer to the buffer to receive data in.
+    @param[in]      nDataLen    Number of bytes of the frame.
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+void adi_pal_SpiWriteReadAsync
+(
+    uint8 *pTxBuf,
+    uint8 *pRxBuf,
+    uint16 nDataLen,
+    uint8  nChainID
+)
+{
+    /* A transfer the caller did not wait for is finished first, one transfer per chain */
+    adi_pal_lJoinAsync(nChainID);
+    aoPalAsyncXfer[nChainID].bBusy.store(true);
+    aoPalAsyncXfer[nChainID].oWorker = std::thread(adi_pal_lAsyncWorker, pTxBuf, pRxBuf, nDataLen, nChainID);
+}
+
+/*!
+    @brief          Returns the completion status of the transfer started by
+                    adi_pal_SpiWriteReadAsync(). Once done, the worker is
+                    joined and the timers expired during the transfer run.
+
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+    @return         @c TRUE  - If the transfer is complete.  \n
+                    @c FALSE - If the transfer is in progress.
+ */
+boolean adi_pal_IsSpiTransferDone
+(
+    uint8 nChainID
+)
+{
+    boolean bRet = FALSE;
+
+    if (false == aoPalAsyncXfer[nChainID].bBusy.load())
+    {
+        adi_pal_lJoinAsync(nChainID);
+        adi_pal_lRunExpiredTimers();
+        bRet = TRUE;
+    }
+    return bRet;
+}
+
+/*!
+    @brief          Stops the asynchronous transfer of a daisy chain which did
+                    not complete in time and latches a platform error. A
+                    simulated frame cannot be cut short, it is waited for.
+
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+void adi_pal_AbortSpiTransfer
+(
+    uint8 nChainID
+)
+{
+    if (true == aoPalAsyncXfer[nChainID].bBusy.load())
+    {
+        abPalError[nChainID] = TRUE;
+    }
+    adi_pal_lJoinAsync(nChainID);
+}
+
+/*!
+    @brief          Returns status to indicate whether the platform layer has error.
+
+    The error of an aborted asynchronous transfer is latched until it is
+    reported here.
+
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+    @return         @c TRUE  - If Platform error is there.  \n
+                    @c FALSE - If Platform error is not there.
+ */
+boolean adi_pal_IsError
+(
+    uint8 nChainID
+)
+{
+    boolean bRet = abPalError[nChainID];
+
+    /* Reported once, the next operation starts without error */
+    abPalError[nChainID] = FALSE;
+    return bRet;
+}
+
+/*!
+    @brief          Advances the virtual time by @c nPeriodInUS microseconds
+                    and returns immediately.
+
+    @param[in]      nPeriodInUS     Delay in microseconds.
+    @param[in]      nChainID        Daisy chain ID to perform the operation.
+ */
+void adi_pal_TimerDelay
+(
+    uint32 nPeriodInUS,
+    uint8  nChainID
+)
+{
+    (void)nChainID;
+    adi_bms_sim_AdvanceTime(nPeriodInUS);
+    adi_pal_lRunExpiredTimers();
+}
+
+/*!
+    @brief          De-initializes the PAL layer.
+
+ */
+void adi_pal_DeInit(void)
+{
+    uint8 nChainIdx;
+
+    for (nChainIdx = 0u; nChainIdx < ADBMS6948_NO_OF_DAISY_CHAIN; nChainIdx++)
+    {
+        adi_pal_lJoinAsync(nChainIdx);
+    }
+}
+
+/*!
+    @brief          Clocks a frame of an asynchronous transfer. Runs on the
+                    worker thread; the bus time of the frame is also spent in
+                    real time, so the caller sees the transfer in progress.
+
+    @param[in]      pTxBuf      Pointer to the frame to transmit.
+    @param[in]      pRxBuf      Pointer to the buffer to receive data in.
+    @param[in]      nDataLen    Number of bytes of the frame.
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+static void adi_pal_lAsyncWorker(uint8 *pTxBuf, uint8 *pRxBuf, uint16 nDataLen, uint8 nChainID)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds((uint32)nDataLen * ADI_BMS_SIM_SPI_BYTE_TIME_US));
+    adi_bms_sim_Transfer(nChainID, pTxBuf, pRxBuf, nDataLen);
+    aoPalAsyncXfer[nChainID].bBusy.store(false);
+}
+
+/*!
+    @brief          Waits for the worker of the last asynchronous transfer of
+                    a daisy chain to finish.
+
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+static void adi_pal_lJoinAsync(uint8 nChainID)
+{
+    if (aoPalAsyncXfer[nChainID].oWorker.joinable())
+    {
+        aoPalAsyncXfer[nChainID].oWorker.join();
+    }
+}
+
+/*!
+    @brief          Calls the callback of every timer whose deadline has been
+                    reached. Runs after every PAL call advancing the virtual
+                    time, the callbacks run late by at most that call.
+ */
+static void adi_pal_lRunExpiredTimers(void)
+{
+    adi_pal_TimerCallbackType pfCallback;
+    uint8 nChainIdx;
+
+    for (nChainIdx = 0u; nChainIdx < ADBMS6948_NO_OF_DAISY_CHAIN; nChainIdx++)
+    {
+        pfCallback = aoPalTimer[nChainIdx].pfCallback;
+        if ((TRUE == aoPalTimer[nChainIdx].bArmed) && (NULL_PTR != pfCallback) &&
+            (aoPalTimer[nChainIdx].nDeadlineUs <= adi_bms_sim_GetTimeUs()))
+        {
+            /* Once per start, the callback may restart the timer */
+            aoPalTimer[nChainIdx].pfCallback = NULL_PTR;
+            pfCallback(nChainIdx);
+        }
+    }
+}
+
+/*!
+    @brief          Returns the timeout status of non-blocking timer, measured
+                    in virtual time.
+
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+    @return         @c TRUE  - If the timer has expired or is stopped.  \n
+                    @c FALSE - If the timer has not expired.
+ */
+boolean adi_pal_GetTimeoutStatus
+(
+    uint8 nChainID
+)
+{
+    boolean bRet = 1;
+    if((TRUE == aoPalTimer[nChainID].bArmed) && (aoPalTimer[nChainID].nDeadlineUs > adi_bms_sim_GetTimeUs())) {
+        bRet = 0;
+    }
+    return bRet;
+}
+
+/*!
+    @brief          Starts a non-blocking timer with the delay provided
+
+    @param[in]      nDelay      Delay in microseconds.
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+void adi_pal_TimerStart
+(
+    uint32  nDelay,
+    uint8  nChainID
+)
+{
+    adi_pal_TimerStartCallback(nDelay, NULL_PTR, nChainID);
+}
+
+/*!
+    @brief          Starts a non-blocking timer with the delay provided and
+                    calls @c pfCallback once the virtual time reaches it.
+
+    A running timer of the chain is restarted, its pending callback is
+    dropped.
+
+    @param[in]      nDelay      Delay in microseconds.
+    @param[in]      pfCallback  Function called on expiry, NULL_PTR for none.
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+void adi_pal_TimerStartCallback
+(
+    uint32  nDelay,
+    adi_pal_TimerCallbackType  pfCallback,
+    uint8  nChainID
+)
+{
+    aoPalTimer[nChainID].pfCallback = pfCallback;
+    aoPalTimer[nChainID].nDeadlineUs = adi_bms_sim_GetTimeUs() + nDelay;
+    aoPalTimer[nChainID].bArmed = TRUE;
+}
+
+/*!
+    @brief          Stops the non-blocking timer of a daisy chain, its pending
+                    callback is dropped.
+
+    @param[in]      nChainID    Daisy chain ID to perform the operation.
+ */
+void adi_pal_TimerStop
+(
+    uint8  nChainID
+)
+{
+    aoPalTimer[nChainID].bArmed = FALSE;
+    aoPalTimer[nChainID].pfCallback = NULL_PTR;
+}
+
+/*!
+    @brief          Returns the virtual time of the simulator.
+
+    @return         Monotonic time in microseconds.
+ */
+uint64 adi_pal_GetTimeUs
+(
+    void
+)
+{
+    return adi_bms_sim_GetTimeUs();
+}
+
+/*!
+    @brief          This function reports the error reported by a BMS service
+
+    @param[in]      ModId   Module ID
+    @param[in]      InstId  Instance ID
+    @param[in]      ApiId   API ID
+    @param[in]      ErrCode Error code
+ */
+void Det_ReportError(uint16 ModId, uint8 InstId, uint8 ApiId, uint8 ErrCode)
+{
+    (void)ModId;
+    (void)InstId;
+    (void)ApiId;
+    (void)ErrCode;
+#ifdef _ADI_DEBUG_
+    printf("ModId: %d, InstId: %d, ApiId: %d, Errcode: %d\n", ModId, InstId, ApiId, ErrCode);
+#endif
+}
+
+#endif /* ADI_PAL_HOST */
+
+/*! @} */ /*BMS Platform Abstraction Layer*/
+/*! @} */ /*Platform Abstraction Layer*/
+
+/*
+ *
+ * EOF: $URL$
+ *
+*/
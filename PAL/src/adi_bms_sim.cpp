@@ -0,0 +1,1361 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+* @file   : adi_bms_sim.cpp
+* @brief  : Register level simulator of an ADBMS6948 daisy chain, used by the
+*           host platform layer.
+* @version: $Revision$
+* @date   : $Date$
+* Developed by: BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup PAL Platform Abstraction Layer
+ *  @{
+ */
+
+/*! \addtogroup BMS_PAL_SIM BMS Device Simulator
+ *  @{
+ */
+
+#ifdef ADI_PAL_HOST
+
+/*============= I N C L U D E S =============*/
+#include "adi_bms_sim.h"
+#include "Adbms6948_Common.h"
+#include <atomic>
+
+/*============== D E F I N E S ===============*/
+/*! Command length with PEC */
+#define ADI_BMS_SIM_CMD_LEN             (4u)
+/*! Register group data length without PEC */
+#define ADI_BMS_SIM_GRP_LEN             (6u)
+/*! Register group data length with PEC */
+#define ADI_BMS_SIM_GRP_LEN_WITH_PEC    (8u)
+/*! Number of register groups held as plain storage (configuration, PWM, COMM, CM, AO) */
+#define ADI_BMS_SIM_NO_OF_STORED_GRPS   (16u)
+/*! Maximum payload of a read all command per device, without PEC */
+#define ADI_BMS_SIM_MAX_PAYLOAD_LEN     (96u)
+/*! Maximum length of a frame */
+#define ADI_BMS_SIM_MAX_FRAME_LEN       (ADI_BMS_SIM_CMD_LEN + (ADI_BMS_SIM_MAX_DEVICES * (ADI_BMS_SIM_MAX_PAYLOAD_LEN + 2u)))
+/*! Maximum value of the command counter */
+#define ADI_BMS_SIM_MAX_CMD_CNT         (0x3Fu)
+/*! Value of a cleared voltage result register */
+#define ADI_BMS_SIM_CLEARED_CODE        ((sint16)0x8000)
+/*! Conversion counter wraps after 11 bits */
+#define ADI_BMS_SIM_CT_MASK             (0x7FFu)
+/*! Offset of the signed cell voltage codes, code plus offset is the cell voltage in steps of 150 uV */
+#define ADI_BMS_SIM_CODE_OFFSET         (10000)
+/*! Open wire switch selection of the S-ADC command, even channels */
+#define ADI_BMS_SIM_OW_EVEN             (0x01u)
+/*! Open wire switch selection of the S-ADC command, odd channels */
+#define ADI_BMS_SIM_OW_ODD              (0x02u)
+/*! Mask of the C vs S comparison threshold in CFGA byte 0 */
+#define ADI_BMS_SIM_CTH_MASK            (0x07u)
+/*! C and S comparison done, STATC byte 5 */
+#define ADI_BMS_SIM_STATC_COMP_V        (0x20u)
+
+/*! ADCs of the simulated device */
+typedef enum
+{
+    ADI_BMS_SIM_ADC_C = 0u,     /*!< Cell voltage ADC */
+    ADI_BMS_SIM_ADC_S,          /*!< Redundant cell voltage ADC */
+    ADI_BMS_SIM_ADC_I1,         /*!< Current ADC 1 */
+    ADI_BMS_SIM_ADC_I2,         /*!< Current ADC 2 */
+    ADI_BMS_SIM_ADC_AUX,        /*!< Auxiliary ADC */
+    ADI_BMS_SIM_ADC_AUX2,       /*!< Redundant auxiliary ADC */
+    ADI_BMS_SIM_NO_OF_ADC
+} adi_bms_sim_AdcType;
+
+/*! State of one ADC. All devices of the chain receive the same commands, hence
+    the conversions run in lock step and are tracked once for the chain. */
+typedef struct
+{
+    uint64  nStartUs;       /*!< Time at which the conversion was triggered */
+    uint32  nConvUs;        /*!< Conversion time */
+    uint16  nBaseCnt;       /*!< Conversion count at the trigger */
+    uint16  nConvCnt;       /*!< Number of completed conversions */
+    boolean bActive;        /*!< Conversion in progress or continuous mode */
+    boolean bCont;          /*!< Continuous mode */
+    boolean bRedundant;     /*!< C-ADC conversion also runs the S-ADC */
+} adi_bms_sim_AdcStateType;
+
+/*! State of one simulated device */
+typedef struct
+{
+    uint8   nCmdCnt;                                                /*!< Command counter */
+    uint8   aaStoredGrp[ADI_BMS_SIM_NO_OF_STORED_GRPS][ADI_BMS_SIM_GRP_LEN]; /*!< Plain register groups */
+    sint16  anCellIn[ADI_BMS_SIM_NO_OF_CELLS];                      /*!< Cell inputs */
+    sint32  nI1In;                                                  /*!< I1 input */
+    sint32  nI2In;                                                  /*!< I2 input */
+    sint16  anCellC[ADI_BMS_SIM_NO_OF_CELLS];                       /*!< C-ADC results */
+    sint16  anCellAvg[ADI_BMS_SIM_NO_OF_CELLS];                     /*!< Averaged C-ADC results */
+    sint16  anCellS[ADI_BMS_SIM_NO_OF_CELLS];                       /*!< S-ADC results */
+    sint16  anCellFilt[ADI_BMS_SIM_NO_OF_CELLS];                    /*!< Filtered C-ADC results */
+    sint32  nI1;                                                    /*!< I1 result */
+    sint32  nI2;                                                    /*!< I2 result */
+    sint32  nI1Avg;                                                 /*!< Averaged I1 result */
+    sint32  nI2Avg;                                                 /*!< Averaged I2 result */
+    boolean bInjectPecErr;                                          /*!< Corrupt the next read response */
+    uint32  nOpenWires;                                             /*!< Open cell wires, bit n for wire Cn */
+    sint16  anSErr[ADI_BMS_SIM_NO_OF_CELLS];                        /*!< Error of the S-ADC channels, codes */
+    uint16  nCSFlt;                                                 /*!< Latched C vs S faults, bit n for cell n + 1 */
+    boolean bCompV;                                                 /*!< A redundant conversion compared C and S */
+} adi_bms_sim_DeviceType;
+
+/*! State of one simulated daisy chain */
+typedef struct
+{
+    adi_bms_sim_DeviceType   aoDevice[ADI_BMS_SIM_MAX_DEVICES];  /*!< Devices, device 0 first */
+    adi_bms_sim_AdcStateType aoAdc[ADI_BMS_SIM_NO_OF_ADC];       /*!< ADCs of the chain */
+    uint8   nNoOfDevices;                                        /*!< Number of devices */
+    uint64  nLastActivityUs;                                     /*!< Time of the last transfer */
+    uint64  nReadyAtUs;                                          /*!< Time at which the devices are awake */
+    uint32  nFrameCnt;                                           /*!< Number of transferred frames */
+    boolean bSnap;                                               /*!< Results frozen by SNAP */
+    uint16  nSnapVoltCT;                                         /*!< C-ADC conversion count at SNAP */
+    uint16  nSnapCurrCT;                                         /*!< I1-ADC conversion count at SNAP */
+    uint8   nSOWSel;                                             /*!< Open wire switches of the S-ADC conversion */
+} adi_bms_sim_ChainType;
+
+/******************************************************************************/
+/****************************** SIMULATOR DATA ********************************/
+/******************************************************************************/
+static adi_bms_sim_ChainType     adi_bms_sim_aoChain[ADI_BMS_SIM_MAX_CHAINS];
+/*! Chain addressed by the public function being executed */
+static adi_bms_sim_ChainType     *adi_bms_sim_poChain = &adi_bms_sim_aoChain[0];
+/*! Virtual time, read by the PAL timers while a worker thread clocks an asynchronous frame */
+static std::atomic<uint64>  adi_bms_sim_nTimeUs(0u);
+static uint32  adi_bms_sim_nSleepTimeoutUs = 0u;
+
+/*! Write commands of the plain register groups, indexed by storage slot */
+static const uint16 adi_bms_sim_anWrCmd[ADI_BMS_SIM_NO_OF_STORED_GRPS] =
+{
+    ADBMS6948_CMD_WRCFGA, ADBMS6948_CMD_WRCFGB, ADBMS6948_CMD_WRCFGC, ADBMS6948_CMD_WRCFGD,
+    ADBMS6948_CMD_WRCFGE, ADBMS6948_CMD_WRCFGF, ADBMS6948_CMD_WRCFGG, ADBMS6948_CMD_WRCFGH,
+    ADBMS6948_CMD_WRCFGI, ADBMS6948_CMD_WRPWMA, ADBMS6948_CMD_WRPWMB, ADBMS6948_CMD_WRCOMM,
+    ADBMS6948_CMD_WRCMCFG, ADBMS6948_CMD_WRCMCELLT, ADBMS6948_CMD_WRCMGPIOT, ADBMS6948_CMD_WRAO
+};
+
+/*! Read commands of the plain register groups, indexed by storage slot */
+static const uint16 adi_bms_sim_anRdCmd[ADI_BMS_SIM_NO_OF_STORED_GRPS] =
+{
+    ADBMS6948_CMD_RDCFGA, ADBMS6948_CMD_RDCFGB, ADBMS6948_CMD_RDCFGC, ADBMS6948_CMD_RDCFGD,
+    ADBMS6948_CMD_RDCFGE, ADBMS6948_CMD_RDCFGF, ADBMS6948_CMD_RDCFGG, ADBMS6948_CMD_RDCFGH,
+    ADBMS6948_CMD_RDCFGI, ADBMS6948_CMD_RDPWMA, ADBMS6948_CMD_RDPWMB, ADBMS6948_CMD_RDCOMM,
+    ADBMS6948_CMD_RDCMCFG, ADBMS6948_CMD_RDCMCELLT, ADBMS6948_CMD_RDCMGPIOT, ADBMS6948_CMD_RDAO
+};
+
+/*! C vs S comparison thresholds of the CTH setting, codes of 150 uV */
+static const sint16 adi_bms_sim_anCthCode[ADI_BMS_SIM_CTH_MASK + 1u] =
+{
+    34, 54, 67, 100, 150, 300, 500, 900
+};
+
+/*! Read commands of the cell voltage register groups A to F */
+static const uint16 adi_bms_sim_aanCellGrpCmd[4u][6u] =
+{
+    {ADBMS6948_CMD_RDCVA, ADBMS6948_CMD_RDCVB, ADBMS6948_CMD_RDCVC, ADBMS6948_CMD_RDCVD, ADBMS6948_CMD_RDCVE, ADBMS6948_CMD_RDCVF},
+    {ADBMS6948_CMD_RDACA, ADBMS6948_CMD_RDACB, ADBMS6948_CMD_RDACC, ADBMS6948_CMD_RDACD, ADBMS6948_CMD_RDACE, ADBMS6948_CMD_RDACF},
+    {ADBMS6948_CMD_RDSVA, ADBMS6948_CMD_RDSVB, ADBMS6948_CMD_RDSVC, ADBMS6948_CMD_RDSVD, ADBMS6948_CMD_RDSVE, ADBMS6948_CMD_RDSVF},
+    {ADBMS6948_CMD_RDFCA, ADBMS6948_CMD_RDFCB, ADBMS6948_CMD_RDFCC, ADBMS6948_CMD_RDFCD, ADBMS6948_CMD_RDFCE, ADBMS6948_CMD_RDFCF}
+};
+
+/*! Register groups which read back as zero */
+static const uint16 adi_bms_sim_anZeroGrpCmd[] =
+{
+    ADBMS6948_CMD_RDAUXA, ADBMS6948_CMD_RDAUXB, ADBMS6948_CMD_RDAUXC, ADBMS6948_CMD_RDAUXD,
+    ADBMS6948_CMD_RDRAXA, ADBMS6948_CMD_RDRAXB, ADBMS6948_CMD_RDRAXC, ADBMS6948_CMD_RDRAXD,
+    ADBMS6948_CMD_RDSTATA, ADBMS6948_CMD_RDSTATB, ADBMS6948_CMD_RDSTATD,
+    ADBMS6948_CMD_RDSTATE, ADBMS6948_CMD_RDSTATF, ADBMS6948_CMD_RDCMFLAG, ADBMS6948_CMD_RDCT
+};
+
+/*! Commands without data which are executed and increment the command counter */
+static const uint16 adi_bms_sim_anActionCmd[] =
+{
+    ADBMS6948_CMD_CLRCELL, ADBMS6948_CMD_CLRCI, ADBMS6948_CMD_CLRSI, ADBMS6948_CMD_CLRCC,
+    ADBMS6948_CMD_CLRFC, ADBMS6948_CMD_CLRAUX, ADBMS6948_CMD_CLRSPIN, ADBMS6948_CMD_CLRFLAG,
+    ADBMS6948_CMD_CLOVUV, ADBMS6948_CMD_STCOMM, ADBMS6948_CMD_MUTE,
+    ADBMS6948_CMD_UNMUTE, ADBMS6948_CMD_SNAP, ADBMS6948_CMD_UNSNAP, ADBMS6948_CMD_CMDIS,
+    ADBMS6948_CMD_CMEN, ADBMS6948_CMD_CMHB, ADBMS6948_CMD_CMCLRFLAG, ADBMS6948_CMD_ULAO
+};
+
+/*============= L O C A L  F U N C T I O N S =============*/
+/*!
+    @brief          Bitwise PEC15 of the command bytes. Deliberately independent
+                    of the table driven implementation of the driver.
+
+    @param[in]      pData       Pointer to the data.
+    @param[in]      nLen        Number of bytes.
+    @return         PEC15 left aligned in 16 bits.
+ */
+static uint16 adi_bms_sim_lPec15
+(
+    const uint8 *pData,
+    uint16 nLen
+)
+{
+    uint16 nRem = 16u;
+    uint16 nIdx;
+    uint8  nBit;
+
+    for (nIdx = 0u; nIdx < nLen; nIdx++)
+    {
+        nRem ^= (uint16)((uint16)pData[nIdx] << 7u);
+        for (nBit = 0u; nBit < 8u; nBit++)
+        {
+            if (0u != (nRem & 0x4000u))
+            {
+                nRem = (uint16)((nRem << 1u) ^ 0x4599u);
+            }
+            else
+            {
+                nRem = (uint16)(nRem << 1u);
+            }
+        }
+        nRem &= 0x7FFFu;
+    }
+return ((uint16)(nRem << 1u));
+}
+
+/*!
+    @brief          Bitwise PEC10 of register data followed by the 6 bit
+                    command counter.
+
+    @param[in]      pData       Pointer to the data.
+    @param[in]      nLen        Number of data bytes.
+    @param[in]      nCmdCnt     Command counter covered by the PEC, 0 for written data.
+    @return         PEC10.
+ */
+static uint16 adi_bms_sim_lPec10
+(
+    const uint8 *pData,
+    uint16 nLen,
+    uint8 nCmdCnt
+)
+{
+    uint16 nRem = 16u;
+    uint16 nIdx;
+    uint8  nBit;
+
+    for (nIdx = 0u; nIdx < nLen; nIdx++)
+    {
+        nRem ^= (uint16)((uint16)pData[nIdx] << 2u);
+        for (nBit = 0u; nBit < 8u; nBit++)
+        {
+            if (0u != (nRem & 0x200u))
+            {
+                nRem = (uint16)((nRem << 1u) ^ 0x8Fu);
+            }
+            else
+            {
+                nRem = (uint16)(nRem << 1u);
+            }
+        }
+        nRem &= 0x3FFu;
+    }
+    nRem ^= (uint16)((uint16)(nCmdCnt & ADI_BMS_SIM_MAX_CMD_CNT) << 4u);
+    for (nBit = 0u; nBit < 6u; nBit++)
+    {
+        if (0u != (nRem & 0x200u))
+        {
+            nRem = (uint16)((nRem << 1u) ^ 0x8Fu);
+        }
+        else
+        {
+            nRem = (uint16)(nRem << 1u);
+        }
+    }
+return ((uint16)(nRem & 0x3FFu));
+}
+
+/*!
+    @brief          Searches a command in a table.
+
+    @param[in]      pnTable     Command table.
+    @param[in]      nSize       Number of entries.
+    @param[in]      nCmd        Command to search.
+    @return         Index of the command, @c nSize if not found.
+ */
+static uint8 adi_bms_sim_lFindCmd
+(
+    const uint16 *pnTable,
+    uint8 nSize,
+    uint16 nCmd
+)
+{
+    uint8 nIdx;
+
+    for (nIdx = 0u; nIdx < nSize; nIdx++)
+    {
+        if (pnTable[nIdx] == nCmd)
+        {
+            break;
+        }
+    }
+return (nIdx);
+}
+
+/*!
+    @brief          Resets a device to its power-on state. The inputs are kept.
+
+    @param[in]      pDev        Device to reset.
+ */
+static void adi_bms_sim_lResetDevice
+(
+    adi_bms_sim_DeviceType *pDev
+)
+{
+    uint8 nCellIdx;
+
+    pDev->nCmdCnt = 0u;
+    (void) memset(&pDev->aaStoredGrp[0][0], 0, sizeof(pDev->aaStoredGrp));
+    for (nCellIdx = 0u; nCellIdx < ADI_BMS_SIM_NO_OF_CELLS; nCellIdx++)
+    {
+        pDev->anCellC[nCellIdx]    = ADI_BMS_SIM_CLEARED_CODE;
+        pDev->anCellAvg[nCellIdx]  = ADI_BMS_SIM_CLEARED_CODE;
+        pDev->anCellS[nCellIdx]    = ADI_BMS_SIM_CLEARED_CODE;
+        pDev->anCellFilt[nCellIdx] = ADI_BMS_SIM_CLEARED_CODE;
+    }
+    pDev->nI1    = 0;
+    pDev->nI2    = 0;
+    pDev->nI1Avg = 0;
+    pDev->nI2Avg = 0;
+    pDev->bInjectPecErr = FALSE;
+    pDev->nCSFlt = 0u;
+    pDev->bCompV = FALSE;
+}
+
+/*!
+    @brief          Resets the chain: all devices and the ADC state.
+ */
+static void adi_bms_sim_lResetChain
+(
+    void
+)
+{
+    uint8 nDevIdx;
+
+    for (nDevIdx = 0u; nDevIdx < ADI_BMS_SIM_MAX_DEVICES; nDevIdx++)
+    {
+        adi_bms_sim_lResetDevice(&adi_bms_sim_poChain->aoDevice[nDevIdx]);
+    }
+    (void) memset(&adi_bms_sim_poChain->aoAdc[0], 0, sizeof(adi_bms_sim_poChain->aoAdc));
+    adi_bms_sim_poChain->bSnap = FALSE;
+}
+
+/*!
+    @brief          Applies the open wires to the S-ADC results of a device.
+
+    An open wire Cn whose switch is on is pulled to the wire below it, so
+    cell n reads 0 V and cell n+1 reads the sum of both cells. An open wire
+    whose switch is off keeps its voltage and reads normally.
+
+    @param[in,out]  pDev        Device whose S-ADC results were latched.
+ */
+static void adi_bms_sim_lApplyOpenWires
+(
+    adi_bms_sim_DeviceType *pDev
+)
+{
+    uint8  nWire;
+    uint8  nSwitch;
+    sint32 nSum;
+
+    for (nWire = 1u; nWire <= ADI_BMS_SIM_NO_OF_CELLS; nWire++)
+    {
+        nSwitch = ((nWire & 1u) == 0u) ? ADI_BMS_SIM_OW_EVEN : ADI_BMS_SIM_OW_ODD;
+        if ((0u != (pDev->nOpenWires & ((uint32)1u << nWire))) && (0u != (adi_bms_sim_poChain->nSOWSel & nSwitch)))
+        {
+            pDev->anCellS[nWire - 1u] = (sint16)(-ADI_BMS_SIM_CODE_OFFSET);
+            if (nWire < ADI_BMS_SIM_NO_OF_CELLS)
+            {
+                nSum = (sint32)pDev->anCellIn[nWire - 1u] + (sint32)pDev->anCellIn[nWire] + ADI_BMS_SIM_CODE_OFFSET;
+                pDev->anCellS[nWire] = (sint16)((nSum > 0x7FFF) ? 0x7FFF : nSum);
+            }
+        }
+    }
+}
+
+/*!
+    @brief          Latches the inputs into the result registers of an ADC.
+
+    @param[in]      eAdc        ADC whose conversion completed.
+ */
+static void adi_bms_sim_lLatchResults
+(
+    adi_bms_sim_AdcType eAdc
+)
+{
+    uint8 nDevIdx, nCellIdx;
+    sint32 nDelta;
+    adi_bms_sim_DeviceType *pDev;
+
+    for (nDevIdx = 0u; nDevIdx < adi_bms_sim_poChain->nNoOfDevices; nDevIdx++)
+    {
+        pDev = &adi_bms_sim_poChain->aoDevice[nDevIdx];
+        switch (eAdc)
+        {
+            case ADI_BMS_SIM_ADC_C:
+                for (nCellIdx = 0u; nCellIdx < ADI_BMS_SIM_NO_OF_CELLS; nCellIdx++)
+                {
+                    /* The inputs are static, so the average and the filter settle on the input */
+                    pDev->anCellC[nCellIdx]    = pDev->anCellIn[nCellIdx];
+                    pDev->anCellAvg[nCellIdx]  = pDev->anCellIn[nCellIdx];
+                    pDev->anCellFilt[nCellIdx] = pDev->anCellIn[nCellIdx];
+                    if (TRUE == adi_bms_sim_poChain->aoAdc[ADI_BMS_SIM_ADC_C].bRedundant)
+                    {
+                        pDev->anCellS[nCellIdx] = (sint16)(pDev->anCellIn[nCellIdx] + pDev->anSErr[nCellIdx]);
+                        nDelta = (sint32)pDev->anCellC[nCellIdx] - (sint32)pDev->anCellS[nCellIdx];
+                        if (((nDelta < 0) ? -nDelta : nDelta) > adi_bms_sim_anCthCode[pDev->aaStoredGrp[0][0] & ADI_BMS_SIM_CTH_MASK])
+                        {
+                            pDev->nCSFlt |= (uint16)(1u << nCellIdx);
+                        }
+                        pDev->bCompV = TRUE;
+                    }
+                }
+                break;
+            case ADI_BMS_SIM_ADC_S:
+                for (nCellIdx = 0u; nCellIdx < ADI_BMS_SIM_NO_OF_CELLS; nCellIdx++)
+                {
+                    pDev->anCellS[nCellIdx] = (sint16)(pDev->anCellIn[nCellIdx] + pDev->anSErr[nCellIdx]);
+                }
+                adi_bms_sim_lApplyOpenWires(pDev);
+                break;
+            case ADI_BMS_SIM_ADC_I1:
+                pDev->nI1    = pDev->nI1In;
+                pDev->nI1Avg = pDev->nI1In;
+                break;
+            case ADI_BMS_SIM_ADC_I2:
+                pDev->nI2    = pDev->nI2In;
+                pDev->nI2Avg = pDev->nI2In;
+                break;
+            default:
+                /* Auxiliary results are not modelled and read back as zero */
+                break;
+        }
+    }
+}
+
+/*!
+    @brief          Brings the ADC state up to the current time. Results are not
+                    latched while the device is snapped.
+ */
+static void adi_bms_sim_lUpdateAdc
+(
+    void
+)
+{
+    uint8  nAdc;
+    uint64 nElapsedUs;
+    uint16 nConvCnt;
+    adi_bms_sim_AdcStateType *pAdc;
+
+    for (nAdc = 0u; nAdc < (uint8)ADI_BMS_SIM_NO_OF_ADC; nAdc++)
+    {
+        pAdc = &adi_bms_sim_poChain->aoAdc[nAdc];
+        if (TRUE == pAdc->bActive)
+        {
+            nElapsedUs = adi_bms_sim_nTimeUs - pAdc->nStartUs;
+            if (nElapsedUs >= pAdc->nConvUs)
+            {
+                if (TRUE == pAdc->bCont)
+                {
+                    nConvCnt = (uint16)(pAdc->nBaseCnt + (uint16)(nElapsedUs / pAdc->nConvUs));
+                }
+                else
+                {
+                    nConvCnt = (uint16)(pAdc->nBaseCnt + 1u);
+                    pAdc->bActive = FALSE;
+                }
+                pAdc->nConvCnt = (uint16)(nConvCnt & ADI_BMS_SIM_CT_MASK);
+                if (FALSE == adi_bms_sim_poChain->bSnap)
+                {
+                    adi_bms_sim_lLatchResults((adi_bms_sim_AdcType)nAdc);
+                }
+            }
+        }
+    }
+}
+
+/*!
+    @brief          Starts a conversion.
+
+    @param[in]      eAdc        ADC to start.
+    @param[in]      nConvUs     Conversion time.
+    @param[in]      bCont       Continuous mode.
+    @param[in]      bResetCnt   Reset the conversion counter.
+ */
+static void adi_bms_sim_lStartAdc
+(
+    adi_bms_sim_AdcType eAdc,
+    uint32 nConvUs,
+    boolean bCont,
+    boolean bResetCnt
+)
+{
+    adi_bms_sim_AdcStateType *pAdc = &adi_bms_sim_poChain->aoAdc[eAdc];
+
+    if (TRUE == bResetCnt)
+    {
+        pAdc->nConvCnt = 0u;
+    }
+    pAdc->nStartUs = adi_bms_sim_nTimeUs;
+    pAdc->nConvUs  = nConvUs;
+    pAdc->nBaseCnt = pAdc->nConvCnt;
+    pAdc->bCont    = bCont;
+    pAdc->bActive  = TRUE;
+}
+
+/*!
+    @brief          Decodes an ADC trigger command.
+
+    @param[in]      nCmd        Command code.
+    @return         @c TRUE  - If the command is an ADC trigger. \n
+                    @c FALSE - Otherwise.
+ */
+static boolean adi_bms_sim_lTriggerAdc
+(
+    uint16 nCmd
+)
+{
+    boolean bIsAdcCmd = TRUE;
+    boolean bCont = (boolean)(0u != (nCmd & 0x80u));
+
+    if ((ADBMS6948_CMD_ADCV & 0x668u) == (nCmd & 0x668u))
+    {
+        adi_bms_sim_poChain->aoAdc[ADI_BMS_SIM_ADC_C].bRedundant = (boolean)(0u != (nCmd & 0x100u));
+        adi_bms_sim_lStartAdc(ADI_BMS_SIM_ADC_C, ADI_BMS_SIM_T_CADC_US, bCont, (boolean)(0u != (nCmd & 0x04u)));
+    }
+    else if ((ADBMS6948_CMD_ADCIV & 0x668u) == (nCmd & 0x668u))
+    {
+        adi_bms_sim_poChain->aoAdc[ADI_BMS_SIM_ADC_C].bRedundant = (boolean)(0u != (nCmd & 0x100u));
+        adi_bms_sim_lStartAdc(ADI_BMS_SIM_ADC_C, ADI_BMS_SIM_T_CADC_US, bCont, (boolean)(0u != (nCmd & 0x04u)));
+        adi_bms_sim_lStartAdc(ADI_BMS_SIM_ADC_I1, ADI_BMS_SIM_T_IADC_US, bCont, (boolean)(0u != (nCmd & 0x04u)));
+    }
+    else if ((ADBMS6948_CMD_ADSV & 0x76Cu) == (nCmd & 0x76Cu))
+    {
+        adi_bms_sim_poChain->nSOWSel = (uint8)(nCmd & (ADI_BMS_SIM_OW_EVEN | ADI_BMS_SIM_OW_ODD));
+        adi_bms_sim_lStartAdc(ADI_BMS_SIM_ADC_S, ADI_BMS_SIM_T_SADC_US, bCont, FALSE);
+    }
+    else if ((ADBMS6948_CMD_ADI1 & 0x67Cu) == (nCmd & 0x67Cu))
+    {
+        adi_bms_sim_lStartAdc(ADI_BMS_SIM_ADC_I1, ADI_BMS_SIM_T_IADC_US, bCont, FALSE);
+    }
+    else if ((ADBMS6948_CMD_ADI2 & 0x77Cu) == (nCmd & 0x77Cu))
+    {
+        adi_bms_sim_lStartAdc(ADI_BMS_SIM_ADC_I2, ADI_BMS_SIM_T_IADC_US, bCont, FALSE);
+    }
+    else if ((ADBMS6948_CMD_ADAX & 0x630u) == (nCmd & 0x630u))
+    {
+        adi_bms_sim_lStartAdc(ADI_BMS_SIM_ADC_AUX, ADI_BMS_SIM_T_AUX_US, FALSE, FALSE);
+    }
+    else if ((ADBMS6948_CMD_ADAX2 & 0x7F0u) == (nCmd & 0x7F0u))
+    {
+        adi_bms_sim_lStartAdc(ADI_BMS_SIM_ADC_AUX2, ADI_BMS_SIM_T_AUX_US, FALSE, FALSE);
+    }
+    else
+    {
+        bIsAdcCmd = FALSE;
+    }
+return (bIsAdcCmd);
+}
+
+/*!
+    @brief          Returns whether the conversions selected by a poll command
+                    are complete.
+
+    @param[in]      nCmd        Poll command code.
+    @param[out]     pbDone      Completion status.
+    @return         @c TRUE  - If the command is a poll command. \n
+                    @c FALSE - Otherwise.
+ */
+static boolean adi_bms_sim_lPollAdc
+(
+    uint16 nCmd,
+    boolean *pbDone
+)
+{
+    boolean bIsPollCmd = TRUE;
+    uint8   nAdc;
+    uint32  nAdcMask = 0u;
+
+    switch (nCmd)
+    {
+        case ADBMS6948_CMD_PLADC:
+            nAdcMask = (1u << (uint8)ADI_BMS_SIM_NO_OF_ADC) - 1u;
+            break;
+        case ADBMS6948_CMD_PLCADC:
+            nAdcMask = 1u << (uint8)ADI_BMS_SIM_ADC_C;
+            break;
+        case ADBMS6948_CMD_PLSADC:
+            nAdcMask = 1u << (uint8)ADI_BMS_SIM_ADC_S;
+            break;
+        case ADBMS6948_CMD_PLI1ADC:
+            nAdcMask = 1u << (uint8)ADI_BMS_SIM_ADC_I1;
+            break;
+        case ADBMS6948_CMD_PLI2ADC:
+            nAdcMask = 1u << (uint8)ADI_BMS_SIM_ADC_I2;
+            break;
+        case ADBMS6948_CMD_PLAUX1:
+            nAdcMask = 1u << (uint8)ADI_BMS_SIM_ADC_AUX;
+            break;
+        case ADBMS6948_CMD_PLAUX2:
+            nAdcMask = 1u << (uint8)ADI_BMS_SIM_ADC_AUX2;
+            break;
+        default:
+            bIsPollCmd = FALSE;
+            break;
+    }
+
+    *pbDone = TRUE;
+    for (nAdc = 0u; nAdc < (uint8)ADI_BMS_SIM_NO_OF_ADC; nAdc++)
+    {
+        /* A continuous conversion reports done once the first result is available */
+        if ((0u != (nAdcMask & (1u << nAdc))) && (TRUE == adi_bms_sim_poChain->aoAdc[nAdc].bActive) &&
+            ((adi_bms_sim_nTimeUs - adi_bms_sim_poChain->aoAdc[nAdc].nStartUs) < adi_bms_sim_poChain->aoAdc[nAdc].nConvUs))
+        {
+            *pbDone = FALSE;
+        }
+    }
+return (bIsPollCmd);
+}
+
+/*!
+    @brief          Serializes cell results, two bytes per cell, low byte first.
+
+    @param[out]     pData       Destination.
+    @param[in]      pnCell      Cell results.
+    @param[in]      nFirstCell  Index of the first cell.
+    @param[in]      nNoOfCells  Number of cells.
+ */
+static void adi_bms_sim_lPutCells
+(
+    uint8 *pData,
+    const sint16 *pnCell,
+    uint8 nFirstCell,
+    uint8 nNoOfCells
+)
+{
+    uint8 nIdx;
+
+    for (nIdx = 0u; nIdx < nNoOfCells; nIdx++)
+    {
+        if ((nFirstCell + nIdx) < ADI_BMS_SIM_NO_OF_CELLS)
+        {
+            pData[2u * nIdx]      = (uint8)((uint16)pnCell[nFirstCell + nIdx]);
+            pData[(2u * nIdx) + 1u] = (uint8)((uint16)pnCell[nFirstCell + nIdx] >> 8u);
+        }
+        else
+        {
+            /* Unused cells of the last group */
+            pData[2u * nIdx]      = 0xFFu;
+            pData[(2u * nIdx) + 1u] = 0xFFu;
+        }
+    }
+}
+
+/*!
+    @brief          Serializes the I1 and I2 results, three bytes each, low byte first.
+
+    @param[out]     pData       Destination.
+    @param[in]      nI1         I1 result.
+    @param[in]      nI2         I2 result.
+ */
+static void adi_bms_sim_lPutCurrents
+(
+    uint8 *pData,
+    sint32 nI1,
+    sint32 nI2
+)
+{
+    pData[0] = (uint8)((uint32)nI1);
+    pData[1] = (uint8)((uint32)nI1 >> 8u);
+    pData[2] = (uint8)((uint32)nI1 >> 16u);
+    pData[3] = (uint8)((uint32)nI2);
+    pData[4] = (uint8)((uint32)nI2 >> 8u);
+    pData[5] = (uint8)((uint32)nI2 >> 16u);
+}
+
+/*!
+    @brief          Builds the payload a device returns for a read command.
+
+    @param[in]      nCmd        Read command code.
+    @param[in]      nDevIdx     Index of the device.
+    @param[out]     pData       Payload, without PEC.
+    @return         Payload length, 0 if @c nCmd is not a read command.
+ */
+static uint8 adi_bms_sim_lBuildReadPayload
+(
+    uint16 nCmd,
+    uint8 nDevIdx,
+    uint8 *pData
+)
+{
+    const adi_bms_sim_DeviceType *pDev = &adi_bms_sim_poChain->aoDevice[nDevIdx];
+    const sint16 *apnCells[4u] = {pDev->anCellC, pDev->anCellAvg, pDev->anCellS, pDev->anCellFilt};
+    const uint8  knNoOfZeroGrps = (uint8)(sizeof(adi_bms_sim_anZeroGrpCmd) / sizeof(uint16));
+    uint8  nLen = ADI_BMS_SIM_GRP_LEN;
+    uint8  nType, nGrp;
+    uint16 nVoltCT, nCurrCT;
+    boolean bFound = FALSE;
+
+    (void) memset(pData, 0, ADI_BMS_SIM_MAX_PAYLOAD_LEN);
+    for (nType = 0u; (nType < 4u) && (FALSE == bFound); nType++)
+    {
+        nGrp = adi_bms_sim_lFindCmd(&adi_bms_sim_aanCellGrpCmd[nType][0], 6u, nCmd);
+        if (nGrp < 6u)
+        {
+            adi_bms_sim_lPutCells(pData, apnCells[nType], (uint8)(3u * nGrp), 3u);
+            bFound = TRUE;
+        }
+    }
+    if (FALSE == bFound)
+    {
+        nGrp = adi_bms_sim_lFindCmd(&adi_bms_sim_anRdCmd[0], ADI_BMS_SIM_NO_OF_STORED_GRPS, nCmd);
+        if (nGrp < ADI_BMS_SIM_NO_OF_STORED_GRPS)
+        {
+            (void) memcpy(pData, &pDev->aaStoredGrp[nGrp][0], ADI_BMS_SIM_GRP_LEN);
+            bFound = TRUE;
+        }
+        else if (adi_bms_sim_lFindCmd(&adi_bms_sim_anZeroGrpCmd[0], knNoOfZeroGrps, nCmd) < knNoOfZeroGrps)
+        {
+            bFound = TRUE;
+        }
+        else
+        {
+            /* Continue with the remaining read commands */
+        }
+    }
+
+    if (FALSE == bFound)
+    {
+        switch (nCmd)
+        {
+            case ADBMS6948_CMD_RDSTATG:
+                nVoltCT = (TRUE == adi_bms_sim_poChain->bSnap) ? adi_bms_sim_poChain->nSnapVoltCT : adi_bms_sim_poChain->aoAdc[ADI_BMS_SIM_ADC_C].nConvCnt;
+                nCurrCT = (TRUE == adi_bms_sim_poChain->bSnap) ? adi_bms_sim_poChain->nSnapCurrCT : adi_bms_sim_poChain->aoAdc[ADI_BMS_SIM_ADC_I1].nConvCnt;
+                pData[0] = (uint8)((nVoltCT >> 6u) & 0x1Fu);
+                pData[1] = (uint8)((nVoltCT << 2u) & 0xFCu);
+                pData[2] = (uint8)((nCurrCT >> 6u) & 0x1Fu);
+                pData[3] = (uint8)((nCurrCT << 2u) & 0xFCu);
+                break;
+            case ADBMS6948_CMD_RDSTATC:
+                pData[0] = (uint8)pDev->nCSFlt;
+                pData[1] = (uint8)(pDev->nCSFlt >> 8u);
+                pData[5] = (TRUE == pDev->bCompV) ? ADI_BMS_SIM_STATC_COMP_V : 0u;
+                break;
+            case ADBMS6948_CMD_RDSID:
+                pData[0] = (uint8)(nDevIdx + 1u);
+                break;
+            case ADBMS6948_CMD_RDI:
+                adi_bms_sim_lPutCurrents(pData, pDev->nI1, pDev->nI2);
+                break;
+            case ADBMS6948_CMD_RDIAV:
+                adi_bms_sim_lPutCurrents(pData, pDev->nI1Avg, pDev->nI2Avg);
+                break;
+            case ADBMS6948_CMD_RDCVALL:
+                adi_bms_sim_lPutCells(pData, pDev->anCellC, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                nLen = 32u;
+                break;
+            case ADBMS6948_CMD_RDACALL:
+                adi_bms_sim_lPutCells(pData, pDev->anCellAvg, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                nLen = 32u;
+                break;
+            case ADBMS6948_CMD_RDSVALL:
+                adi_bms_sim_lPutCells(pData, pDev->anCellS, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                nLen = 32u;
+                break;
+            case ADBMS6948_CMD_RDFCALL:
+                adi_bms_sim_lPutCells(pData, pDev->anCellFilt, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                nLen = 32u;
+                break;
+            case ADBMS6948_CMD_RDCSVALL:
+                adi_bms_sim_lPutCells(pData, pDev->anCellC, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                adi_bms_sim_lPutCells(&pData[32], pDev->anCellS, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                nLen = 64u;
+                break;
+            case ADBMS6948_CMD_RDACSALL:
+                adi_bms_sim_lPutCells(pData, pDev->anCellAvg, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                adi_bms_sim_lPutCells(&pData[32], pDev->anCellS, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                nLen = 64u;
+                break;
+            case ADBMS6948_CMD_RDCIV:
+                adi_bms_sim_lPutCells(pData, pDev->anCellC, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                adi_bms_sim_lPutCurrents(&pData[32], pDev->nI1, pDev->nI2);
+                nLen = 38u;
+                break;
+            case ADBMS6948_CMD_RDACIV:
+                adi_bms_sim_lPutCells(pData, pDev->anCellAvg, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                adi_bms_sim_lPutCurrents(&pData[32], pDev->nI1Avg, pDev->nI2Avg);
+                nLen = 38u;
+                break;
+            case ADBMS6948_CMD_RDCSIVALL:
+                adi_bms_sim_lPutCells(pData, pDev->anCellC, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                adi_bms_sim_lPutCells(&pData[32], pDev->anCellS, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                adi_bms_sim_lPutCurrents(&pData[64], pDev->nI1, pDev->nI2);
+                nLen = 70u;
+                break;
+            case ADBMS6948_CMD_RDACSIVALL:
+                adi_bms_sim_lPutCells(pData, pDev->anCellAvg, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                adi_bms_sim_lPutCells(&pData[32], pDev->anCellS, 0u, ADI_BMS_SIM_NO_OF_CELLS);
+                adi_bms_sim_lPutCurrents(&pData[64], pDev->nI1Avg, pDev->nI2Avg);
+                nLen = 70u;
+                break;
+            case ADBMS6948_CMD_RDASALL:
+                /* Auxiliary and status results are not modelled */
+                nLen = 82u;
+                break;
+            default:
+                nLen = 0u;
+                break;
+        }
+    }
+return (nLen);
+}
+
+/*!
+    @brief          Executes a command without response on all devices.
+
+    @param[in]      nCmd        Command code.
+    @param[in]      pTxBuf      Complete frame, data follows the command.
+    @param[in]      nDataLen    Frame length.
+    @return         @c TRUE  - If the command increments the command counter. \n
+                    @c FALSE - Otherwise.
+ */
+static boolean adi_bms_sim_lExecCmd
+(
+    uint16 nCmd,
+    const uint8 *pTxBuf,
+    uint16 nDataLen
+)
+{
+    boolean bIncCmdCnt = TRUE;
+    const uint8 knNoOfActionCmds = (uint8)(sizeof(adi_bms_sim_anActionCmd) / sizeof(uint16));
+    uint8   nDevIdx, nCellIdx, nSlot;
+    uint16  nOffset, nRcvdPec;
+    adi_bms_sim_DeviceType *pDev;
+
+    nSlot = adi_bms_sim_lFindCmd(&adi_bms_sim_anWrCmd[0], ADI_BMS_SIM_NO_OF_STORED_GRPS, nCmd);
+    if (nSlot < ADI_BMS_SIM_NO_OF_STORED_GRPS)
+    {
+        for (nDevIdx = 0u; nDevIdx < adi_bms_sim_poChain->nNoOfDevices; nDevIdx++)
+        {
+            /* The data of the last device on the chain is shifted out first */
+            nOffset = (uint16)(ADI_BMS_SIM_CMD_LEN +
+                               ((adi_bms_sim_poChain->nNoOfDevices - 1u - nDevIdx) * ADI_BMS_SIM_GRP_LEN_WITH_PEC));
+            if ((nOffset + ADI_BMS_SIM_GRP_LEN_WITH_PEC) <= nDataLen)
+            {
+                nRcvdPec = (uint16)(((uint16)pTxBuf[nOffset + 6u] << 8u) | pTxBuf[nOffset + 7u]) & 0x3FFu;
+                if (nRcvdPec == adi_bms_sim_lPec10(&pTxBuf[nOffset], ADI_BMS_SIM_GRP_LEN, 0u))
+                {
+                    (void) memcpy(&adi_bms_sim_poChain->aoDevice[nDevIdx].aaStoredGrp[nSlot][0], &pTxBuf[nOffset],
+                                  ADI_BMS_SIM_GRP_LEN);
+                }
+            }
+        }
+    }
+    else if (ADBMS6948_CMD_RSTCC == nCmd)
+    {
+        for (nDevIdx = 0u; nDevIdx < adi_bms_sim_poChain->nNoOfDevices; nDevIdx++)
+        {
+            adi_bms_sim_poChain->aoDevice[nDevIdx].nCmdCnt = 0u;
+        }
+        /* The counter is reset, not incremented */
+        bIncCmdCnt = FALSE;
+    }
+    else if (ADBMS6948_CMD_SRST == nCmd)
+    {
+        adi_bms_sim_lResetChain();
+        bIncCmdCnt = FALSE;
+    }
+    else if (TRUE == adi_bms_sim_lTriggerAdc(nCmd))
+    {
+        /* Conversion started */
+    }
+    else if (ADBMS6948_CMD_CCEN == (uint16)(nCmd & (uint16)(~ADBMS6948_CCEN_MASK_CCEN_CON)))
+    {
+        /* Coulomb counter started in single shot or continuous mode, the counter is not modelled */
+    }
+    else if (adi_bms_sim_lFindCmd(&adi_bms_sim_anActionCmd[0], knNoOfActionCmds, nCmd) < knNoOfActionCmds)
+    {
+        for (nDevIdx = 0u; nDevIdx < adi_bms_sim_poChain->nNoOfDevices; nDevIdx++)
+        {
+            pDev = &adi_bms_sim_poChain->aoDevice[nDevIdx];
+            for (nCellIdx = 0u; nCellIdx < ADI_BMS_SIM_NO_OF_CELLS; nCellIdx++)
+            {
+                if (ADBMS6948_CMD_CLRCELL == nCmd)
+                {
+                    pDev->anCellC[nCellIdx]   = ADI_BMS_SIM_CLEARED_CODE;
+                    pDev->anCellAvg[nCellIdx] = ADI_BMS_SIM_CLEARED_CODE;
+                }
+                else if (ADBMS6948_CMD_CLRFC == nCmd)
+                {
+                    pDev->anCellFilt[nCellIdx] = ADI_BMS_SIM_CLEARED_CODE;
+                }
+                else if (ADBMS6948_CMD_CLRSPIN == nCmd)
+                {
+                    pDev->anCellS[nCellIdx] = ADI_BMS_SIM_CLEARED_CODE;
+                }
+            }
+            if (ADBMS6948_CMD_CLRCI == nCmd)
+            {
+                pDev->nI1    = 0;
+                pDev->nI1Avg = 0;
+            }
+            else if (ADBMS6948_CMD_CLRSI == nCmd)
+            {
+                pDev->nI2    = 0;
+                pDev->nI2Avg = 0;
+            }
+            else if (ADBMS6948_CMD_CLRFLAG == nCmd)
+            {
+                /* The set bits of the data clear the flags of Status C */
+                nOffset = (uint16)(ADI_BMS_SIM_CMD_LEN +
+                                   ((adi_bms_sim_poChain->nNoOfDevices - 1u - nDevIdx) * ADI_BMS_SIM_GRP_LEN_WITH_PEC));
+                if ((nOffset + ADI_BMS_SIM_GRP_LEN_WITH_PEC) <= nDataLen)
+                {
+                    nRcvdPec = (uint16)(((uint16)pTxBuf[nOffset + 6u] << 8u) | pTxBuf[nOffset + 7u]) & 0x3FFu;
+                    if (nRcvdPec == adi_bms_sim_lPec10(&pTxBuf[nOffset], ADI_BMS_SIM_GRP_LEN, 0u))
+                    {
+                        pDev->nCSFlt &= (uint16)~(uint16)((uint16)pTxBuf[nOffset] | ((uint16)pTxBuf[nOffset + 1u] << 8u));
+                        if (0u != (pTxBuf[nOffset + 5u] & ADI_BMS_SIM_STATC_COMP_V))
+                        {
+                            pDev->bCompV = FALSE;
+                        }
+                    }
+                }
+            }
+        }
+        if (ADBMS6948_CMD_SNAP == nCmd)
+        {
+            adi_bms_sim_poChain->bSnap = TRUE;
+            adi_bms_sim_poChain->nSnapVoltCT = adi_bms_sim_poChain->aoAdc[ADI_BMS_SIM_ADC_C].nConvCnt;
+            adi_bms_sim_poChain->nSnapCurrCT = adi_bms_sim_poChain->aoAdc[ADI_BMS_SIM_ADC_I1].nConvCnt;
+        }
+        else if (ADBMS6948_CMD_UNSNAP == nCmd)
+        {
+            adi_bms_sim_poChain->bSnap = FALSE;
+        }
+    }
+    else
+    {
+        /* Unknown commands are ignored by the device */
+        bIncCmdCnt = FALSE;
+    }
+return (bIncCmdCnt);
+}
+
+/*!
+    @brief          Increments the command counter of all devices.
+ */
+static void adi_bms_sim_lIncCmdCnt
+(
+    void
+)
+{
+    uint8 nDevIdx;
+
+    for (nDevIdx = 0u; nDevIdx < adi_bms_sim_poChain->nNoOfDevices; nDevIdx++)
+    {
+        adi_bms_sim_poChain->aoDevice[nDevIdx].nCmdCnt++;
+        if (adi_bms_sim_poChain->aoDevice[nDevIdx].nCmdCnt > ADI_BMS_SIM_MAX_CMD_CNT)
+        {
+            adi_bms_sim_poChain->aoDevice[nDevIdx].nCmdCnt = 1u;
+        }
+    }
+}
+
+/*!
+    @brief          Selects the chain addressed by a public function.
+
+    @param[in]      nChainID    Daisy chain ID, out of range IDs select chain 0.
+ */
+static void adi_bms_sim_lSelectChain
+(
+    uint8 nChainID
+)
+{
+    adi_bms_sim_poChain = &adi_bms_sim_aoChain[(nChainID < ADI_BMS_SIM_MAX_CHAINS) ? nChainID : 0u];
+}
+
+/*============= P U B L I C  F U N C T I O N S =============*/
+/*!
+    @brief          Initializes a simulated daisy chain: resets all its devices
+                    and inputs. All cells are set to 3.3 V. The virtual time is
+                    shared by all chains and is not reset.
+
+    @param[in]      nChainID        Daisy chain ID.
+    @param[in]      nNoOfDevices    Number of devices in the daisy chain.
+ */
+void adi_bms_sim_Init
+(
+    uint8 nChainID,
+    uint8 nNoOfDevices
+)
+{
+    uint8 nDevIdx, nCellIdx;
+
+    adi_bms_sim_lSelectChain(nChainID);
+    if ((nNoOfDevices == 0u) || (nNoOfDevices > ADI_BMS_SIM_MAX_DEVICES))
+    {
+        nNoOfDevices = ADI_BMS_SIM_MAX_DEVICES;
+    }
+    adi_bms_sim_poChain->nNoOfDevices = nNoOfDevices;
+    adi_bms_sim_poChain->nLastActivityUs = 0u;
+    adi_bms_sim_poChain->nReadyAtUs = 0u;
+    adi_bms_sim_poChain->nFrameCnt = 0u;
+    for (nDevIdx = 0u; nDevIdx < ADI_BMS_SIM_MAX_DEVICES; nDevIdx++)
+    {
+        for (nCellIdx = 0u; nCellIdx < ADI_BMS_SIM_NO_OF_CELLS; nCellIdx++)
+        {
+            /* 150 uV per LSB with an offset of 1.5 V */
+            adi_bms_sim_poChain->aoDevice[nDevIdx].anCellIn[nCellIdx] = (sint16)12000;
+            adi_bms_sim_poChain->aoDevice[nDevIdx].anSErr[nCellIdx] = 0;
+        }
+        adi_bms_sim_poChain->aoDevice[nDevIdx].nI1In = 0;
+        adi_bms_sim_poChain->aoDevice[nDevIdx].nI2In = 0;
+        adi_bms_sim_poChain->aoDevice[nDevIdx].nOpenWires = 0u;
+    }
+    adi_bms_sim_poChain->nSOWSel = 0u;
+    adi_bms_sim_lResetChain();
+}
+
+/*!
+    @brief          Clocks one chip-select framed transfer through the daisy
+                    chain.
+
+    The first four bytes are the command and its PEC15. Frames with a wrong
+    command PEC, unknown commands and frames received while the devices are
+    waking up are ignored and the devices do not drive MISO. A read command
+    is answered by every device, device 0 first, with its payload followed
+    by PEC10 and the command counter. Any other known command increments the
+    command counter; poll commands return the conversion status in the bytes
+    following the command.
+
+    @param[in]      nChainID    Daisy chain ID.
+    @param[in]      pTxBuf      Frame to transmit.
+    @param[out]     pRxBuf      Received frame, may be NULL or alias @c pTxBuf.
+    @param[in]      nDataLen    Frame length.
+ */
+void adi_bms_sim_Transfer
+(
+    uint8 nChainID,
+    const uint8 *pTxBuf,
+    uint8 *pRxBuf,
+    uint16 nDataLen
+)
+{
+    uint8   aTxFrame[ADI_BMS_SIM_MAX_FRAME_LEN];
+    uint8   aPayload[ADI_BMS_SIM_MAX_PAYLOAD_LEN];
+    uint8   nPayloadLen, nDevIdx;
+    uint16  nCmd, nPec, nIdx, nOffset;
+    boolean bDone;
+    boolean bAwake = TRUE;
+    uint8   *pRx;
+
+    adi_bms_sim_lSelectChain(nChainID);
+    adi_bms_sim_poChain->nFrameCnt++;
+    if ((0u != adi_bms_sim_nSleepTimeoutUs) &&
+        ((adi_bms_sim_nTimeUs - adi_bms_sim_poChain->nLastActivityUs) > adi_bms_sim_nSleepTimeoutUs))
+    {
+        /* The devices went to sleep and lost their state, this edge wakes them up */
+        adi_bms_sim_lResetChain();
+        adi_bms_sim_poChain->nReadyAtUs = adi_bms_sim_nTimeUs + ADI_BMS_SIM_T_WAKE_US;
+    }
+    if (adi_bms_sim_nTimeUs < adi_bms_sim_poChain->nReadyAtUs)
+    {
+        bAwake = FALSE;
+    }
+    adi_bms_sim_poChain->nLastActivityUs = adi_bms_sim_nTimeUs;
+
+    /* The frame is shifted in while the response is shifted out, keep the
+       transmitted bytes in case the caller receives into the same buffer */
+    if (nDataLen > ADI_BMS_SIM_MAX_FRAME_LEN)
+    {
+        nDataLen = ADI_BMS_SIM_MAX_FRAME_LEN;
+    }
+    (void) memcpy(&aTxFrame[0], pTxBuf, nDataLen);
+    pTxBuf = &aTxFrame[0];
+
+    /* MISO idles high */
+    if (NULL_PTR != pRxBuf)
+    {
+        (void) memset(pRxBuf, 0xFF, nDataLen);
+    }
+
+    adi_bms_sim_lUpdateAdc();
+    if ((TRUE == bAwake) && (nDataLen >= ADI_BMS_SIM_CMD_LEN))
+    {
+        nCmd = (uint16)(((uint16)pTxBuf[0] << 8u) | pTxBuf[1]) & 0x7FFu;
+        nPec = (uint16)(((uint16)pTxBuf[2] << 8u) | pTxBuf[3]);
+        if (nPec == adi_bms_sim_lPec15(pTxBuf, 2u))
+        {
+            nPayloadLen = adi_bms_sim_lBuildReadPayload(nCmd, 0u, &aPayload[0]);
+            if (0u != nPayloadLen)
+            {
+                for (nDevIdx = 0u; nDevIdx < adi_bms_sim_poChain->nNoOfDevices; nDevIdx++)
+                {
+                    nOffset = (uint16)(ADI_BMS_SIM_CMD_LEN + (nDevIdx * (nPayloadLen + 2u)));
+                    if ((nOffset + nPayloadLen + 2u) > nDataLen)
+                    {
+                        break;
+                    }
+                    (void) adi_bms_sim_lBuildReadPayload(nCmd, nDevIdx, &aPayload[0]);
+                    nPec = adi_bms_sim_lPec10(&aPayload[0], nPayloadLen, adi_bms_sim_poChain->aoDevice[nDevIdx].nCmdCnt);
+                    nPec |= (uint16)((uint16)adi_bms_sim_poChain->aoDevice[nDevIdx].nCmdCnt << 10u);
+                    if (TRUE == adi_bms_sim_poChain->aoDevice[nDevIdx].bInjectPecErr)
+                    {
+                        nPec ^= 0x0001u;
+                        adi_bms_sim_poChain->aoDevice[nDevIdx].bInjectPecErr = FALSE;
+                    }
+                    if (NULL_PTR != pRxBuf)
+                    {
+                        pRx = &pRxBuf[nOffset];
+                        (void) memcpy(pRx, &aPayload[0], nPayloadLen);
+                        pRx[nPayloadLen]      = (uint8)(nPec >> 8u);
+                        pRx[nPayloadLen + 1u] = (uint8)nPec;
+                    }
+                }
+            }
+            else if (TRUE == adi_bms_sim_lPollAdc(nCmd, &bDone))
+            {
+                adi_bms_sim_lIncCmdCnt();
+                if (NULL_PTR != pRxBuf)
+                {
+                    for (nIdx = ADI_BMS_SIM_CMD_LEN; nIdx < nDataLen; nIdx++)
+                    {
+                        pRxBuf[nIdx] = (TRUE == bDone) ? 0xFFu : 0x00u;
+                    }
+                }
+            }
+            else if (TRUE == adi_bms_sim_lExecCmd(nCmd, pTxBuf, nDataLen))
+            {
+                adi_bms_sim_lIncCmdCnt();
+            }
+            else
+            {
+                /* Ignored command */
+            }
+        }
+    }
+    adi_bms_sim_AdvanceTime((uint32)nDataLen * ADI_BMS_SIM_SPI_BYTE_TIME_US);
+}
+
+/*!
+    @brief          Advances the virtual time of the simulator.
+
+    @param[in]      nPeriodInUS     Time to advance, in microseconds.
+ */
+void adi_bms_sim_AdvanceTime
+(
+    uint32 nPeriodInUS
+)
+{
+    adi_bms_sim_nTimeUs += nPeriodInUS;
+}
+
+/*!
+    @brief          Returns the virtual time of the simulator.
+
+    @return         Time since the start of the program, in microseconds.
+ */
+uint64 adi_bms_sim_GetTimeUs
+(
+    void
+)
+{
+    return adi_bms_sim_nTimeUs;
+}
+
+/*!
+    @brief          Sets the input voltage of a cell as a raw ADC code.
+
+    @param[in]      nChainID    Daisy chain ID.
+    @param[in]      nDevIdx     Index of the device in the chain.
+    @param[in]      nCellIdx    Index of the cell.
+    @param[in]      nCode       ADC code, 150 uV per LSB with an offset of 1.5 V.
+ */
+void adi_bms_sim_SetCellVoltage
+(
+    uint8 nChainID,
+    uint8 nDevIdx,
+    uint8 nCellIdx,
+    sint16 nCode
+)
+{
+    adi_bms_sim_lSelectChain(nChainID);
+    if ((nDevIdx < ADI_BMS_SIM_MAX_DEVICES) && (nCellIdx < ADI_BMS_SIM_NO_OF_CELLS))
+    {
+        adi_bms_sim_poChain->aoDevice[nDevIdx].anCellIn[nCellIdx] = nCode;
+    }
+}
+
+/*!
+    @brief          Opens or closes a cell wire. Only the S-ADC conversions with
+                    the open wire switch of the wire on see the open wire.
+
+    @param[in]      nChainID    Daisy chain ID.
+    @param[in]      nDevIdx     Index of the device in the chain.
+    @param[in]      nWire       Wire Cn, 1 to 16, at the top of cell n.
+    @param[in]      bOpen       TRUE to open the wire, FALSE to close it.
+ */
+void adi_bms_sim_SetOpenWire
+(
+    uint8 nChainID,
+    uint8 nDevIdx,
+    uint8 nWire,
+    boolean bOpen
+)
+{
+    adi_bms_sim_lSelectChain(nChainID);
+    if ((nDevIdx < ADI_BMS_SIM_MAX_DEVICES) && (nWire >= 1u) && (nWire <= ADI_BMS_SIM_NO_OF_CELLS))
+    {
+        if (TRUE == bOpen)
+        {
+            adi_bms_sim_poChain->aoDevice[nDevIdx].nOpenWires |= ((uint32)1u << nWire);
+        }
+        else
+        {
+            adi_bms_sim_poChain->aoDevice[nDevIdx].nOpenWires &= ~((uint32)1u << nWire);
+        }
+    }
+}
+
+/*!
+    @brief          Sets the error of an S-ADC channel, added to every S-ADC
+                    result of the cell, e.g. a drifting redundant channel.
+                    The conversions completed before the call still use the
+                    previous error, so an error set and removed again between
+                    two reads is latched in the C vs S faults.
+
+    @param[in]      nChainID    Daisy chain ID.
+    @param[in]      nDevIdx     Index of the device in the chain.
+    @param[in]      nCellIdx    Index of the cell.
+    @param[in]      nErrCode    Error, in codes of 150 uV, 0 for an exact channel.
+ */
+void adi_bms_sim_SetSAdcError
+(
+    uint8 nChainID,
+    uint8 nDevIdx,
+    uint8 nCellIdx,
+    sint16 nErrCode
+)
+{
+    adi_bms_sim_lSelectChain(nChainID);
+    adi_bms_sim_lUpdateAdc();
+    if ((nDevIdx < ADI_BMS_SIM_MAX_DEVICES) && (nCellIdx < ADI_BMS_SIM_NO_OF_CELLS))
+    {
+        adi_bms_sim_poChain->aoDevice[nDevIdx].anSErr[nCellIdx] = nErrCode;
+    }
+}
+
+/*!
+    @brief          Sets the current inputs as raw ADC codes.
+
+    @param[in]      nChainID    Daisy chain ID.
+    @param[in]      nDevIdx     Index of the device in the chain.
+    @param[in]      nI1Code     I1-ADC code.
+    @param[in]      nI2Code     I2-ADC code.
+ */
+void adi_bms_sim_SetCurrent
+(
+    uint8 nChainID,
+    uint8 nDevIdx,
+    sint32 nI1Code,
+    sint32 nI2Code
+)
+{
+    adi_bms_sim_lSelectChain(nChainID);
+    if (nDevIdx < ADI_BMS_SIM_MAX_DEVICES)
+    {
+        adi_bms_sim_poChain->aoDevice[nDevIdx].nI1In = nI1Code;
+        adi_bms_sim_poChain->aoDevice[nDevIdx].nI2In = nI2Code;
+    }
+}
+
+/*!
+    @brief          Sets the idle time after which the devices go to sleep and
+                    lose their state. 0 disables the sleep model.
+
+    @param[in]      nTimeoutInUS    Sleep timeout, in microseconds.
+ */
+void adi_bms_sim_SetSleepTimeout
+(
+    uint32 nTimeoutInUS
+)
+{
+    adi_bms_sim_nSleepTimeoutUs = nTimeoutInUS;
+}
+
+/*!
+    @brief          Corrupts the PEC of the next read response of a device.
+
+    @param[in]      nChainID    Daisy chain ID.
+    @param[in]      nDevIdx     Index of the device in the chain.
+ */
+void adi_bms_sim_InjectPecError
+(
+    uint8 nChainID,
+    uint8 nDevIdx
+)
+{
+    adi_bms_sim_lSelectChain(nChainID);
+    if (nDevIdx < ADI_BMS_SIM_MAX_DEVICES)
+    {
+        adi_bms_sim_poChain->aoDevice[nDevIdx].bInjectPecErr = TRUE;
+    }
+}
+
+/*!
+    @brief          Returns the command counter of a device.
+
+    @param[in]      nChainID    Daisy chain ID.
+    @param[in]      nDevIdx     Index of the device in the chain.
+    @return         Command counter.
+ */
+uint8 adi_bms_sim_GetCmdCount
+(
+    uint8 nChainID,
+    uint8 nDevIdx
+)
+{
+    uint8 nCmdCnt = 0u;
+
+    adi_bms_sim_lSelectChain(nChainID);
+    if (nDevIdx < ADI_BMS_SIM_MAX_DEVICES)
+    {
+        nCmdCnt = adi_bms_sim_poChain->aoDevice[nDevIdx].nCmdCnt;
+    }
+return (nCmdCnt);
+}
+
+/*!
+    @brief          Returns the number of frames transferred on a chain since
+                    adi_bms_sim_Init().
+
+    @param[in]      nChainID    Daisy chain ID.
+    @return         Number of frames.
+ */
+uint32 adi_bms_sim_GetFrameCount
+(
+    uint8 nChainID
+)
+{
+    adi_bms_sim_lSelectChain(nChainID);
+    return adi_bms_sim_poChain->nFrameCnt;
+}
+
+#endif /* ADI_PAL_HOST */
+
+/*! @} */ /*BMS Device Simulator*/
+/*! @} */ /*Platform Abstraction Layer*/
+
+/*
+ *
+ * EOF: $URL$
+ *
+*/
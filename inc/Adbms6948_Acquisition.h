@@ -0,0 +1,62 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    Adbms6948_Acquisition.h
+ * @brief   Continuous acquisition engine. Samples the synchronized cell
+ *          voltage and current averages at a fixed period and publishes
+ *          timestamped frames to a ring buffer drained by the consumers.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Adbms6948_AppsExample
+*  @{
+*/
+
+#ifndef __ADBMS6948_ACQUISITION_H
+#define __ADBMS6948_ACQUISITION_H
+
+#include "Adbms6948_Applications.h"
+
+/*! Number of frames in the acquisition ring, must be a power of two */
+#define BMS_ACQ_RING_SIZE           (64u)
+/*! Default sampling period in milliseconds */
+#define BMS_ACQ_DEFAULT_PERIOD_MS   (50u)
+/*! Shortest sampling period in milliseconds, one continuous C-ADC/I-ADC conversion */
+#define BMS_ACQ_MIN_PERIOD_MS       (2u)
+
+/*! Consumers of the acquisition ring, each one drains the ring with its own read index */
+typedef enum
+{
+    BMS_ACQ_CONSUMER_LOG = 0,       /*!< Logging / telemetry */
+    BMS_ACQ_CONSUMER_SOC,           /*!< State of charge estimation */
+    BMS_ACQ_CONSUMER_PROTECTION,    /*!< Protection checks */
+    BMS_ACQ_NO_OF_CONSUMERS
+} BMS_ACQ_CONSUMER;
+
+typedef struct
+{
+    uint32_t nSamples;              /*!< Frames published to the ring */
+    uint32_t nOverruns;             /*!< Frames dropped because an attached consumer was full */
+    uint32_t nReadErrors;           /*!< Failed reads of the averages */
+    uint32_t nMaxLatenessUs;        /*!< Largest delay of a sample behind its schedule */
+} BMS_ACQ_STATS;
+
+int Adbms6948_Acq_Start(uint32_t nPeriodMs, const uint8_t knChainId);
+void Adbms6948_Acq_Stop(void);
+bool Adbms6948_Acq_IsRunning(void);
+void Adbms6948_Acq_Attach(BMS_ACQ_CONSUMER eConsumer);
+void Adbms6948_Acq_Detach(BMS_ACQ_CONSUMER eConsumer);
+bool Adbms6948_Acq_Pop(BMS_ACQ_CONSUMER eConsumer, BMS_BUFFER *poFrame);
+void Adbms6948_Acq_GetStats(BMS_ACQ_STATS *poStats);
+
+#endif
+
+
+/*! @}*/
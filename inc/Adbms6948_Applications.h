@@ -23,12 +23,19 @@ Analog Devices License Agreement.
 #include "Adbms6948.h"
 #include "common.h"
 
+/*! Cells of one device, ADBMS6948_MAX_NO_OF_CELLS_PER_DEVICE of the driver */
+#define BMS_APP_CELLS_PER_DEVICE    (16u)
+/*! Cells of the longest chain, the cell reads of the driver write BMS_APP_CELLS_PER_DEVICE cells per device */
+#define BMS_APP_MAX_CELLS           (ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN * BMS_APP_CELLS_PER_DEVICE)
+
 typedef struct
 {
-    int16_t anCellVoltage[16];        /*!< Cell Voltage Codes for all the cells: 16 bit ADC measurement */
-    int32_t nCurrent;                          /*!< Current channel 1 value*/
+    int16_t anCellVoltage[BMS_APP_MAX_CELLS];  /*!< Cell Voltage Codes for all the cells: 16 bit ADC measurement */
+    int32_t anCurrent[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];  /*!< Current channel 1 value of each device*/
     uint16_t nVoltageCT;                        /*!< Value of CT bits for Voltage*/
     uint16_t nCurrentCT;                        /*!< Value of CT bits for Current*/
+    uint64_t nTimestampUs;                      /*!< Time of the sample in microseconds*/
+    uint32_t nSeqNum;                           /*!< Sample number, gaps mark dropped samples*/
 } BMS_BUFFER;
 
 void ExecuteCommand(int cmd);
@@ -0,0 +1,74 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    Adbms6948_Conversion.h
+ * @brief   Completion driven conversions. A conversion issues its trigger,
+ *          sleeps until the ADC is done and then runs its read as a
+ *          continuation. The end of conversion is detected by polling the
+ *          ADC status or by a deadline derived from the ADC mode.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Adbms6948_AppsExample
+*  @{
+*/
+
+#ifndef __ADBMS6948_CONVERSION_H
+#define __ADBMS6948_CONVERSION_H
+
+#include "Adbms6948.h"
+#include "common.h"
+
+/*! Single conversion of the C-ADC, microseconds */
+#define BMS_CONV_T_CADC_US              (1100u)
+/*! Single conversion of the C-ADC with the redundant S-ADC, or of the S-ADC on all cells, microseconds */
+#define BMS_CONV_T_SADC_US              (8800u)
+/*! Conversion of all the auxiliary channels, microseconds */
+#define BMS_CONV_T_AUX_US               (20000u)
+/*! Single conversion of the I1-ADC or I2-ADC, microseconds */
+#define BMS_CONV_T_IADC_US              (1100u)
+/*! Interval between two polls of the ADC status, microseconds */
+#define BMS_CONV_POLL_INTERVAL_US       (250u)
+/*! A polled conversion fails when not done after this many conversion times */
+#define BMS_CONV_TIMEOUT_FACTOR         (3u)
+
+/*! Detection of the end of conversion */
+typedef enum
+{
+    BMS_CONV_WAIT_POLL = 0,         /*!< Poll the ADC status, SDO is held low until the ADC is done */
+    BMS_CONV_WAIT_DEADLINE          /*!< Sleep for the conversion time */
+} BMS_CONV_WAIT;
+
+/*! Step of a conversion, returns 0 on success */
+typedef int (*BMS_CONV_STEP)(void *pArg, const uint8_t knChainId);
+
+typedef struct
+{
+    Adbms6948_ADCSelType eAdc;      /*!< ADC the conversion runs on, polled for its status */
+    uint32_t nConvTimeUs;           /*!< Conversion time, 0 for the single conversion time of eAdc */
+    BMS_CONV_STEP pfTrigger;        /*!< Starts the conversion */
+    void *pTriggerArg;              /*!< Argument of pfTrigger */
+    BMS_CONV_STEP pfRead;           /*!< Continuation reading the result */
+    void *pReadArg;                 /*!< Argument of pfRead */
+} BMS_CONVERSION;
+
+typedef struct
+{
+    uint32_t nWaitUs;               /*!< Time from the trigger to the end of conversion */
+    uint16_t nPolls;                /*!< Polls of the ADC status */
+} BMS_CONV_STATS;
+
+int Adbms6948_Conv_Run(const BMS_CONVERSION *poConv, BMS_CONV_WAIT eWait, BMS_CONV_STATS *poStats, const uint8_t knChainId);
+uint32_t Adbms6948_Conv_GetConvTimeUs(Adbms6948_ADCSelType eAdc);
+
+#endif
+
+
+/*! @}*/
@@ -0,0 +1,143 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    Adbms6948_ScanPlan.h
+ * @brief   Scan-plan engine for mixed rate measurements. A table of
+ *          measurement tasks with periods is compiled into a cyclic table
+ *          of time slots, one per greatest common divisor of the periods,
+ *          spanning their least common multiple. The C-ADC and I1-ADC run
+ *          in continuous mode from a single Adbms6948_TrigIVADC; GPIO and
+ *          status tasks share single shot Adbms6948_TrigAuxADC conversions
+ *          that are triggered in the slot one conversion time ahead of their
+ *          read. A cross check task runs the C-ADC with redundancy and
+ *          reads the C-ADC and S-ADC results with the C vs S faults in place
+ *          of the cells. Phases are chosen to level the SPI time of the slots.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Adbms6948_AppsExample
+*  @{
+*/
+
+#ifndef __ADBMS6948_SCANPLAN_H
+#define __ADBMS6948_SCANPLAN_H
+
+#include "Adbms6948_Applications.h"
+
+/*! Tasks in a scan plan */
+#define BMS_SCAN_MAX_TASKS          (8u)
+/*! Slots in a compiled scan plan, i.e. longest hyperperiod in slots */
+#define BMS_SCAN_MAX_SLOTS          (1000u)
+/*! SPI clock of the daisy chain, MHz */
+#define BMS_SCAN_SPI_CLOCK_MHZ      (2u)
+/*! Chip select and driver overhead of a frame, microseconds */
+#define BMS_SCAN_FRAME_OVERHEAD_US  (20u)
+/*! Share of a slot the compiler may fill with SPI traffic, percent */
+#define BMS_SCAN_SLOT_BUDGET_PCT    (75u)
+
+/*! Slot word bit triggering the auxiliary ADCs, the low bits are the tasks read in the slot */
+#define BMS_SCAN_SLOT_TRIG_AUX      (0x8000u)
+/*! Slot word bit triggering the next open wire conversion of the S-ADC */
+#define BMS_SCAN_SLOT_TRIG_OW       (0x4000u)
+
+/*! Measurements of a scan task */
+typedef enum
+{
+    BMS_SCAN_MEAS_CELLS = 0,        /*!< Cell voltages, C-ADC */
+    BMS_SCAN_MEAS_CURRENT,          /*!< Current, I1-ADC */
+    BMS_SCAN_MEAS_GPIO,             /*!< GPIO voltages, thermistors, auxiliary ADC */
+    BMS_SCAN_MEAS_STATUS,           /*!< Device parameters, diagnostics, auxiliary ADC */
+    BMS_SCAN_MEAS_OPEN_WIRE,        /*!< Cell voltages with the open wire switches of the odd and even wires alternately, S-ADC */
+    BMS_SCAN_MEAS_CS_CHECK,         /*!< Cell voltages of the C-ADC and S-ADC and the C vs S faults, redundant C-ADC */
+    BMS_SCAN_NO_OF_MEAS
+} BMS_SCAN_MEAS;
+
+/*! Results of Adbms6948_Scan_Compile */
+typedef enum
+{
+    BMS_SCAN_OK = 0,
+    BMS_SCAN_ERR_TASKS,             /*!< No task, too many tasks, a task without period or handler, two open wire tasks or open wire and cross check tasks */
+    BMS_SCAN_ERR_SLOTS,             /*!< Hyperperiod longer than BMS_SCAN_MAX_SLOTS slots */
+    BMS_SCAN_ERR_AUX,               /*!< Auxiliary or open wire periods shorter than a conversion, auxiliary periods not multiples of each other */
+    BMS_SCAN_ERR_LOAD               /*!< A slot exceeds its SPI budget */
+} BMS_SCAN_ERR;
+
+typedef struct
+{
+    BMS_SCAN_MEAS eMeas;            /*!< Measurement */
+    uint8_t nTask;                  /*!< Index of the task in the plan */
+    int nStatus;                    /*!< Result of the read, the data is valid if 0 */
+    uint32_t nSlot;                 /*!< Slot of the read since the start */
+    uint64_t nTimestampUs;          /*!< Time of the read in microseconds */
+    union
+    {
+        int16_t anCellVoltage[BMS_APP_MAX_CELLS];   /*!< BMS_SCAN_MEAS_CELLS */
+        int32_t nCurrent;           /*!< BMS_SCAN_MEAS_CURRENT, first device */
+        int16_t anGpioVoltage[11];  /*!< BMS_SCAN_MEAS_GPIO, first device */
+        int16_t anStatVoltage[8];   /*!< BMS_SCAN_MEAS_STATUS, first device */
+        struct
+        {
+            int16_t anCellVoltage[BMS_APP_MAX_CELLS];   /*!< Cell voltages with the switches on */
+            Adbms6948_CellOWSelType eOWSel;     /*!< Switches of the conversion, ADBMS6948_CELL_OW_ODD or ADBMS6948_CELL_OW_EVEN */
+        } oOpenWire;                /*!< BMS_SCAN_MEAS_OPEN_WIRE */
+        struct
+        {
+            int16_t anCellVoltage[BMS_APP_MAX_CELLS];   /*!< C-ADC cell voltages */
+            int16_t anSCellVoltage[BMS_APP_MAX_CELLS];  /*!< S-ADC cell voltages of the same read */
+            uint16_t anCSFlt[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];   /*!< C vs S faults since the last read of each device, bit n for cell n + 1 */
+        } oCrossCheck;              /*!< BMS_SCAN_MEAS_CS_CHECK */
+    } u;
+} BMS_SCAN_RESULT;
+
+/*! Receives the results of a task on the scan thread */
+typedef void (*BMS_SCAN_HANDLER)(const BMS_SCAN_RESULT *poResult, void *pArg);
+
+typedef struct
+{
+    BMS_SCAN_MEAS eMeas;            /*!< Measurement */
+    uint32_t nPeriodMs;             /*!< Period in milliseconds */
+    BMS_SCAN_HANDLER pfHandler;     /*!< Receives every result */
+    void *pArg;                     /*!< Argument of pfHandler */
+} BMS_SCAN_TASK;
+
+typedef struct
+{
+    BMS_SCAN_TASK aoTask[BMS_SCAN_MAX_TASKS];   /*!< Tasks of the plan */
+    uint16_t anPhase[BMS_SCAN_MAX_TASKS];       /*!< First slot reading each task */
+    uint16_t anSlot[BMS_SCAN_MAX_SLOTS];        /*!< Tasks read in each slot, BMS_SCAN_SLOT_TRIG_AUX */
+    uint16_t anSlotLoadUs[BMS_SCAN_MAX_SLOTS];  /*!< Estimated SPI time of each slot */
+    uint32_t nSlotUs;                           /*!< Length of a slot */
+    uint16_t nNoOfSlots;                        /*!< Slots in the hyperperiod */
+    uint16_t nMaxLoadUs;                        /*!< Estimated SPI time of the busiest slot */
+    uint8_t nNoOfTasks;                         /*!< Tasks of the plan */
+    bool bContIVADC;                            /*!< Cell or current tasks, C-ADC and I1-ADC run continuously */
+    bool bRedundant;                            /*!< Cross check tasks, the C-ADC converts with redundancy */
+} BMS_SCAN_PLAN;
+
+typedef struct
+{
+    uint32_t nSlots;                /*!< Slots executed */
+    uint32_t nOverruns;             /*!< Slots that started late by a slot or ended after the next one was due */
+    uint32_t nReadErrors;           /*!< Failed reads and triggers */
+    uint32_t nMaxSlotUs;            /*!< Longest execution of a slot */
+    uint32_t nMaxLatenessUs;        /*!< Largest delay of a slot behind its schedule */
+    uint32_t nLastOverrunSlot;      /*!< Index in the hyperperiod of the last overrun slot */
+} BMS_SCAN_STATS;
+
+BMS_SCAN_ERR Adbms6948_Scan_Compile(const BMS_SCAN_TASK *paoTasks, uint8_t nNoOfTasks, uint8_t nNoOfDevices, BMS_SCAN_PLAN *poPlan);
+int Adbms6948_Scan_Start(const BMS_SCAN_PLAN *poPlan, const uint8_t knChainId);
+void Adbms6948_Scan_Stop(void);
+bool Adbms6948_Scan_IsRunning(void);
+void Adbms6948_Scan_GetStats(BMS_SCAN_STATS *poStats);
+
+#endif
+
+
+/*! @}*/
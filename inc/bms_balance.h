@@ -0,0 +1,58 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_balance.h
+ * @brief   Cell balancing policy. Computes the PWM discharge duty cycle of
+ *          every cell from the cell voltages, towards the lowest cell (top
+ *          balancing) or towards the lowest state of charge. Duty cycles
+ *          carry the state of the policy from one update to the next and
+ *          only change when a cell crosses a threshold, so the PWM register
+ *          groups are rewritten rarely.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Balance
+*  @{
+*/
+
+#ifndef __BMS_BALANCE_H
+#define __BMS_BALANCE_H
+
+#include <stdint.h>
+
+/*! Cells of a device, duty cycles are laid out with this stride */
+#define BMS_BAL_CELLS_PER_DEVICE    (16u)
+/*! Highest duty cycle, discharge switch always on */
+#define BMS_BAL_DUTY_MAX            (15u)
+
+/*! Balancing targets */
+typedef enum
+{
+    BMS_BAL_TARGET_TOP = 0,     /*!< Discharge every cell towards the lowest cell voltage */
+    BMS_BAL_TARGET_SOC          /*!< Discharge every cell towards the lowest cell state of charge */
+} BMS_BAL_TARGET;
+
+/*! Distances to the target are cell codes for BMS_BAL_TARGET_TOP and 0.01 % of state of charge for BMS_BAL_TARGET_SOC */
+typedef struct
+{
+    BMS_BAL_TARGET eTarget;     /*!< Balancing target */
+    int16_t nMinCellCode;       /*!< Cells below this cell code are neither discharged nor a target, e.g. unused inputs */
+    int16_t nStart;             /*!< Distance to the target at which a cell starts discharging */
+    int16_t nStop;              /*!< Distance to the target at which a discharging cell stops, below nStart */
+    int16_t nFullDuty;          /*!< Distance to the target discharged at BMS_BAL_DUTY_MAX, above nStart */
+} BMS_BAL_CFG;
+
+uint16_t BmsBal_Update(const BMS_BAL_CFG *poCfg, const int16_t *panCells, const int16_t *panSoc,
+                       uint8_t nNoOfDevices, uint8_t bDischargePaused, uint8_t *panDuty);
+
+#endif
+
+
+/*! @}*/
@@ -0,0 +1,71 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_charge.h
+ * @brief   Charge accounting on the coulomb counter of the ADBMS6948. The
+ *          counter sums the I1-ADC results on the device and the time base
+ *          counts the conversions, so reading both once in a while integrates
+ *          the current without reading every conversion. The charge is kept
+ *          exactly as the 64-bit sum of I1-ADC codes and converted to
+ *          microampere hours and state of charge on request.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Charge
+*  @{
+*/
+
+#ifndef __BMS_CHARGE_H
+#define __BMS_CHARGE_H
+
+#include <stdint.h>
+
+/*! Coulomb counter fault, nCoulCntFlt of the status register values */
+#define BMS_CHG_FLT_COUNT           (1u << 0)
+/*! Time base fault, nTimeBaseFlt of the status register values */
+#define BMS_CHG_FLT_TIMEBASE        (1u << 1)
+/*! Coulomb counter sequence error, nCoulCntSeqErr of the status register values */
+#define BMS_CHG_FLT_SEQUENCE        (1u << 2)
+
+/*! Full state of charge, 0.01 % */
+#define BMS_CHG_SOC_FULL            (10000)
+
+/*! Charge accounting parameters */
+typedef struct
+{
+    uint32_t nShuntMicroOhm;    /*!< Shunt resistance, micro-ohms */
+    uint32_t nConvPeriodNs;     /*!< I1-ADC conversion period, one time base count, nanoseconds */
+    uint32_t nCapacityMilliAh;  /*!< Pack capacity, milliampere hours */
+} BMS_CHG_CFG;
+
+/*! Charge accounting state, the charge has the sign of the I1-ADC codes, positive while charging */
+typedef struct
+{
+    int64_t  nCodeSum;          /*!< Accumulated I1-ADC codes, 1 uV of shunt voltage for one conversion period each */
+    uint32_t nLastCount;        /*!< Coulomb count of the last sample */
+    uint16_t nLastTimeBase;     /*!< Time base of the last sample */
+    uint8_t  bSynced;           /*!< 1 while the last sample is the reference of the next one */
+    int32_t  nIntervalSum;      /*!< I1-ADC codes added by the last accepted sample */
+    uint16_t nIntervalConv;     /*!< Conversions covered by the last accepted sample */
+    uint32_t nConversions;      /*!< Conversions accumulated */
+    uint16_t nRollovers;        /*!< Time base wraps seen */
+    uint16_t nFaults;           /*!< Samples discarded for a fault */
+    int16_t  nInitialSoc;       /*!< State of charge at nCodeSum 0, 0.01 % */
+} BMS_CHG_STATE;
+
+void BmsChg_Init(BMS_CHG_STATE *poState, int16_t nSocCentiPct);
+uint8_t BmsChg_Update(BMS_CHG_STATE *poState, uint32_t nCount, uint16_t nTimeBase, uint8_t nFaults);
+int64_t BmsChg_GetMicroAh(const BMS_CHG_CFG *poCfg, const BMS_CHG_STATE *poState);
+int16_t BmsChg_GetSocCentiPct(const BMS_CHG_CFG *poCfg, const BMS_CHG_STATE *poState);
+
+#endif
+
+
+/*! @}*/
@@ -0,0 +1,80 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_cs.h
+ * @brief   Plausibility of the redundant cell voltage measurements. The C-ADC
+ *          and S-ADC results of every cell, read together by
+ *          Adbms6948_ReadCellVoltCS, are compared in software and the result
+ *          is reconciled with the C vs S fault flags of the devices: a cell
+ *          agrees, disagrees in the read results only, is flagged by the
+ *          device only, or both. A cell raises its diagnostic after a number
+ *          of consecutive disagreeing scans and clears it after a number of
+ *          consecutive agreeing ones, so a single disturbed conversion never
+ *          reaches the application. tools/bms_cs_check.cpp drives a cell
+ *          through every class on the simulated chain.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Cs
+*  @{
+*/
+
+#ifndef __BMS_CS_H
+#define __BMS_CS_H
+
+#include <stdint.h>
+
+/*! Cells cross checked, a full 16-device chain unless the build lowers it */
+#ifndef BMS_CS_MAX_CELLS
+#define BMS_CS_MAX_CELLS            (256u)
+#endif
+
+/*! Cells of a device, one C vs S fault flag each */
+#define BMS_CS_CELLS_PER_DEVICE     (16u)
+
+/*! C and S agree and the device did not flag the cell */
+#define BMS_CS_AGREE                (0u)
+/*! C and S of the read differ, the device did not flag the cell, e.g. a threshold above nMaxDelta */
+#define BMS_CS_SW_ONLY              (1u)
+/*! The device flagged the cell, C and S of the read agree, e.g. a mismatch in a conversion between two reads */
+#define BMS_CS_CHIP_ONLY            (2u)
+/*! C and S of the read differ and the device flagged the cell */
+#define BMS_CS_BOTH                 (3u)
+/*! Classes of a cell */
+#define BMS_CS_NO_OF_CLASSES        (4u)
+
+/*! Cross check parameters */
+typedef struct
+{
+    int16_t nMaxDelta;          /*!< Largest |C - S| of agreeing results, cell codes, the comparison threshold of the devices */
+    uint8_t nRaise;             /*!< Consecutive disagreeing scans raising the diagnostic of a cell, 1 to 255 */
+    uint8_t nClear;             /*!< Consecutive agreeing scans clearing it, 1 to 255 */
+} BMS_CS_CFG;
+
+/*! Cross check state of every cell, laid out as the cell codes */
+typedef struct
+{
+    uint16_t nNoOfCells;                            /*!< Cells checked */
+    uint16_t nRaised;                               /*!< Cells with the diagnostic raised */
+    uint32_t nScans;                                /*!< Scans since BmsCs_Init */
+    uint16_t anClassCells[BMS_CS_NO_OF_CLASSES];    /*!< Cells of every BMS_CS_* class in the last scan */
+    uint8_t anClass[BMS_CS_MAX_CELLS];              /*!< BMS_CS_* class of the last scan */
+    uint8_t anRun[BMS_CS_MAX_CELLS];                /*!< Consecutive scans against the diagnostic, disagreeing while clear, agreeing while raised */
+    uint8_t abRaised[BMS_CS_MAX_CELLS];             /*!< Diagnostic raised */
+} BMS_CS_STATE;
+
+void BmsCs_Init(BMS_CS_STATE *poState, uint16_t nNoOfCells);
+uint16_t BmsCs_Update(const BMS_CS_CFG *poCfg, BMS_CS_STATE *poState, const int16_t *panCellC,
+                      const int16_t *panCellS, const uint16_t *panCSFlt);
+
+#endif
+
+
+/*! @}*/
@@ -0,0 +1,70 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_ow.h
+ * @brief   Open wire verdicts of the cell wires. Each open wire measurement
+ *          switches either the odd or the even wires and is evaluated per
+ *          cell by Adbms6948_CellOWDiag; a pass only carries information on
+ *          the wires it switched. The evaluations of every wire are
+ *          accumulated as saturating evidence, so a wire is reported open or
+ *          closed once enough passes agree, with a confidence in percent in
+ *          between. tools/bms_ow_check.cpp runs it on the simulated chain.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Ow
+*  @{
+*/
+
+#ifndef __BMS_OW_H
+#define __BMS_OW_H
+
+#include <stdint.h>
+
+/*! Wires tracked, one per cell; the build may lower it for shorter chains */
+#ifndef BMS_OW_MAX_CELLS
+#define BMS_OW_MAX_CELLS            (256u)
+#endif
+
+/*! Wire connected, the values are the ADBMS6948_OW_* statuses of the driver */
+#define BMS_OW_CLOSED               (0u)
+/*! Wire open */
+#define BMS_OW_OPEN                 (1u)
+/*! No decision */
+#define BMS_OW_UNDECIDED            (2u)
+
+/*! Pass with the switches of the even wires, C2, C4, ..., ADBMS6948_CELL_OW_EVEN */
+#define BMS_OW_PASS_EVEN            (0u)
+/*! Pass with the switches of the odd wires, C1, C3, ..., ADBMS6948_CELL_OW_ODD */
+#define BMS_OW_PASS_ODD             (1u)
+
+/*! Open wire accumulation parameters */
+typedef struct
+{
+    uint8_t nConfirm;           /*!< Agreeing evaluations reporting a wire open or closed, 1 to 127 */
+} BMS_OW_CFG;
+
+/*! Open wire state of every cell wire, laid out as the cell codes, entry n for the wire at the top of cell n + 1 */
+typedef struct
+{
+    uint16_t nNoOfCells;                    /*!< Cells evaluated */
+    uint32_t anPasses[2];                   /*!< Passes evaluated, indexed by BMS_OW_PASS_* */
+    int8_t anEvidence[BMS_OW_MAX_CELLS];    /*!< +1 per open, -1 per closed evaluation, saturated at nConfirm */
+} BMS_OW_STATE;
+
+void BmsOw_Init(BMS_OW_STATE *poState, uint16_t nNoOfCells);
+void BmsOw_Update(const BMS_OW_CFG *poCfg, BMS_OW_STATE *poState, const uint8_t *panStatus, uint8_t nPass);
+uint16_t BmsOw_GetVerdicts(const BMS_OW_CFG *poCfg, const BMS_OW_STATE *poState, uint8_t *panVerdict,
+                           uint8_t *panConfidencePct, uint16_t *pnDecided);
+
+#endif
+
+
+/*! @}*/
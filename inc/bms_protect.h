@@ -0,0 +1,59 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_protect.h
+ * @brief   Cell voltage protection evaluator. Evaluates the cell codes of a
+ *          whole chain against over and under voltage thresholds in one pass
+ *          and reports per device OV/UV bitmaps together with the minimum,
+ *          maximum and mean cell and the deviation of every cell from the
+ *          mean. Pure computation, no driver state and no chain lock. Two
+ *          cells are compared per instruction with the DSP extension of the
+ *          Cortex-M4; builds without it, e.g. on the host, use a portable
+ *          path with the same results.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Protect
+*  @{
+*/
+
+#ifndef __BMS_PROTECT_H
+#define __BMS_PROTECT_H
+
+#include <stdint.h>
+
+/*! Cells of a device, one bit each in the OV/UV bitmaps */
+#define BMS_PROT_MAX_CELLS_PER_DEVICE   (16u)
+
+typedef struct
+{
+    int16_t nOvCode;        /*!< Over voltage threshold, cells with a higher code are flagged */
+    int16_t nUvCode;        /*!< Under voltage threshold, cells with a lower code are flagged */
+} BMS_PROT_LIMITS;
+
+typedef struct
+{
+    int16_t nMinCode;       /*!< Lowest cell code */
+    int16_t nMaxCode;       /*!< Highest cell code */
+    int16_t nAvgCode;       /*!< Mean cell code, rounded towards zero */
+    uint16_t nMinCell;      /*!< Index of the first lowest cell in the cell array */
+    uint16_t nMaxCell;      /*!< Index of the first highest cell in the cell array */
+    uint16_t nOvCells;      /*!< Number of cells over voltage */
+    uint16_t nUvCells;      /*!< Number of cells under voltage */
+} BMS_PROT_SUMMARY;
+
+void BmsProt_EvalCells(const int16_t *panCells, uint8_t nNoOfDevices, uint8_t nCellsPerDevice,
+                       const BMS_PROT_LIMITS *poLimits, uint16_t *panOvMask, uint16_t *panUvMask,
+                       int16_t *panDelta, BMS_PROT_SUMMARY *poSummary);
+
+#endif
+
+
+/*! @}*/
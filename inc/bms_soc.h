@@ -0,0 +1,74 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_soc.h
+ * @brief   State of charge estimator. An extended Kalman filter per cell on
+ *          a first order RC equivalent circuit: open circuit voltage from a
+ *          table over the state of charge, a series resistance and one RC
+ *          pair. The states of all the cells are kept in parallel arrays and
+ *          updated by one loop without branches, so a series string of cells
+ *          sharing the pack current is updated in a single pass. The state is
+ *          statically sized by BMS_SOC_MAX_CELLS. tools/bms_soc_bench.cpp
+ *          runs it on the host against a simulated string of cells.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Soc
+*  @{
+*/
+
+#ifndef __BMS_SOC_H
+#define __BMS_SOC_H
+
+#include <stdint.h>
+
+/*! Length of the per-cell filter arrays, a full 16-device chain by default */
+#ifndef BMS_SOC_MAX_CELLS
+#define BMS_SOC_MAX_CELLS           (256u)
+#endif
+
+/*! Cell model and filter tuning, SI units, positive current charges the cells */
+typedef struct
+{
+    const int32_t *panOcvUv;    /*!< Open circuit voltage at nOcvPoints states of charge evenly spaced from 0 to 1, microvolts, rising */
+    uint8_t nOcvPoints;         /*!< Points of the open circuit voltage table, at least 2 */
+    float fR0;                  /*!< Series resistance, ohms */
+    float fR1;                  /*!< Resistance of the RC pair, ohms */
+    float fTau1;                /*!< Time constant of the RC pair, seconds */
+    float fCapacityAh;          /*!< Nominal cell capacity, ampere hours */
+    float fChargeEfficiency;    /*!< Coulombic efficiency while charging, 0 to 1 */
+    float fProcNoiseSoc;        /*!< Process noise of the state of charge, 1/s */
+    float fProcNoiseVrc;        /*!< Process noise of the RC pair voltage, V^2/s */
+    float fMeasNoise;           /*!< Variance of a cell voltage measurement, V^2 */
+    float fInitVarSoc;          /*!< Variance of the initial state of charge */
+} BMS_SOC_CFG;
+
+/*! Filter state of every cell, laid out as the cell codes */
+typedef struct
+{
+    uint16_t nNoOfCells;                    /*!< Cells estimated */
+    uint32_t nUpdates;                      /*!< Updates since BmsSoc_Init */
+    float afSoc[BMS_SOC_MAX_CELLS];         /*!< State of charge, 0 to 1 */
+    float afVrc[BMS_SOC_MAX_CELLS];         /*!< Voltage of the RC pair, volts */
+    float afP00[BMS_SOC_MAX_CELLS];         /*!< Covariance of the state of charge */
+    float afP01[BMS_SOC_MAX_CELLS];         /*!< Covariance of the state of charge and RC pair voltage */
+    float afP11[BMS_SOC_MAX_CELLS];         /*!< Covariance of the RC pair voltage */
+    float afHealth[BMS_SOC_MAX_CELLS];      /*!< State of health, capacity over the nominal capacity, 1 after BmsSoc_Init */
+} BMS_SOC_STATE;
+
+void BmsSoc_Init(const BMS_SOC_CFG *poCfg, BMS_SOC_STATE *poState, const int16_t *panCells, uint16_t nNoOfCells);
+void BmsSoc_Update(const BMS_SOC_CFG *poCfg, BMS_SOC_STATE *poState, const int16_t *panCells,
+                   float fCurrentA, float fDtS);
+void BmsSoc_GetSocCentiPct(const BMS_SOC_STATE *poState, int16_t *panSoc);
+
+#endif
+
+
+/*! @}*/
@@ -0,0 +1,100 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_telemetry.h
+ * @brief   Binary telemetry codec. Messages are little endian, versioned and
+ *          protected by a CRC-16, then COBS encoded and terminated by a zero
+ *          byte. The codec has no platform dependencies and is shared by the
+ *          firmware and the host decoder.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Telemetry
+*  @{
+*/
+
+#ifndef __BMS_TELEMETRY_H
+#define __BMS_TELEMETRY_H
+
+#include <stdint.h>
+
+/*! Version of the message layout, first byte of every message */
+#define BMS_TLM_SCHEMA_VERSION      (1u)
+
+/*! Sample message: sequence, timestamp, CT values, current and cell codes */
+#define BMS_TLM_MSG_SAMPLE          (0x01u)
+/*! Acquisition statistics message */
+#define BMS_TLM_MSG_STATS           (0x02u)
+
+/*! Maximum number of cell codes in a sample message */
+#define BMS_TLM_MAX_CELLS           (16u)
+/*! Length of the message header: version and message type */
+#define BMS_TLM_HDR_LEN             (2u)
+/*! Length of the CRC-16 */
+#define BMS_TLM_CRC_LEN             (2u)
+/*! Longest message before framing, a sample message with all cells */
+#define BMS_TLM_MAX_MSG_LEN         (BMS_TLM_HDR_LEN + 21u + (2u * BMS_TLM_MAX_CELLS) + BMS_TLM_CRC_LEN)
+/*! Longest frame: COBS overhead of one byte per 254 bytes and the delimiter */
+#define BMS_TLM_MAX_FRAME_LEN       (BMS_TLM_MAX_MSG_LEN + (BMS_TLM_MAX_MSG_LEN / 254u) + 2u)
+
+/*! Frame decoded into a message */
+#define BMS_TLM_DEC_MSG             (1)
+/*! More bytes are needed */
+#define BMS_TLM_DEC_PENDING         (0)
+/*! Frame dropped: bad COBS, CRC, version, type or length */
+#define BMS_TLM_DEC_ERROR           (-1)
+
+typedef struct
+{
+    uint32_t nSeqNum;                           /*!< Sample number*/
+    uint64_t nTimestampUs;                      /*!< Time of the sample in microseconds*/
+    uint16_t nVoltageCT;                        /*!< Value of CT bits for Voltage*/
+    uint16_t nCurrentCT;                        /*!< Value of CT bits for Current*/
+    int32_t nCurrent;                           /*!< Current channel 1 code*/
+    uint8_t nNoOfCells;                         /*!< Number of valid cell codes*/
+    int16_t anCellVoltage[BMS_TLM_MAX_CELLS];   /*!< Cell voltage codes*/
+} BMS_TLM_SAMPLE;
+
+typedef struct
+{
+    uint32_t nSamples;                          /*!< Samples published*/
+    uint32_t nOverruns;                         /*!< Samples dropped*/
+    uint32_t nReadErrors;                       /*!< Failed reads*/
+    uint32_t nMaxLatenessUs;                    /*!< Largest delay behind the schedule*/
+} BMS_TLM_STATS;
+
+typedef struct
+{
+    uint8_t nVersion;                           /*!< Schema version of the message*/
+    uint8_t nMsgType;                           /*!< BMS_TLM_MSG_SAMPLE or BMS_TLM_MSG_STATS*/
+    union
+    {
+        BMS_TLM_SAMPLE oSample;
+        BMS_TLM_STATS oStats;
+    } u;
+} BMS_TLM_MSG;
+
+typedef struct
+{
+    uint8_t anFrame[BMS_TLM_MAX_FRAME_LEN];     /*!< Encoded bytes of the frame being received*/
+    uint16_t nLen;                              /*!< Number of bytes in anFrame*/
+    bool bOverflow;                             /*!< Frame longer than any valid frame*/
+    uint32_t nMsgs;                             /*!< Messages decoded*/
+    uint32_t nErrors;                           /*!< Frames dropped*/
+} BMS_TLM_DECODER;
+
+uint16_t BmsTlm_EncodeSample(const BMS_TLM_SAMPLE *poSample, uint8_t *pFrame);
+uint16_t BmsTlm_EncodeStats(const BMS_TLM_STATS *poStats, uint8_t *pFrame);
+uint16_t BmsTlm_Crc16(const uint8_t *pData, uint16_t nLen);
+void BmsTlm_DecoderInit(BMS_TLM_DECODER *poDec);
+int BmsTlm_DecoderPush(BMS_TLM_DECODER *poDec, uint8_t nByte, BMS_TLM_MSG *poMsg);
+
+#endif
+/*! @}*/
@@ -0,0 +1,62 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_units.h
+ * @brief   Fixed-point conversion of ADC codes to engineering units. Voltages
+ *          are reported in microvolts, shunt voltages in nanovolts and
+ *          temperatures in milli-degrees Celsius, all in 32-bit integers, so
+ *          protection logic runs without floating point. The float macros of
+ *          Adbms6948.h remain for display. tools/bms_units_check.cpp pins
+ *          the conversions on the host.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Units
+*  @{
+*/
+
+#ifndef __BMS_UNITS_H
+#define __BMS_UNITS_H
+
+#include <stdint.h>
+
+/*! Weight of one code of the C, S and auxiliary ADCs, microvolts */
+#define BMS_UNITS_ADC_LSB_UV                (150)
+/*! Voltage of code 0 of the C, S and auxiliary ADCs, microvolts */
+#define BMS_UNITS_ADC_OFFSET_UV             (1500000)
+
+/*! Cell, GPIO and auxiliary voltage code to microvolts */
+#define BMS_UNITS_CODE_TO_UV(x)             ((((int32_t)(x)) * BMS_UNITS_ADC_LSB_UV) + BMS_UNITS_ADC_OFFSET_UV)
+/*! Microvolts to the cell voltage code, rounded towards 1.5 V, e.g. to precompute thresholds */
+#define BMS_UNITS_UV_TO_CODE(x)             ((int16_t)((((int32_t)(x)) - BMS_UNITS_ADC_OFFSET_UV) / BMS_UNITS_ADC_LSB_UV))
+/*! Supply voltage VP code to microvolts, the input is divided by 25 */
+#define BMS_UNITS_VP_CODE_TO_UV(x)          (BMS_UNITS_CODE_TO_UV(x) * 25)
+/*! Die temperature ITMP code to milli-degrees Celsius, 7.5 mV/K */
+#define BMS_UNITS_ITMP_CODE_TO_MDEGC(x)     (((BMS_UNITS_CODE_TO_UV(x) * 2) / 15) - 273000)
+/*! I1/I2-ADC code to shunt nanovolts, 1 uV per code */
+#define BMS_UNITS_CURRENT_CODE_TO_NV(x)     (((int32_t)(x)) * 1000)
+/*! Averaged I1/I2-ADC code to shunt nanovolts, 0.125 uV per code */
+#define BMS_UNITS_AVG_CURRENT_CODE_TO_NV(x) (((int32_t)(x)) * 125)
+
+/*! GPIO code of the first point of the thermistor table, 0 V */
+#define BMS_UNITS_NTC_FIRST_CODE            (-10000)
+/*! GPIO codes between two points of the thermistor table, 76.8 mV */
+#define BMS_UNITS_NTC_STEP_CODES            (512)
+/*! Points of the thermistor table, 0 V to 4.9152 V */
+#define BMS_UNITS_NTC_NO_OF_POINTS          (65u)
+
+void BmsUnits_CodesToUv(const int16_t *panCode, int32_t *panUv, uint16_t nCount);
+int32_t BmsUnits_ThermistorMilliDegC(int16_t nGpioCode);
+void BmsUnits_GpiosToMilliDegC(const int16_t *panCode, int32_t *panMilliDegC, uint16_t nCount);
+
+#endif
+
+
+/*! @}*/
@@ -29,6 +29,8 @@ void PrintCurrent(int32_t *raw_current);
 void PrintAverageCurrent(int32_t *raw_current);
 void PrintGpioVoltage(int16_t *paVoltages);
 void PrintStatusVoltage(int16_t *praw_voltages);
+void PrintOpenWire(uint8_t *panVerdict, uint8_t *panConfidencePct);
+void PrintCrossCheck(uint8_t *panClass, uint8_t *pabRaised);
 void PrintCellOVUVFlags(uint32_t nCellUVStatus, uint32_t nCellOVStatus);
 void PrintAlwaysOnData(uint8_t *panDataArray);
 
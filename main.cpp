@@ -16,6 +16,7 @@ Analog Devices License Agreement.
 #include "common.h"
 #include "print_result.h"
 #include "Adbms6948_Applications.h"
+#include "adi_bms_platform.h"
 
 // LED Blinking rate in milliseconds (Note: need to define the unit of a time duration i.e. seconds(s) or milliseconds(ms))
 #define SLEEP_TIME                  500ms
@@ -32,9 +33,10 @@ DigitalOut sclk(D13);                       /* SCK */
 
 SPI spi(D11, D12, D13);                     /* SPI MOSI, MISO, SCK */
 
-Timer timer;
-
-Timeout timeout;
+/* SPI bus and chip select of every daisy chain, one entry per chain ID */
+const adi_pal_ChainBindingType adi_pal_aoChainBinding[ADBMS6948_NO_OF_DAISY_CHAIN] = {
+    { &spi, &chip_select },                 /* Chain 0 */
+};
 
 // The File handler is needed to allow printf commands to write to the terminal
 FileHandle *mbed::mbed_override_console(int fd)
@@ -54,9 +56,13 @@ int main()
     );
 
     /* Initialize peripherals */
-    chip_select = 1;
+    adi_pal_Init();                 /* Start the PAL time base */
+    PLATFORM_SPI_INIT();            /* Deselect every daisy chain */
     spi.format(8,0);                /* 8bit data, CPOL-CPHA= 0*/
     spi.frequency(2000000);         /* SPI clock 2Mhz */
+#if DEVICE_SPI_ASYNCH
+    spi.set_dma_usage(DMA_USAGE_OPPORTUNISTIC); /* Use DMA for asynchronous transfers where available */
+#endif
     serial_port.set_baud(115200);   /* UART baud rate is 115200 */
 
     PrintMenu();
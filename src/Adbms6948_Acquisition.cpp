@@ -0,0 +1,278 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    Adbms6948_Acquisition.cpp
+ * @brief   Continuous acquisition engine. The C-ADC and I1-ADC run in
+ *          continuous mode and a periodic event on a dedicated thread reads
+ *          the averages of the last period. Each sample is published to a
+ *          single producer ring; every consumer keeps its own read index and
+ *          drains the ring without locks.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Adbms6948_AppsExample
+*  @{
+*/
+
+#include "Adbms6948_Acquisition.h"
+#include "Adbms6948_ScanPlan.h"
+
+/*! Index mask of the acquisition ring */
+#define BMS_ACQ_RING_MASK           (BMS_ACQ_RING_SIZE - 1u)
+/*! Stack of the sampling thread, holds the driver read buffers */
+#define BMS_ACQ_THREAD_STACK_SIZE   (4096u)
+
+#if ((BMS_ACQ_RING_SIZE & BMS_ACQ_RING_MASK) != 0u)
+#error "BMS_ACQ_RING_SIZE must be a power of two"
+#endif
+
+static BMS_BUFFER aoAcqRing[BMS_ACQ_RING_SIZE];
+static BMS_BUFFER oAcqScratch;                                      /*! Sample dropped on overrun */
+static volatile uint32_t nAcqHead = 0u;                             /*! Written by the producer only */
+static volatile uint32_t anAcqTail[BMS_ACQ_NO_OF_CONSUMERS];        /*! Written by each consumer only */
+static volatile bool abAcqAttached[BMS_ACQ_NO_OF_CONSUMERS];
+static volatile BMS_ACQ_STATS oAcqStats;
+
+static EventQueue oAcqQueue(8 * EVENTS_EVENT_SIZE);
+static Thread oAcqThread(osPriorityAboveNormal, BMS_ACQ_THREAD_STACK_SIZE, NULL, "bms_acq");
+static bool bAcqThreadStarted = false;
+static Semaphore oAcqIdle(0, 1);
+static Timer oAcqTimer;
+
+static int nAcqEventId = 0;
+static uint8_t nAcqChainId = 0u;
+static uint32_t nAcqPeriodUs = 0u;
+static uint64_t nAcqNextDueUs = 0u;
+static uint32_t nAcqSeqNum = 0u;
+
+static void Adbms6948_acq_sample(void);
+static void Adbms6948_acq_release_idle(void);
+static bool Adbms6948_acq_has_room(uint32_t nHead);
+
+/*!
+    @brief  Start the continuous acquisition
+
+    Triggers the C-ADC and I1-ADC in continuous mode and schedules the
+    sampling event every @c nPeriodMs on the acquisition thread. The engine
+    is the only user of the driver until Adbms6948_Acq_Stop() returns. Every
+    run starts with an empty ring, sequence number 0 and cleared statistics;
+    consumers attached before the start read from its first frame.
+
+    @param[in]  nPeriodMs Sampling period in milliseconds
+    @param[in]  knChainId Daisy chain ID
+
+    @return 0 on success, non-zero otherwise
+*/
+int Adbms6948_Acq_Start(uint32_t nPeriodMs, const uint8_t knChainId)
+{
+    int nRet = 0;
+    /*Trigger C-ADC and I1-ADC simultaneously in Continuous mode*/
+    Adbms6948_TrigIVADCInputs oTrigIVADCInputs = {
+        TRUE,                   /*Adbms6948_bContMode*/
+        TRUE,                   /*Adbms6948_bEnRedun*/
+        FALSE,                  /*Adbms6948_bEnSSDP*/
+        FALSE,                  /*Adbms6948_bRstIIRFltr*/
+        ADBMS6948_CELL_OW_NONE  /*Adbms6948_eOWSel*/
+    };
+
+    if((nAcqEventId != 0) || (nPeriodMs < BMS_ACQ_MIN_PERIOD_MS) || (Adbms6948_Scan_IsRunning() == true)) {
+        nRet = 1;
+    }
+
+    if(nRet == 0) {
+        if(bAcqThreadStarted == false) {
+            oAcqTimer.start();
+            nRet = (int)oAcqThread.start(callback(&oAcqQueue, &EventQueue::dispatch_forever));
+            bAcqThreadStarted = (nRet == 0);
+        }
+    }
+
+    if(nRet == 0) {
+        nRet = Adbms6948_TrigIVADC(&oTrigIVADCInputs, knChainId);
+    }
+
+    if(nRet == 0) {
+        /* The sampling event is not scheduled, nothing else writes the ring */
+        core_util_atomic_store_u32(&nAcqHead, 0u);
+        for(uint8_t nConsumer = 0u; nConsumer < (uint8_t)BMS_ACQ_NO_OF_CONSUMERS; nConsumer++) {
+            core_util_atomic_store_u32(&anAcqTail[nConsumer], 0u);
+        }
+        memset((void *)&oAcqStats, 0, sizeof(oAcqStats));
+        nAcqSeqNum = 0u;
+        nAcqChainId = knChainId;
+        nAcqPeriodUs = nPeriodMs * 1000u;
+        /* Discard the averages accumulated before the first period */
+        nAcqNextDueUs = (uint64_t)oAcqTimer.elapsed_time().count() + nAcqPeriodUs;
+        nAcqEventId = oAcqQueue.call_every(std::chrono::milliseconds(nPeriodMs), Adbms6948_acq_sample);
+        if(nAcqEventId == 0) {
+            nRet = 1;
+        }
+    }
+    return nRet;
+}
+
+/*!
+    @brief  Stop the continuous acquisition
+
+    Cancels the sampling event and returns once a sample in progress has
+    completed, so the caller may use the driver again.
+*/
+void Adbms6948_Acq_Stop(void)
+{
+    if(nAcqEventId != 0) {
+        oAcqQueue.cancel(nAcqEventId);
+        nAcqEventId = 0;
+        /* The queue runs its events in order, the sample in progress ends before this one runs */
+        oAcqQueue.call(Adbms6948_acq_release_idle);
+        oAcqIdle.acquire();
+    }
+}
+
+/*!
+    @brief  Check whether the acquisition is running
+
+    @return true if the sampling event is scheduled
+*/
+bool Adbms6948_Acq_IsRunning(void)
+{
+    return (nAcqEventId != 0);
+}
+
+/*!
+    @brief  Attach a consumer to the acquisition ring
+
+    The consumer starts with the next published frame. Only attached
+    consumers hold back the producer; a full consumer makes the producer
+    drop the frame and count an overrun.
+
+    @param[in]  eConsumer Consumer to attach
+*/
+void Adbms6948_Acq_Attach(BMS_ACQ_CONSUMER eConsumer)
+{
+    core_util_atomic_store_u32(&anAcqTail[eConsumer], core_util_atomic_load_u32(&nAcqHead));
+    core_util_atomic_store_bool(&abAcqAttached[eConsumer], true);
+}
+
+/*!
+    @brief  Detach a consumer from the acquisition ring
+
+    @param[in]  eConsumer Consumer to detach
+*/
+void Adbms6948_Acq_Detach(BMS_ACQ_CONSUMER eConsumer)
+{
+    core_util_atomic_store_bool(&abAcqAttached[eConsumer], false);
+}
+
+/*!
+    @brief  Take the oldest unread frame of a consumer
+
+    Each consumer must be drained from a single thread.
+
+    @param[in]  eConsumer Consumer draining the ring
+    @param[out] poFrame   Placeholder for the frame
+
+    @return true if a frame was copied, false if the consumer is drained
+*/
+bool Adbms6948_Acq_Pop(BMS_ACQ_CONSUMER eConsumer, BMS_BUFFER *poFrame)
+{
+    bool bRet = false;
+    uint32_t nTail = core_util_atomic_load_u32(&anAcqTail[eConsumer]);
+
+    if(nTail != core_util_atomic_load_u32(&nAcqHead)) {
+        *poFrame = aoAcqRing[nTail & BMS_ACQ_RING_MASK];
+        /* Hand the slot back to the producer only after the copy */
+        core_util_atomic_store_u32(&anAcqTail[eConsumer], nTail + 1u);
+        bRet = true;
+    }
+    return bRet;
+}
+
+/*!
+    @brief  Get the acquisition statistics
+
+    @param[out] poStats Placeholder for the statistics
+*/
+void Adbms6948_Acq_GetStats(BMS_ACQ_STATS *poStats)
+{
+    poStats->nSamples = core_util_atomic_load_u32(&oAcqStats.nSamples);
+    poStats->nOverruns = core_util_atomic_load_u32(&oAcqStats.nOverruns);
+    poStats->nReadErrors = core_util_atomic_load_u32(&oAcqStats.nReadErrors);
+    poStats->nMaxLatenessUs = core_util_atomic_load_u32(&oAcqStats.nMaxLatenessUs);
+}
+
+/*!
+    @brief  Check that every attached consumer has a free slot
+
+    @param[in]  nHead Current write index
+
+    @return true if the frame at @c nHead may be written
+*/
+static bool Adbms6948_acq_has_room(uint32_t nHead)
+{
+    bool bRet = true;
+
+    for(uint8_t nConsumer = 0u; nConsumer < (uint8_t)BMS_ACQ_NO_OF_CONSUMERS; nConsumer++) {
+        if(core_util_atomic_load_bool(&abAcqAttached[nConsumer]) &&
+           ((nHead - core_util_atomic_load_u32(&anAcqTail[nConsumer])) >= BMS_ACQ_RING_SIZE)) {
+            bRet = false;
+        }
+    }
+    return bRet;
+}
+
+/*!
+    @brief  Read the averages of the last period and publish them
+
+    Runs on the acquisition thread. A sample is always read, even when it is
+    dropped, so that every frame covers exactly one period.
+*/
+static void Adbms6948_acq_sample(void)
+{
+    int nRet;
+    uint32_t nHead = nAcqHead;
+    uint64_t nNowUs = (uint64_t)oAcqTimer.elapsed_time().count();
+    bool bRoom = Adbms6948_acq_has_room(nHead);
+    BMS_BUFFER *poFrame = bRoom ? &aoAcqRing[nHead & BMS_ACQ_RING_MASK] : &oAcqScratch;
+
+    if((nNowUs > nAcqNextDueUs) && ((uint32_t)(nNowUs - nAcqNextDueUs) > oAcqStats.nMaxLatenessUs)) {
+        core_util_atomic_store_u32(&oAcqStats.nMaxLatenessUs, (uint32_t)(nNowUs - nAcqNextDueUs));
+    }
+    nAcqNextDueUs += nAcqPeriodUs;
+
+    poFrame->nTimestampUs = nNowUs;
+    poFrame->nSeqNum = nAcqSeqNum++;
+    nRet = Adbms6948_ReadCellVoltCurrentAverage(
+               &poFrame->anCellVoltage[0],
+               &poFrame->anCurrent[0],
+               TRUE,
+               &poFrame->nVoltageCT,
+               &poFrame->nCurrentCT,
+               nAcqChainId);
+
+    if(nRet != 0) {
+        core_util_atomic_incr_u32(&oAcqStats.nReadErrors, 1u);
+    } else if(bRoom == false) {
+        core_util_atomic_incr_u32(&oAcqStats.nOverruns, 1u);
+    } else {
+        /* Publish the frame after it is complete */
+        core_util_atomic_store_u32(&nAcqHead, nHead + 1u);
+        core_util_atomic_incr_u32(&oAcqStats.nSamples, 1u);
+    }
+}
+
+/*!
+    @brief  Signal Adbms6948_Acq_Stop() that no sample is in progress
+*/
+static void Adbms6948_acq_release_idle(void)
+{
+    oAcqIdle.release();
+}
+
+/*! @}*/
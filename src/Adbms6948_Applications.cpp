@@ -18,9 +18,22 @@ Analog Devices License Agreement.
 */
 
 #include "Adbms6948_Applications.h"
+#include "Adbms6948_Acquisition.h"
+#include "Adbms6948_Conversion.h"
+#include "Adbms6948_ScanPlan.h"
+#include "bms_balance.h"
+#include "bms_charge.h"
+#include "bms_configuration.h"
+#include "bms_cs.h"
+#include "bms_ow.h"
+#include "bms_protect.h"
+#include "bms_soc.h"
+#include "bms_telemetry.h"
+#include "bms_units.h"
 #include "print_result.h"
+#include "BufferedSerial.h"
 
-const uint32_t LOOP_MEASUREMENT_COUNT = 10;      /*! Loop measurment count */
+extern mbed::BufferedSerial serial_port;
 
 const uint8_t knChainId = 0u;
 uint8_t nNumCells = 16u;
@@ -34,8 +47,11 @@ Adbms6948_DaisyChainCfgType oDaisyChainConfig = {
     0x4E2u,     /* Over voltage threshold (val * 16 * 100uV) */
     0x271u,     /* Under voltage threshold (val * 16 * 100uV) */
     ADBMS6948_FILTER_DISABLED,
-    ADBMS6948_CTH_VOLT_22_5mv,
+    SYS_CS_THRESHOLD,
     ADBMS6948_GPIO11_GPIO_MODE, /*GPIO11 mode*/
+    NULL,       /* OC1 configuration */
+    NULL,       /* OC2 configuration */
+    TRUE,       /* Warm init, keeps a configured chain over a reset of the board */
 };
 
 Adbms6948_RunTimeErrorCfgType oRuntimeErrConfig = {
@@ -63,22 +79,82 @@ Adbms6948_CfgType koConfig = {
     &oRuntimeErrConfig
 };
 
-BMS_BUFFER oBmsBuffer[LOOP_MEASUREMENT_COUNT] = {0};
+boolean bSessionActive = FALSE;   /*! Driver initialized and kept open across commands */
+boolean bBinaryTelemetry = FALSE; /*! Stream binary telemetry frames instead of text */
 
+int Adbms6948_open_session(const uint8_t knChainId);
 void Adbms6948_read_config(const uint8_t knChainId, int nRet);
 void Adbms6948_measure_cells(const uint8_t knChainId, int nRet);
 void Adbms6948_measure_current(const uint8_t knChainId, int nRet);
 void Adbms6948_measure_schannel(const uint8_t knChainId, int nRet);
 void Adbms6948_measure_average_cell(const uint8_t knChainId, int nRet);
-void Adbms6948_trig_cont_measurement(const uint8_t knChainId, int nRet);
-void Adbms6948_read_cont_measurement(const uint8_t knChainId, int nRet, uint8_t loop);
+void Adbms6948_stream_cont_measurement(const uint8_t knChainId, int nRet);
+void Adbms6948_send_telemetry_sample(const BMS_BUFFER *poFrame);
+void Adbms6948_send_telemetry_stats(const BMS_ACQ_STATS *poStats);
+uint32_t Adbms6948_acq_protect(uint32_t *pnFlaggedFrames);
 void Adbms6948_measure_aux_voltage(const uint8_t knChainId, int nRet);
 void Adbms6948_measure_status_voltage(const uint8_t knChainId, int nRet);
 void Adbms6948_configure_read_cell_ovuv_flags(const uint8_t knChainId, int nRet);
 void Adbms6948_write_read_always_on_memory(const uint8_t knChainId, int nRet);
+void Adbms6948_run_scan_plan(const uint8_t knChainId, int nRet, const BMS_SCAN_TASK *paoTasks, uint8_t nNoOfTasks);
+void Adbms6948_scan_keep_latest(const BMS_SCAN_RESULT *poResult, void *pArg);
+void Adbms6948_scan_open_wire(const BMS_SCAN_RESULT *poResult, void *pArg);
+void Adbms6948_scan_cs_check(const BMS_SCAN_RESULT *poResult, void *pArg);
+void Adbms6948_run_cell_balancing(const uint8_t knChainId, int nRet);
+void Adbms6948_run_charge_accounting(const uint8_t knChainId, int nRet);
+void Adbms6948_run_soc_estimation(const uint8_t knChainId, int nRet);
 
 void parseCellOVUVStatus(const uint32_t nCellOVUVStatus, uint16_t *const pnCellOVStatus, uint16_t * const pnCellUVStatus);
 
+static int Adbms6948_conv_trig_cadc(void *pArg, const uint8_t knChainId);
+static int Adbms6948_conv_trig_i1adc(void *pArg, const uint8_t knChainId);
+static int Adbms6948_conv_trig_sadc(void *pArg, const uint8_t knChainId);
+static int Adbms6948_conv_trig_aux(void *pArg, const uint8_t knChainId);
+static int Adbms6948_conv_read_cells(void *pArg, const uint8_t knChainId);
+static int Adbms6948_conv_read_avg_cells(void *pArg, const uint8_t knChainId);
+static int Adbms6948_conv_read_spins(void *pArg, const uint8_t knChainId);
+static int Adbms6948_conv_read_current(void *pArg, const uint8_t knChainId);
+static int Adbms6948_conv_read_gpio(void *pArg, const uint8_t knChainId);
+static int Adbms6948_conv_read_status(void *pArg, const uint8_t knChainId);
+
+/*! Production scan rates: cells 10ms, current 1ms, thermistors 100ms, diagnostics 1s, open wire passes 50ms */
+static const BMS_SCAN_TASK koScanTasks[] = {
+    {BMS_SCAN_MEAS_CELLS,     10u,              Adbms6948_scan_keep_latest, NULL},
+    {BMS_SCAN_MEAS_CURRENT,   1u,               Adbms6948_scan_keep_latest, NULL},
+    {BMS_SCAN_MEAS_GPIO,      100u,             Adbms6948_scan_keep_latest, NULL},
+    {BMS_SCAN_MEAS_STATUS,    1000u,            Adbms6948_scan_keep_latest, NULL},
+    {BMS_SCAN_MEAS_OPEN_WIRE, SYS_OW_PERIOD_MS, Adbms6948_scan_open_wire,   NULL},
+};
+/*! Cross check scan rates, the C and S cells replace the cells; the redundant C-ADC holds the S-ADC, so no open wire passes */
+static const BMS_SCAN_TASK koCsScanTasks[] = {
+    {BMS_SCAN_MEAS_CS_CHECK,  SYS_CS_PERIOD_MS, Adbms6948_scan_cs_check,    NULL},
+    {BMS_SCAN_MEAS_CURRENT,   1u,               Adbms6948_scan_keep_latest, NULL},
+    {BMS_SCAN_MEAS_GPIO,      100u,             Adbms6948_scan_keep_latest, NULL},
+    {BMS_SCAN_MEAS_STATUS,    1000u,            Adbms6948_scan_keep_latest, NULL},
+};
+static const BMS_OW_CFG koOwCfg = {SYS_OW_CONFIRM_PASSES};
+static const BMS_PROT_LIMITS koProtLimits = {BMS_UNITS_UV_TO_CODE(SYS_CELL_OV_LIMIT), BMS_UNITS_UV_TO_CODE(SYS_CELL_UV_LIMIT)};
+static const BMS_CS_CFG koCsCfg = {SYS_CS_MAX_DELTA_UV / BMS_UNITS_ADC_LSB_UV, SYS_CS_RAISE_SCANS, SYS_CS_CLEAR_SCANS};
+static const int32_t kanSocOcvUv[] = SYS_SOC_OCV_TABLE_UV;
+static const BMS_SOC_CFG koSocCfg = {
+    &kanSocOcvUv[0],
+    (uint8_t)(sizeof(kanSocOcvUv) / sizeof(kanSocOcvUv[0])),
+    (float)SYS_SOC_R0_MICRO_OHM * 1e-6f,
+    (float)SYS_SOC_R1_MICRO_OHM * 1e-6f,
+    (float)SYS_SOC_TAU1_MS * 1e-3f,
+    (float)SYS_SOC_CAPACITY_MAH * 1e-3f,
+    0.99f,      /*fChargeEfficiency*/
+    1e-7f,      /*fProcNoiseSoc*/
+    1e-6f,      /*fProcNoiseVrc*/
+    1e-6f,      /*fMeasNoise, 1 mV standard deviation*/
+    0.01f       /*fInitVarSoc, 10 % standard deviation*/
+};
+static BMS_SCAN_PLAN oScanPlan;
+static BMS_SCAN_RESULT aoScanLatest[BMS_SCAN_NO_OF_MEAS];   /*! Written on the scan thread in a critical section */
+static BMS_OW_STATE oOwState;                               /*! Written on the scan thread in a critical section */
+static BMS_CS_STATE oCsState;                               /*! Written on the scan thread in a critical section */
+static BMS_SOC_STATE oSocState;                             /*! Kept between sessions, balancing continues the estimate */
+
 /*!
     @brief  Execute command
 
@@ -89,8 +165,7 @@ void parseCellOVUVStatus(const uint32_t nCellOVUVStatus, uint16_t *const pnCellO
 void ExecuteCommand(int cmd)
 {
     int nRet = 0;
-    uint8_t loop_count = 0;
-    nRet = Adbms6948_Init(&koConfig);
+    nRet = Adbms6948_open_session(knChainId);
 
     switch(cmd) {
         case 0:
@@ -126,18 +201,7 @@ void ExecuteCommand(int cmd)
             break;
 
         case 8:
-            Adbms6948_trig_cont_measurement(knChainId, nRet);
-            while(loop_count < LOOP_MEASUREMENT_COUNT) {
-                Adbms6948_read_cont_measurement(knChainId, nRet, loop_count);
-                loop_count++;
-            }
-            loop_count = 0;
-            while(loop_count < LOOP_MEASUREMENT_COUNT) {
-                PrintCellVoltages(&oBmsBuffer[loop_count].anCellVoltage[0]);
-                PrintAverageCurrent(&oBmsBuffer[loop_count].nCurrent);
-                printf("Voltage CT: %d, Current CT: %d\n", oBmsBuffer[loop_count].nVoltageCT, oBmsBuffer[loop_count].nCurrentCT);
-                loop_count++;
-            }
+            Adbms6948_stream_cont_measurement(knChainId, nRet);
             break;
         case 9:
             Adbms6948_configure_read_cell_ovuv_flags(knChainId, nRet);
@@ -147,12 +211,77 @@ void ExecuteCommand(int cmd)
             Adbms6948_write_read_always_on_memory(knChainId, nRet);
             break;
 
+        case 11:
+            bBinaryTelemetry = (bBinaryTelemetry == TRUE) ? FALSE : TRUE;
+            printf("Binary telemetry: %s\n", (bBinaryTelemetry == TRUE) ? "ON" : "OFF");
+            break;
+
+        case 12:
+            Adbms6948_run_scan_plan(knChainId, nRet, &koScanTasks[0], (uint8_t)(sizeof(koScanTasks) / sizeof(koScanTasks[0])));
+            break;
+
+        case 13:
+            Adbms6948_run_cell_balancing(knChainId, nRet);
+            break;
+
+        case 14:
+            Adbms6948_run_charge_accounting(knChainId, nRet);
+            break;
+
+        case 15:
+            Adbms6948_run_soc_estimation(knChainId, nRet);
+            break;
+
+        case 16:
+            Adbms6948_run_scan_plan(knChainId, nRet, &koCsScanTasks[0], (uint8_t)(sizeof(koCsScanTasks) / sizeof(koCsScanTasks[0])));
+            break;
+
         default:
             printf("Invalid Command Entered \n");
             break;
 
     }
-    Adbms6948_DeInit();
+}
+
+/*!
+    @brief  Open the driver session for a command
+
+    The chain is initialized on the first command only. Later commands verify
+    the chain with a single CFGA read (PEC, command counter and REFON). When
+    that check fails, e.g. after a soft reset or when the device went to sleep
+    between commands, only this chain is re-initialized, without a soft reset.
+    The driver is restarted when that fails too.
+
+    @param[in]  knChainId Daisy chain ID
+
+    @return 0 on success, non-zero otherwise
+*/
+int Adbms6948_open_session(const uint8_t knChainId)
+{
+    int nRet = 0;
+
+    if(bSessionActive == TRUE) {
+        nRet = Adbms6948_CheckChainCfg(knChainId);
+        if(nRet != 0) {
+            /* Chain lost its configuration, take it over or configure it again */
+            nRet = Adbms6948_ReInitChain(knChainId);
+        }
+        if(nRet != 0) {
+            if(Adbms6948_DeInit() == E_OK) {
+                bSessionActive = FALSE;
+            } else {
+                printf("Driver de-initialization failed\n");
+            }
+        }
+    }
+
+    if(bSessionActive == FALSE) {
+        nRet = Adbms6948_Init(&koConfig);
+        if(nRet == 0) {
+            bSessionActive = TRUE;
+        }
+    }
+    return nRet;
 }
 
 void Adbms6948_read_config(const uint8_t knChainId, int nRet)
@@ -176,14 +305,12 @@ void Adbms6948_measure_cells(const uint8_t knChainId, int nRet)
         ADBMS6948_CELL_OW_NONE};
     if(nRet == 0) {
 
-        nRet = Adbms6948_TrigCADC(&oCADCInputs, knChainId);
-        wait_us(1100); //1.1ms
+        BMS_CONVERSION oConv = {
+            ADBMS6948_ADC_CADC, 0u,
+            Adbms6948_conv_trig_cadc, &oCADCInputs,
+            Adbms6948_conv_read_cells, &anCellVolt[0]};
 
-        nRet = Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA,
-                                      ADBMS6948_CELL_GRP_SEL_ALL,
-                                      &anCellVolt[0],
-                                      ADBMS6948_SEND_NONE,
-                                      knChainId);
+        nRet = Adbms6948_Conv_Run(&oConv, BMS_CONV_WAIT_POLL, NULL, knChainId);
         printf("%d\n", nRet);
         printf("Printing Cell Voltages\n");
         PrintCellVoltages(&anCellVolt[0]);
@@ -205,13 +332,12 @@ void Adbms6948_measure_current(const uint8_t knChainId, int nRet)
         ADBMS6948_CURRENT_OW_NONE};
     if(nRet == 0) {
 
-        Adbms6948_TrigI1ADC(&oI1ADCInputs, knChainId);
-        wait_us(1100); //1.1ms
-        Adbms6948_ReadCurrent(ADBMS6948_CURRENT_MEAS_DATA,
-                              ADBMS6948_CURRENT_I1,
-                              &nCurrent,
-                              ADBMS6948_SEND_NONE,
-                              knChainId);
+        BMS_CONVERSION oConv = {
+            ADBMS6948_ADC_I1ADC, 0u,
+            Adbms6948_conv_trig_i1adc, &oI1ADCInputs,
+            Adbms6948_conv_read_current, &nCurrent};
+
+        (void)Adbms6948_Conv_Run(&oConv, BMS_CONV_WAIT_POLL, NULL, knChainId);
         PrintCurrent(&nCurrent);
     }
 
@@ -224,24 +350,13 @@ void Adbms6948_measure_schannel(const uint8_t knChainId, int nRet)
 {
     int16_t anSPinVolt[16];
 
-    Adbms6948_TrigCADCInputs oCADCInputs{
-        0,
-        0,
-        0,
-        ADBMS6948_CELL_OW_NONE};
     if(nRet == 0) {
+        BMS_CONVERSION oConv = {
+            ADBMS6948_ADC_SADC, 0u,
+            Adbms6948_conv_trig_sadc, NULL,
+            Adbms6948_conv_read_spins, &anSPinVolt[0]};
 
-        Adbms6948_TrigSADC(
-            0,
-            0,
-            ADBMS6948_CELL_OW_NONE,
-            knChainId);
-        wait_us(8800); //8.8ms
-        Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA_REDUNDANT,
-                               ADBMS6948_CELL_GRP_SEL_ALL,
-                               &anSPinVolt[0],
-                               ADBMS6948_SEND_NONE,
-                               knChainId);
+        (void)Adbms6948_Conv_Run(&oConv, BMS_CONV_WAIT_POLL, NULL, knChainId);
         printf("Printing Spin Voltages\n");
         PrintCellVoltages(&anSPinVolt[0]);
     }
@@ -262,13 +377,13 @@ void Adbms6948_measure_average_cell(const uint8_t knChainId, int nRet)
         ADBMS6948_CELL_OW_NONE};
     if(nRet == 0) {
 
-        Adbms6948_TrigCADC(&oCADCInputs, knChainId);
-        wait_us(8800); //8.8ms
-        Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA_AVERAGED,
-                               ADBMS6948_CELL_GRP_SEL_ALL,
-                               &anAvgCellVolt[0],
-                               ADBMS6948_SEND_NONE,
-                               knChainId);
+        /* Continuous mode never reports done, read after 8 conversions */
+        BMS_CONVERSION oConv = {
+            ADBMS6948_ADC_CADC, 8u * BMS_CONV_T_CADC_US,
+            Adbms6948_conv_trig_cadc, &oCADCInputs,
+            Adbms6948_conv_read_avg_cells, &anAvgCellVolt[0]};
+
+        (void)Adbms6948_Conv_Run(&oConv, BMS_CONV_WAIT_DEADLINE, NULL, knChainId);
         printf("Printing Average Cell Voltages\n");
         PrintCellVoltages(&anAvgCellVolt[0]);
         Adbms6948_SendSoftReset(knChainId);
@@ -279,36 +394,528 @@ void Adbms6948_measure_average_cell(const uint8_t knChainId, int nRet)
     }
 }
 
-void Adbms6948_trig_cont_measurement(const uint8_t knChainId, int nRet)
+/*!
+    @brief  Stream continuous synchronized voltage and current
+
+    Starts the acquisition engine and prints the frames of the logging
+    consumer until a key is pressed, while the protection consumer checks
+    every frame. With binary telemetry selected the frames and the final
+    statistics are sent as telemetry frames instead, see bms_telemetry.h.
+
+    @param[in]  knChainId Daisy chain ID
+    @param[in]  nRet      Status of the session
+*/
+void Adbms6948_stream_cont_measurement(const uint8_t knChainId, int nRet)
 {
-    /*Trigger C-ADC and I1-ADC simultaneously in Continuous mode*/
-    Adbms6948_TrigIVADCInputs oTrigIVADCInputs = {
-        TRUE,                   /*Adbms6948_bContMode*/
-        TRUE,                   /*Adbms6948_bEnRedun*/
+    BMS_BUFFER oFrame;
+    BMS_ACQ_STATS oStats;
+    FileHandle *pConsole = mbed_file_handle(STDIN_FILENO);
+    char cKey;
+    uint32_t nProtFrames = 0u, nProtFlagged = 0u;
+
+    if(nRet==0) {
+        Adbms6948_Acq_Attach(BMS_ACQ_CONSUMER_LOG);
+        Adbms6948_Acq_Attach(BMS_ACQ_CONSUMER_PROTECTION);
+        nRet = Adbms6948_Acq_Start(BMS_ACQ_DEFAULT_PERIOD_MS, knChainId);
+        if(nRet == 0) {
+            printf("Streaming, press any key to stop\n");
+            if(bBinaryTelemetry == TRUE) {
+                /* Delimit the text above from the first frame */
+                fflush(stdout);
+                (void)serial_port.write("", 1);
+            }
+            while(pConsole->readable() == false) {
+                while(Adbms6948_Acq_Pop(BMS_ACQ_CONSUMER_LOG, &oFrame) == true) {
+                    if(bBinaryTelemetry == TRUE) {
+                        Adbms6948_send_telemetry_sample(&oFrame);
+                    } else {
+                        printf("#%lu t=%llu us\n", (unsigned long)oFrame.nSeqNum, (unsigned long long)oFrame.nTimestampUs);
+                        PrintCellVoltages(&oFrame.anCellVoltage[0]);
+                        PrintAverageCurrent(&oFrame.anCurrent[0]);
+                        printf("Voltage CT: %d, Current CT: %d\n", oFrame.nVoltageCT, oFrame.nCurrentCT);
+                    }
+                }
+                nProtFrames += Adbms6948_acq_protect(&nProtFlagged);
+                ThisThread::sleep_for(std::chrono::milliseconds(BMS_ACQ_DEFAULT_PERIOD_MS));
+            }
+            (void)pConsole->read(&cKey, 1);
+            Adbms6948_Acq_Stop();
+        } else {
+            printf("Acquisition start failed\n");
+        }
+        Adbms6948_Acq_Detach(BMS_ACQ_CONSUMER_LOG);
+        Adbms6948_Acq_Detach(BMS_ACQ_CONSUMER_PROTECTION);
+        Adbms6948_Acq_GetStats(&oStats);
+        if(bBinaryTelemetry == TRUE) {
+            Adbms6948_send_telemetry_stats(&oStats);
+        }
+        printf("Samples: %lu, Overruns: %lu, Read errors: %lu, Max lateness: %lu us\n",
+               (unsigned long)oStats.nSamples, (unsigned long)oStats.nOverruns,
+               (unsigned long)oStats.nReadErrors, (unsigned long)oStats.nMaxLatenessUs);
+        printf("Protection: %lu frames checked, %lu with OV or UV cells\n",
+               (unsigned long)nProtFrames, (unsigned long)nProtFlagged);
+    } else {
+        printf("Init Failed\n");
+    }
+}
+
+/*!
+    @brief  Check the frames of the protection consumer
+
+    Drains BMS_ACQ_CONSUMER_PROTECTION and evaluates the cells of every frame
+    against SYS_CELL_OV_LIMIT and SYS_CELL_UV_LIMIT with BmsProt_EvalCells.
+    Frames with flagged cells are reported unless binary telemetry is
+    streaming.
+
+    @param[in,out] pnFlaggedFrames Counter of the frames with OV or UV cells
+
+    @return Number of frames checked
+*/
+uint32_t Adbms6948_acq_protect(uint32_t *pnFlaggedFrames)
+{
+    BMS_BUFFER oFrame;
+    BMS_PROT_SUMMARY oSummary;
+    uint16_t anOvMask[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN], anUvMask[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+    uint32_t nFrames = 0u;
+
+    while(Adbms6948_Acq_Pop(BMS_ACQ_CONSUMER_PROTECTION, &oFrame) == true) {
+        BmsProt_EvalCells(&oFrame.anCellVoltage[0], oDaisyChainConfig.Adbms6948_nNoOfDevices, (uint8_t)BMS_APP_CELLS_PER_DEVICE,
+                          &koProtLimits, &anOvMask[0], &anUvMask[0], NULL, &oSummary);
+        if((oSummary.nOvCells != 0u) || (oSummary.nUvCells != 0u)) {
+            (*pnFlaggedFrames)++;
+            if(bBinaryTelemetry == FALSE) {
+                printf("#%lu protection: OV 0x%04X, UV 0x%04X, min C%u max C%u\n", (unsigned long)oFrame.nSeqNum,
+                       anOvMask[0], anUvMask[0], (unsigned)(oSummary.nMinCell + 1u), (unsigned)(oSummary.nMaxCell + 1u));
+            }
+        }
+        nFrames++;
+    }
+    return nFrames;
+}
+
+/*!
+    @brief  Send a sample as a binary telemetry frame
+
+    @param[in]  poFrame Sample to send
+*/
+void Adbms6948_send_telemetry_sample(const BMS_BUFFER *poFrame)
+{
+    BMS_TLM_SAMPLE oSample;
+    uint8_t anTlmFrame[BMS_TLM_MAX_FRAME_LEN];
+    uint16_t nTlmFrameLen;
+
+    oSample.nSeqNum = poFrame->nSeqNum;
+    oSample.nTimestampUs = poFrame->nTimestampUs;
+    oSample.nVoltageCT = poFrame->nVoltageCT;
+    oSample.nCurrentCT = poFrame->nCurrentCT;
+    oSample.nCurrent = poFrame->anCurrent[0];
+    oSample.nNoOfCells = nNumCells;
+    memcpy(&oSample.anCellVoltage[0], &poFrame->anCellVoltage[0], sizeof(oSample.anCellVoltage));
+    nTlmFrameLen = BmsTlm_EncodeSample(&oSample, &anTlmFrame[0]);
+    (void)serial_port.write(&anTlmFrame[0], nTlmFrameLen);
+}
+
+/*!
+    @brief  Send the acquisition statistics as a binary telemetry frame
+
+    @param[in]  poStats Statistics to send
+*/
+void Adbms6948_send_telemetry_stats(const BMS_ACQ_STATS *poStats)
+{
+    BMS_TLM_STATS oTlmStats;
+    uint8_t anTlmFrame[BMS_TLM_MAX_FRAME_LEN];
+    uint16_t nTlmFrameLen;
+
+    oTlmStats.nSamples = poStats->nSamples;
+    oTlmStats.nOverruns = poStats->nOverruns;
+    oTlmStats.nReadErrors = poStats->nReadErrors;
+    oTlmStats.nMaxLatenessUs = poStats->nMaxLatenessUs;
+    nTlmFrameLen = BmsTlm_EncodeStats(&oTlmStats, &anTlmFrame[0]);
+    (void)serial_port.write(&anTlmFrame[0], nTlmFrameLen);
+}
+
+/*!
+    @brief  Run a scan plan
+
+    Compiles the tasks, executes them and prints the latest result of every
+    measurement and the open wire verdicts, or the cross check of a plan with
+    a redundant C-ADC, once a second until a key is pressed, then the slot
+    statistics including the overruns.
+
+    @param[in]  knChainId  Daisy chain ID
+    @param[in]  nRet       Status of the session
+    @param[in]  paoTasks   Tasks of the plan, koScanTasks or koCsScanTasks
+    @param[in]  nNoOfTasks Number of tasks
+*/
+void Adbms6948_run_scan_plan(const uint8_t knChainId, int nRet, const BMS_SCAN_TASK *paoTasks, uint8_t nNoOfTasks)
+{
+    BMS_SCAN_RESULT aoLatest[BMS_SCAN_NO_OF_MEAS];
+    BMS_OW_STATE oOw;
+    BMS_CS_STATE oCs;
+    uint8_t anOwVerdict[BMS_APP_MAX_CELLS], anOwConfidence[BMS_APP_MAX_CELLS];
+    uint16_t nOwOpen, nOwDecided;
+    BMS_SCAN_STATS oStats;
+    BMS_SCAN_ERR eErr;
+    FileHandle *pConsole = mbed_file_handle(STDIN_FILENO);
+    char cKey;
+
+    if(nRet == 0) {
+        eErr = Adbms6948_Scan_Compile(paoTasks, nNoOfTasks, oDaisyChainConfig.Adbms6948_nNoOfDevices, &oScanPlan);
+        if(eErr != BMS_SCAN_OK) {
+            printf("Scan plan rejected: %d\n", (int)eErr);
+        } else {
+            memset(&aoScanLatest[0], 0, sizeof(aoScanLatest));
+            BmsOw_Init(&oOwState, (uint16_t)(oDaisyChainConfig.Adbms6948_nNoOfDevices * BMS_APP_CELLS_PER_DEVICE));
+            BmsCs_Init(&oCsState, (uint16_t)(oDaisyChainConfig.Adbms6948_nNoOfDevices * BMS_APP_CELLS_PER_DEVICE));
+            printf("Scan plan: %u slots of %lu us, busiest slot %u us\n", (unsigned)oScanPlan.nNoOfSlots,
+                   (unsigned long)oScanPlan.nSlotUs, (unsigned)oScanPlan.nMaxLoadUs);
+            nRet = Adbms6948_Scan_Start(&oScanPlan, knChainId);
+            if(nRet == 0) {
+                printf("Scanning, press any key to stop\n");
+                while(pConsole->readable() == false) {
+                    ThisThread::sleep_for(std::chrono::milliseconds(1000));
+                    core_util_critical_section_enter();
+                    memcpy(&aoLatest[0], &aoScanLatest[0], sizeof(aoLatest));
+                    oOw = oOwState;
+                    oCs = oCsState;
+                    core_util_critical_section_exit();
+                    printf("t=%llu us\n", (unsigned long long)aoLatest[BMS_SCAN_MEAS_CURRENT].nTimestampUs);
+                    PrintCellVoltages(&aoLatest[BMS_SCAN_MEAS_CELLS].u.anCellVoltage[0]);
+                    PrintCurrent(&aoLatest[BMS_SCAN_MEAS_CURRENT].u.nCurrent);
+                    PrintGpioVoltage(&aoLatest[BMS_SCAN_MEAS_GPIO].u.anGpioVoltage[0]);
+                    PrintStatusVoltage(&aoLatest[BMS_SCAN_MEAS_STATUS].u.anStatVoltage[0]);
+                    if(oScanPlan.bRedundant == true) {
+                        printf("C vs S: %u of %u cells raised, %u C only, %u device only, %u both, %lu scans\n",
+                               (unsigned)oCs.nRaised, (unsigned)oCs.nNoOfCells, (unsigned)oCs.anClassCells[BMS_CS_SW_ONLY],
+                               (unsigned)oCs.anClassCells[BMS_CS_CHIP_ONLY], (unsigned)oCs.anClassCells[BMS_CS_BOTH],
+                               (unsigned long)oCs.nScans);
+                        PrintCrossCheck(&oCs.anClass[0], &oCs.abRaised[0]);
+                    } else {
+                        nOwOpen = BmsOw_GetVerdicts(&koOwCfg, &oOw, &anOwVerdict[0], &anOwConfidence[0], &nOwDecided);
+                        printf("Open wire: %u of %u wires decided, %u open, %lu odd and %lu even passes\n",
+                               (unsigned)nOwDecided, (unsigned)oOw.nNoOfCells, (unsigned)nOwOpen,
+                               (unsigned long)oOw.anPasses[BMS_OW_PASS_ODD], (unsigned long)oOw.anPasses[BMS_OW_PASS_EVEN]);
+                        PrintOpenWire(&anOwVerdict[0], &anOwConfidence[0]);
+                    }
+                }
+                (void)pConsole->read(&cKey, 1);
+                Adbms6948_Scan_Stop();
+            } else {
+                printf("Scan start failed\n");
+            }
+            Adbms6948_Scan_GetStats(&oStats);
+            printf("Slots: %lu, Overruns: %lu (last in slot %lu), Read errors: %lu, Max slot: %lu us, Max lateness: %lu us\n",
+                   (unsigned long)oStats.nSlots, (unsigned long)oStats.nOverruns, (unsigned long)oStats.nLastOverrunSlot,
+                   (unsigned long)oStats.nReadErrors, (unsigned long)oStats.nMaxSlotUs, (unsigned long)oStats.nMaxLatenessUs);
+        }
+    } else {
+        printf("Init Failed\n");
+    }
+}
+
+/*!
+    @brief  Keep the latest valid result of every measurement
+
+    Runs on the scan thread.
+
+    @param[in]  poResult Result of a task
+    @param[in]  pArg     Unused
+*/
+void Adbms6948_scan_keep_latest(const BMS_SCAN_RESULT *poResult, void *pArg)
+{
+    if(poResult->nStatus == 0) {
+        core_util_critical_section_enter();
+        aoScanLatest[poResult->eMeas] = *poResult;
+        core_util_critical_section_exit();
+    }
+}
+
+/*!
+    @brief  Evaluate an open wire pass of the scan plan
+
+    Runs on the scan thread, which also writes the latest cells, so they are
+    read without a lock. The S-ADC measurement with the switches on is
+    compared with the latest C-ADC measurement, at most a cell period old,
+    and only the wires switched by the pass are accumulated.
+
+    @param[in]  poResult Result of the open wire task
+    @param[in]  pArg     Unused
+*/
+void Adbms6948_scan_open_wire(const BMS_SCAN_RESULT *poResult, void *pArg)
+{
+    const BMS_SCAN_RESULT *poCells = &aoScanLatest[BMS_SCAN_MEAS_CELLS];
+    uint8_t anStatus[BMS_APP_MAX_CELLS];
+
+    Adbms6948_scan_keep_latest(poResult, pArg);
+    if((poResult->nStatus == 0) && (poCells->nTimestampUs != 0u) &&
+       (Adbms6948_CellOWDiag(&poCells->u.anCellVoltage[0], &poResult->u.oOpenWire.anCellVoltage[0],
+                             FALSE, &anStatus[0], knChainId) == 0)) {
+        core_util_critical_section_enter();
+        BmsOw_Update(&koOwCfg, &oOwState, &anStatus[0],
+                     (poResult->u.oOpenWire.eOWSel == ADBMS6948_CELL_OW_ODD) ? BMS_OW_PASS_ODD : BMS_OW_PASS_EVEN);
+        core_util_critical_section_exit();
+    }
+}
+
+/*!
+    @brief  Cross check the C-ADC and S-ADC cells of the scan plan
+
+    Runs on the scan thread. The C-ADC cells of the read stand in for the
+    cells of the plan; the C and S cells and the C vs S faults of the same
+    read are added to the cross check.
+
+    @param[in]  poResult Result of the cross check task
+    @param[in]  pArg     Unused
+*/
+void Adbms6948_scan_cs_check(const BMS_SCAN_RESULT *poResult, void *pArg)
+{
+    Adbms6948_scan_keep_latest(poResult, pArg);
+    if(poResult->nStatus == 0) {
+        core_util_critical_section_enter();
+        aoScanLatest[BMS_SCAN_MEAS_CELLS].nTimestampUs = poResult->nTimestampUs;
+        memcpy(&aoScanLatest[BMS_SCAN_MEAS_CELLS].u.anCellVoltage[0], &poResult->u.oCrossCheck.anCellVoltage[0],
+               sizeof(poResult->u.oCrossCheck.anCellVoltage));
+        (void)BmsCs_Update(&koCsCfg, &oCsState, &poResult->u.oCrossCheck.anCellVoltage[0],
+                           &poResult->u.oCrossCheck.anSCellVoltage[0], &poResult->u.oCrossCheck.anCSFlt[0]);
+        core_util_critical_section_exit();
+    }
+}
+
+/*!
+    @brief  Balance the cells until a key is pressed
+
+    Every SYS_BAL_PERIOD_MS the cells are measured by a single shot C-ADC
+    conversion with Adbms6948_bEnSSDP cleared, which pauses the discharge
+    while converting. BmsBal_Update derives the duty cycles and only a change
+    is passed to Adbms6948_CfgPwmDischarge, which in turn writes only the PWM
+    register groups that changed. The discharge is switched off on exit.
+    With ENABLE_SOC_CELL_BALANCING the policy targets the lowest state of
+    charge once the estimation (command 15) has run: the estimate of every
+    cell continues on the balancing measurements, taken at rest as the
+    discharge is paused, and the SOC thresholds apply. Without an estimate
+    the voltage thresholds and the lowest cell are used.
+
+    @param[in]  knChainId Daisy chain ID
+    @param[in]  nRet      Status of the session
+*/
+void Adbms6948_run_cell_balancing(const uint8_t knChainId, int nRet)
+{
+    static const BMS_BAL_CFG koBalVoltCfg = {
+        BMS_BAL_TARGET_TOP,
+        BMS_UNITS_UV_TO_CODE(SYS_BAL_MIN_CELL_VOLT),
+        SYS_BAL_START_VOLT / BMS_UNITS_ADC_LSB_UV,
+        SYS_BAL_STOP_VOLT / BMS_UNITS_ADC_LSB_UV,
+        SYS_BAL_FULL_DUTY_VOLT / BMS_UNITS_ADC_LSB_UV
+    };
+    static const BMS_BAL_CFG koBalSocCfg = {
+        BMS_BAL_TARGET_SOC,
+        BMS_UNITS_UV_TO_CODE(SYS_BAL_MIN_CELL_VOLT),
+        SYS_BAL_START_SOC,
+        SYS_BAL_STOP_SOC,
+        SYS_BAL_FULL_DUTY_SOC
+    };
+    const BMS_BAL_CFG *poBalCfg = &koBalVoltCfg;
+    int16_t anCellVolt[SYS_CM_DEVICES_PRESENT * BMS_BAL_CELLS_PER_DEVICE];
+    int16_t anSoc[SYS_CM_DEVICES_PRESENT * BMS_BAL_CELLS_PER_DEVICE];
+    const int16_t *panSoc = NULL;
+    Adbms6948_PwmDutyCfgType anDuty[SYS_CM_DEVICES_PRESENT * BMS_BAL_CELLS_PER_DEVICE] = {0};
+    Adbms6948_TrigCADCInputs oCADCInputs = {
+        FALSE,                  /*Adbms6948_bContMode*/
+        FALSE,                  /*Adbms6948_bEnRedun*/
         FALSE,                  /*Adbms6948_bEnSSDP*/
         FALSE,                  /*Adbms6948_bRstIIRFltr*/
         ADBMS6948_CELL_OW_NONE  /*Adbms6948_eOWSel*/
     };
+    BMS_CONVERSION oConv = {
+        ADBMS6948_ADC_CADC, 0u,
+        Adbms6948_conv_trig_cadc, &oCADCInputs,
+        Adbms6948_conv_read_cells, &anCellVolt[0]};
+    FileHandle *pConsole = mbed_file_handle(STDIN_FILENO);
+    uint32_t nUpdates = 0u;
+    char cKey;
+
+    if(nRet != 0) {
+        printf("Init Failed\n");
+    } else if((SYS_SYSTEM_CONFIG_WORD & ENABLE_CELL_BALANCING) == 0) {
+        printf("Cell balancing is disabled in SYS_SYSTEM_CONFIG_WORD\n");
+    } else {
+        if(((SYS_SYSTEM_CONFIG_WORD & ENABLE_SOC_CELL_BALANCING) != 0) &&
+           (oSocState.nNoOfCells == (SYS_CM_DEVICES_PRESENT * BMS_BAL_CELLS_PER_DEVICE))) {
+            poBalCfg = &koBalSocCfg;
+            panSoc = &anSoc[0];
+            printf("Balancing to the lowest state of charge, press any key to stop\n");
+        } else {
+            if((SYS_SYSTEM_CONFIG_WORD & ENABLE_SOC_CELL_BALANCING) != 0) {
+                printf("No state of charge estimate, run command 15 first\n");
+            }
+            printf("Balancing to the lowest cell, press any key to stop\n");
+        }
+        while((pConsole->readable() == false) && (nRet == 0)) {
+            nRet = Adbms6948_Conv_Run(&oConv, BMS_CONV_WAIT_POLL, NULL, knChainId);
+            if((nRet == 0) && (panSoc != NULL)) {
+                /* No pack current while balancing, the discharge is paused during the conversion */
+                BmsSoc_Update(&koSocCfg, &oSocState, &anCellVolt[0], 0.0f, (float)SYS_BAL_PERIOD_MS * 1e-3f);
+                BmsSoc_GetSocCentiPct(&oSocState, &anSoc[0]);
+            }
+            /* Adbms6948_bEnSSDP is cleared, the discharge is paused during every conversion */
+            if((nRet == 0) &&
+               (BmsBal_Update(poBalCfg, &anCellVolt[0], panSoc, SYS_CM_DEVICES_PRESENT, 1u, &anDuty[0]) != 0u)) {
+                nRet = Adbms6948_CfgPwmDischarge(&anDuty[0], knChainId);
+                nUpdates++;
+                printf("Duty:");
+                for(uint8_t nCell = 0u; nCell < (SYS_CM_DEVICES_PRESENT * BMS_BAL_CELLS_PER_DEVICE); nCell++) {
+                    printf(" %u", (unsigned)anDuty[nCell]);
+                }
+                printf("\n");
+            }
+            ThisThread::sleep_for(std::chrono::milliseconds(SYS_BAL_PERIOD_MS));
+        }
+        if(pConsole->readable() == true) {
+            (void)pConsole->read(&cKey, 1);
+        }
+        memset(&anDuty[0], 0, sizeof(anDuty));
+        nRet |= Adbms6948_CfgPwmDischarge(&anDuty[0], knChainId);
+        printf("Balancing stopped: %d, duty cycle updates: %lu\n", nRet, (unsigned long)nUpdates);
+    }
+}
 
-    if(nRet==0) {
-        nRet |= Adbms6948_TrigIVADC(&oTrigIVADCInputs,  knChainId);
+/*!
+    @brief  Run the charge accounting on the coulomb counter
 
-    } else {
+    The I1-ADC converts continuously and the coulomb counter sums its results
+    on the device, so the current is integrated without reading every
+    conversion: every SYS_CC_POLL_MS the coulomb count and time base are read
+    together under SNAP with the status registers of the coulomb counter
+    faults. After a fault the flags and the counter are cleared and the next
+    sample restarts the accounting. The I1-ADC keeps converting on exit.
+
+    @param[in]  knChainId Daisy chain ID
+    @param[in]  nRet      Status of the session
+*/
+void Adbms6948_run_charge_accounting(const uint8_t knChainId, int nRet)
+{
+    static const BMS_CHG_CFG koChgCfg = {
+        SYS_CC_SHUNT_MICRO_OHM,
+        SYS_CC_CONV_PERIOD_NS,
+        SYS_CC_CAPACITY_MAH
+    };
+    Adbms6948_TrigI1ADCInputs oI1ADCInputs = {
+        TRUE,                   /*Adbms6948_bContMode*/
+        FALSE,                  /*Adbms6948_bEnRedun*/
+        ADBMS6948_CURRENT_OW_NONE /*Adbms6948_eOWSel*/
+    };
+    int16_t anGpio[SYS_CM_DEVICES_PRESENT * 11];
+    int16_t anRedGpio[SYS_CM_DEVICES_PRESENT * 11];
+    Adbms6948_StatusRegValsType aoStatus[SYS_CM_DEVICES_PRESENT];
+    uint16_t nTimeBaseConv = SYS_CC_TIME_BASE_CONV;
+    BMS_CHG_STATE oChg;
+    FileHandle *pConsole = mbed_file_handle(STDIN_FILENO);
+    uint32_t nCount;
+    uint16_t nTimeBase;
+    uint8_t nFaults;
+    int64_t nMicroAh;
+    int16_t nSoc;
+    char cKey;
+
+    if(nRet != 0) {
         printf("Init Failed\n");
+    } else {
+        BmsChg_Init(&oChg, SYS_CC_INITIAL_SOC);
+        nRet = Adbms6948_TrigI1ADC(&oI1ADCInputs, knChainId);
+        nRet |= Adbms6948_CfgCoulombCounter(&nTimeBaseConv, knChainId);
+        nRet |= Adbms6948_ClearCoulombCountAndTimeBase(knChainId);
+        nRet |= Adbms6948_EnableCoulombCounter(TRUE, knChainId);
+        printf("Charge accounting, press any key to stop\n");
+        while((pConsole->readable() == false) && (nRet == 0)) {
+            ThisThread::sleep_for(std::chrono::milliseconds(SYS_CC_POLL_MS));
+            nRet = Adbms6948_ReadCoulombCountAndTimeBase(&nCount, &nTimeBase, ADBMS6948_SEND_BOTH, knChainId);
+            nRet |= Adbms6948_ReadAllAuxStatusRegisters(&anGpio[0], &anRedGpio[0], &aoStatus[0], knChainId);
+            if(nRet == 0) {
+                nFaults = (uint8_t)((aoStatus[0].nCoulCntFlt != 0u) ? BMS_CHG_FLT_COUNT : 0u);
+                nFaults |= (uint8_t)((aoStatus[0].nTimeBaseFlt != 0u) ? BMS_CHG_FLT_TIMEBASE : 0u);
+                nFaults |= (uint8_t)((aoStatus[0].nCoulCntSeqErr != 0u) ? BMS_CHG_FLT_SEQUENCE : 0u);
+                (void)BmsChg_Update(&oChg, nCount, nTimeBase, nFaults);
+                if((nFaults & (BMS_CHG_FLT_COUNT | BMS_CHG_FLT_SEQUENCE)) != 0u) {
+                    nRet = Adbms6948_ClearCoulombCountAndTimeBase(knChainId);
+                }
+                if(nFaults != 0u) {
+                    nRet |= Adbms6948_ClearAllFlags(knChainId);
+                }
+                nMicroAh = BmsChg_GetMicroAh(&koChgCfg, &oChg);
+                nSoc = BmsChg_GetSocCentiPct(&koChgCfg, &oChg);
+                printf("Charge: %lld uAh, SOC: %d.%02d %%, faults: %u, wraps: %u\n",
+                       (long long)nMicroAh, nSoc / 100, nSoc % 100,
+                       (unsigned)oChg.nFaults, (unsigned)oChg.nRollovers);
+            }
+        }
+        if(pConsole->readable() == true) {
+            (void)pConsole->read(&cKey, 1);
+        }
+        printf("Charge accounting stopped: %d\n", nRet);
     }
 }
 
-void Adbms6948_read_cont_measurement(const uint8_t knChainId, int nRet, uint8_t loop)
+/*!
+    @brief  Run the state of charge estimation on the acquisition stream
+
+    The state of charge consumer of the acquisition engine receives the
+    averaged cell voltages together with the averaged current of the same
+    period. The first sample starts the estimation from the open circuit
+    voltage, every later one updates the filter of every cell with the
+    time step between the samples. The state of charge of every cell is
+    printed every SYS_SOC_PRINT_MS until a key is pressed.
+
+    @param[in]  knChainId Daisy chain ID
+    @param[in]  nRet      Status of the session
+*/
+void Adbms6948_run_soc_estimation(const uint8_t knChainId, int nRet)
 {
-    if(nRet==0) {
-        wait_us(1100); //1.1ms
-        nRet = Adbms6948_ReadCellVoltCurrentAverage(
-                   &oBmsBuffer[loop].anCellVoltage[0],
-                   &oBmsBuffer[loop].nCurrent,
-                   TRUE,
-                   &oBmsBuffer[loop].nVoltageCT,
-                   &oBmsBuffer[loop].nCurrentCT,
-                   knChainId);
+    BMS_BUFFER oFrame;
+    int16_t anSoc[SYS_CM_DEVICES_PRESENT * 16];
+    FileHandle *pConsole = mbed_file_handle(STDIN_FILENO);
+    uint64_t nLastUs = 0u, nPrintUs = 0u;
+    bool bStarted = false;
+    float fCurrentA;
+    char cKey;
+
+    if(nRet == 0) {
+        Adbms6948_Acq_Attach(BMS_ACQ_CONSUMER_SOC);
+        nRet = Adbms6948_Acq_Start(BMS_ACQ_DEFAULT_PERIOD_MS, knChainId);
+        if(nRet == 0) {
+            printf("Estimating, press any key to stop\n");
+            while(pConsole->readable() == false) {
+                while(Adbms6948_Acq_Pop(BMS_ACQ_CONSUMER_SOC, &oFrame) == true) {
+                    /* Shunt nanovolts over micro-ohms are milliamperes */
+                    fCurrentA = (float)BMS_UNITS_AVG_CURRENT_CODE_TO_NV(oFrame.anCurrent[0]) /
+                                ((float)SYS_CC_SHUNT_MICRO_OHM * 1000.0f);
+                    if(bStarted == false) {
+                        BmsSoc_Init(&koSocCfg, &oSocState, &oFrame.anCellVoltage[0], SYS_CM_DEVICES_PRESENT * 16u);
+                        nPrintUs = oFrame.nTimestampUs;
+                        bStarted = true;
+                    } else {
+                        BmsSoc_Update(&koSocCfg, &oSocState, &oFrame.anCellVoltage[0], fCurrentA,
+                                      (float)(oFrame.nTimestampUs - nLastUs) * 1e-6f);
+                    }
+                    nLastUs = oFrame.nTimestampUs;
+                    if((oFrame.nTimestampUs - nPrintUs) >= (SYS_SOC_PRINT_MS * 1000u)) {
+                        nPrintUs = oFrame.nTimestampUs;
+                        BmsSoc_GetSocCentiPct(&oSocState, &anSoc[0]);
+                        printf("SOC %%, %.3f A:", fCurrentA);
+                        for(uint16_t nCell = 0u; nCell < (SYS_CM_DEVICES_PRESENT * 16u); nCell++) {
+                            printf(" %d.%02d", anSoc[nCell] / 100, anSoc[nCell] % 100);
+                        }
+                        printf("\n");
+                    }
+                }
+                ThisThread::sleep_for(std::chrono::milliseconds(BMS_ACQ_DEFAULT_PERIOD_MS));
+            }
+            (void)pConsole->read(&cKey, 1);
+            Adbms6948_Acq_Stop();
+        } else {
+            printf("Acquisition start failed\n");
+        }
+        Adbms6948_Acq_Detach(BMS_ACQ_CONSUMER_SOC);
+        printf("State of charge updates: %lu\n", (unsigned long)oSocState.nUpdates);
     } else {
         printf("Init Failed\n");
     }
@@ -317,37 +924,24 @@ void Adbms6948_read_cont_measurement(const uint8_t knChainId, int nRet, uint8_t
 void Adbms6948_measure_aux_voltage(const uint8_t knChainId, int nRet)
 {
     int16_t anGpioVoltage[11];
+    BMS_CONVERSION oConv = {
+        ADBMS6948_ADC_AUX, 0u,
+        Adbms6948_conv_trig_aux, NULL,
+        Adbms6948_conv_read_gpio, &anGpioVoltage[0]};
 
-    Adbms6948_TrigAuxADC(
-        0,
-        0,
-        ADBMS6948_AUX_CH_ALL,
-        knChainId);
-    wait_us(20000); //20ms
-
-    Adbms6948_ReadGPIOInputVolt(
-        ADBMS6948_GPIO_MEAS_DATA,
-        ADBMS6948_GPIO_GRP_ALL,
-        &anGpioVoltage[0],
-        knChainId);
+    (void)Adbms6948_Conv_Run(&oConv, BMS_CONV_WAIT_POLL, NULL, knChainId);
     PrintGpioVoltage(&anGpioVoltage[0]);
 }
 
 void Adbms6948_measure_status_voltage(const uint8_t knChainId, int nRet)
 {
     int16_t anStatVoltage[8];
+    BMS_CONVERSION oConv = {
+        ADBMS6948_ADC_AUX, 0u,
+        Adbms6948_conv_trig_aux, NULL,
+        Adbms6948_conv_read_status, &anStatVoltage[0]};
 
-    Adbms6948_TrigAuxADC(
-        0,
-        0,
-        ADBMS6948_AUX_CH_ALL,
-        knChainId);
-    wait_us(20000); //20ms
-
-    Adbms6948_ReadDevParam(
-        ADBMS6948_DEV_PARAMS_ALL,
-        &anStatVoltage[0],
-        knChainId);
+    (void)Adbms6948_Conv_Run(&oConv, BMS_CONV_WAIT_POLL, NULL, knChainId);
     PrintStatusVoltage(&anStatVoltage[0]);
 }
 
@@ -370,15 +964,13 @@ void Adbms6948_configure_read_cell_ovuv_flags(const uint8_t knChainId, int nRet)
             0,
             ADBMS6948_CELL_OW_NONE};
 
-        /*Trigger C-ADC conversions*/
-        nRet |= Adbms6948_TrigCADC(&oCADCInputs, knChainId);
-        wait_us(1100); //1.1ms
-        /*Read the Cell Voltages*/
-        nRet |= Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA,
-                                    ADBMS6948_CELL_GRP_SEL_ALL,
-                                    &anCellVolt[0],
-                                    ADBMS6948_SEND_NONE,
-                                    knChainId);
+        BMS_CONVERSION oConv = {
+            ADBMS6948_ADC_CADC, 0u,
+            Adbms6948_conv_trig_cadc, &oCADCInputs,
+            Adbms6948_conv_read_cells, &anCellVolt[0]};
+
+        /*Trigger C-ADC conversions and read the Cell Voltages*/
+        nRet |= Adbms6948_Conv_Run(&oConv, BMS_CONV_WAIT_POLL, NULL, knChainId);
         /*Read Cell OV, UV Status*/
         nRet |= Adbms6948_ReadCellOVUVStatus(&nCellOVUVStatus, ADBMS6948_SEND_NONE, knChainId);
 
@@ -488,4 +1080,83 @@ void parseCellOVUVStatus(const uint32_t nCellOVUVStatus, uint16_t *const pnCellO
     return;
 }
 
+/*! Conversion step, triggers the C-ADC with the Adbms6948_TrigCADCInputs in pArg */
+static int Adbms6948_conv_trig_cadc(void *pArg, const uint8_t knChainId)
+{
+    return Adbms6948_TrigCADC((Adbms6948_TrigCADCInputs *)pArg, knChainId);
+}
+
+/*! Conversion step, triggers the I1-ADC with the Adbms6948_TrigI1ADCInputs in pArg */
+static int Adbms6948_conv_trig_i1adc(void *pArg, const uint8_t knChainId)
+{
+    return Adbms6948_TrigI1ADC((Adbms6948_TrigI1ADCInputs *)pArg, knChainId);
+}
+
+/*! Conversion step, triggers the S-ADC on all cells */
+static int Adbms6948_conv_trig_sadc(void *pArg, const uint8_t knChainId)
+{
+    return Adbms6948_TrigSADC(0, 0, ADBMS6948_CELL_OW_NONE, knChainId);
+}
+
+/*! Conversion step, triggers the auxiliary ADCs on all channels */
+static int Adbms6948_conv_trig_aux(void *pArg, const uint8_t knChainId)
+{
+    return Adbms6948_TrigAuxADC(0, 0, ADBMS6948_AUX_CH_ALL, knChainId);
+}
+
+/*! Conversion step, reads the cell voltages into the int16_t[16] in pArg */
+static int Adbms6948_conv_read_cells(void *pArg, const uint8_t knChainId)
+{
+    return Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA,
+                                  ADBMS6948_CELL_GRP_SEL_ALL,
+                                  (int16_t *)pArg,
+                                  ADBMS6948_SEND_NONE,
+                                  knChainId);
+}
+
+/*! Conversion step, reads the averaged cell voltages into the int16_t[16] in pArg */
+static int Adbms6948_conv_read_avg_cells(void *pArg, const uint8_t knChainId)
+{
+    return Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA_AVERAGED,
+                                  ADBMS6948_CELL_GRP_SEL_ALL,
+                                  (int16_t *)pArg,
+                                  ADBMS6948_SEND_NONE,
+                                  knChainId);
+}
+
+/*! Conversion step, reads the S-pin voltages into the int16_t[16] in pArg */
+static int Adbms6948_conv_read_spins(void *pArg, const uint8_t knChainId)
+{
+    return Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA_REDUNDANT,
+                                  ADBMS6948_CELL_GRP_SEL_ALL,
+                                  (int16_t *)pArg,
+                                  ADBMS6948_SEND_NONE,
+                                  knChainId);
+}
+
+/*! Conversion step, reads the I1 current into the int32_t in pArg */
+static int Adbms6948_conv_read_current(void *pArg, const uint8_t knChainId)
+{
+    return Adbms6948_ReadCurrent(ADBMS6948_CURRENT_MEAS_DATA,
+                                 ADBMS6948_CURRENT_I1,
+                                 (int32_t *)pArg,
+                                 ADBMS6948_SEND_NONE,
+                                 knChainId);
+}
+
+/*! Conversion step, reads the GPIO voltages into the int16_t[11] in pArg */
+static int Adbms6948_conv_read_gpio(void *pArg, const uint8_t knChainId)
+{
+    return Adbms6948_ReadGPIOInputVolt(ADBMS6948_GPIO_MEAS_DATA,
+                                       ADBMS6948_GPIO_GRP_ALL,
+                                       (int16_t *)pArg,
+                                       knChainId);
+}
+
+/*! Conversion step, reads the device parameters into the int16_t[8] in pArg */
+static int Adbms6948_conv_read_status(void *pArg, const uint8_t knChainId)
+{
+    return Adbms6948_ReadDevParam(ADBMS6948_DEV_PARAMS_ALL, (int16_t *)pArg, knChainId);
+}
+
 /*! @}*/
\ No newline at end of file
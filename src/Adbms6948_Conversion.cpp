@@ -0,0 +1,169 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    Adbms6948_Conversion.cpp
+ * @brief   Completion driven conversions. The calling thread sleeps on a
+ *          semaphore released by the PAL timer of its daisy chain, so other
+ *          threads run while the ADCs convert.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Adbms6948_AppsExample
+*  @{
+*/
+
+#include "Adbms6948_Conversion.h"
+#include "adi_bms_platform.h"
+
+/*! Released from the PAL timer of every daisy chain */
+static Semaphore aoConvWakeup[ADBMS6948_NO_OF_DAISY_CHAIN];
+
+static int Adbms6948_conv_wait_poll(Adbms6948_ADCSelType eAdc, uint32_t nConvTimeUs, BMS_CONV_STATS *poStats, const uint8_t knChainId);
+static void Adbms6948_conv_sleep(uint32_t nDelayUs, const uint8_t knChainId);
+static void Adbms6948_conv_wakeup(uint8 nChainID);
+
+/*!
+    @brief  Run a conversion
+
+    Issues the trigger, sleeps until the end of conversion and runs the
+    read. With @c BMS_CONV_WAIT_POLL the ADC status is first polled after
+    half the conversion time and then every BMS_CONV_POLL_INTERVAL_US, so
+    the read follows the actual end of conversion rather than the worst
+    case. Conversions in continuous mode never report done and must use
+    @c BMS_CONV_WAIT_DEADLINE.
+
+    @param[in]  poConv    Conversion to run
+    @param[in]  eWait     Detection of the end of conversion
+    @param[out] poStats   Placeholder for the wait statistics, may be NULL
+    @param[in]  knChainId Daisy chain ID
+
+    @return 0 on success, non-zero otherwise
+*/
+int Adbms6948_Conv_Run(const BMS_CONVERSION *poConv, BMS_CONV_WAIT eWait, BMS_CONV_STATS *poStats, const uint8_t knChainId)
+{
+    int nRet;
+    BMS_CONV_STATS oStats = {0u, 0u};
+    uint32_t nConvTimeUs = poConv->nConvTimeUs;
+    uint64_t nStartUs;
+
+    if(nConvTimeUs == 0u) {
+        nConvTimeUs = Adbms6948_Conv_GetConvTimeUs(poConv->eAdc);
+    }
+
+    nRet = poConv->pfTrigger(poConv->pTriggerArg, knChainId);
+    nStartUs = ADI_PAL_GET_TIME_US();
+
+    if(nRet == 0) {
+        if(eWait == BMS_CONV_WAIT_POLL) {
+            nRet = Adbms6948_conv_wait_poll(poConv->eAdc, nConvTimeUs, &oStats, knChainId);
+        } else {
+            Adbms6948_conv_sleep(nConvTimeUs, knChainId);
+        }
+        oStats.nWaitUs = (uint32_t)(ADI_PAL_GET_TIME_US() - nStartUs);
+    }
+
+    if(nRet == 0) {
+        nRet = poConv->pfRead(poConv->pReadArg, knChainId);
+    }
+
+    if(poStats != NULL) {
+        *poStats = oStats;
+    }
+    return nRet;
+}
+
+/*!
+    @brief  Get the single conversion time of an ADC
+
+    @param[in]  eAdc ADC selection
+
+    @return Conversion time in microseconds
+*/
+uint32_t Adbms6948_Conv_GetConvTimeUs(Adbms6948_ADCSelType eAdc)
+{
+    uint32_t nConvTimeUs;
+
+    switch(eAdc) {
+        case ADBMS6948_ADC_CADC:
+            nConvTimeUs = BMS_CONV_T_CADC_US;
+            break;
+        case ADBMS6948_ADC_SADC:
+            nConvTimeUs = BMS_CONV_T_SADC_US;
+            break;
+        case ADBMS6948_ADC_I1ADC:
+        case ADBMS6948_ADC_I2ADC:
+            nConvTimeUs = BMS_CONV_T_IADC_US;
+            break;
+        default:
+            /* Auxiliary ADCs and all ADCs, bound by the auxiliary sequence */
+            nConvTimeUs = BMS_CONV_T_AUX_US;
+            break;
+    }
+    return nConvTimeUs;
+}
+
+/*!
+    @brief  Poll the ADC status until the end of conversion
+
+    @param[in]  eAdc        ADC to poll
+    @param[in]  nConvTimeUs Nominal conversion time
+    @param[out] poStats     Placeholder for the number of polls
+    @param[in]  knChainId   Daisy chain ID
+
+    @return 0 once the ADC is done, non-zero on a read error or timeout
+*/
+static int Adbms6948_conv_wait_poll(Adbms6948_ADCSelType eAdc, uint32_t nConvTimeUs, BMS_CONV_STATS *poStats, const uint8_t knChainId)
+{
+    int nRet = 0;
+    boolean bBusy = TRUE;
+    uint32_t nWaitedUs = nConvTimeUs / 2u;
+    uint32_t nTimeoutUs = nConvTimeUs * BMS_CONV_TIMEOUT_FACTOR;
+
+    Adbms6948_conv_sleep(nWaitedUs, knChainId);
+    while(nRet == 0) {
+        nRet = Adbms6948_PollADCStatus(eAdc, &bBusy, knChainId);
+        poStats->nPolls++;
+        if((nRet != 0) || (bBusy == FALSE)) {
+            break;
+        }
+        if(nWaitedUs >= nTimeoutUs) {
+            nRet = 1;
+        } else {
+            Adbms6948_conv_sleep(BMS_CONV_POLL_INTERVAL_US, knChainId);
+            nWaitedUs += BMS_CONV_POLL_INTERVAL_US;
+        }
+    }
+    return nRet;
+}
+
+/*!
+    @brief  Sleep the calling thread on the PAL timer of the daisy chain
+
+    @param[in]  nDelayUs  Delay in microseconds
+    @param[in]  knChainId Daisy chain ID
+*/
+static void Adbms6948_conv_sleep(uint32_t nDelayUs, const uint8_t knChainId)
+{
+    ADI_PAL_TIMER_START_CB(nDelayUs, Adbms6948_conv_wakeup, knChainId);
+    aoConvWakeup[knChainId].acquire();
+}
+
+/*!
+    @brief  Expiry of the PAL timer, runs in interrupt context
+
+    @param[in]  nChainID Daisy chain ID
+*/
+static void Adbms6948_conv_wakeup(uint8 nChainID)
+{
+    aoConvWakeup[nChainID].release();
+}
+
+
+/*! @}*/
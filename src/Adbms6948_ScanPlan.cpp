@@ -0,0 +1,542 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    Adbms6948_ScanPlan.cpp
+ * @brief   Scan-plan engine. Adbms6948_Scan_Compile() levels the tasks over
+ *          the slots of the hyperperiod; a periodic event on a dedicated
+ *          thread executes one slot per period, reads first and then the
+ *          auxiliary and open wire triggers, so every run of the plan issues
+ *          the same SPI frames in the same order.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Adbms6948_AppsExample
+*  @{
+*/
+
+#include "Adbms6948_ScanPlan.h"
+#include "Adbms6948_Acquisition.h"
+#include "Adbms6948_Conversion.h"
+
+/*! Stack of the scan thread, holds the driver read buffers */
+#define BMS_SCAN_THREAD_STACK_SIZE  (4096u)
+/*! Bytes of a command frame */
+#define BMS_SCAN_CMD_LEN            (4u)
+/*! Bytes of a register group per device, data and PEC */
+#define BMS_SCAN_REG_LEN            (8u)
+
+/*! Register group frames read by each measurement, the cells are read group by group at worst, the
+    cross check counts the eight groups of its C and S frame and Status C */
+static const uint8_t anScanFrames[BMS_SCAN_NO_OF_MEAS] = {6u, 1u, 4u, 3u, 6u, 9u};
+
+static EventQueue oScanQueue(8 * EVENTS_EVENT_SIZE);
+static Thread oScanThread(osPriorityAboveNormal, BMS_SCAN_THREAD_STACK_SIZE, NULL, "bms_scan");
+static bool bScanThreadStarted = false;
+static Semaphore oScanIdle(0, 1);
+static Timer oScanTimer;
+
+static const BMS_SCAN_PLAN *poScanPlan = NULL;
+static volatile BMS_SCAN_STATS oScanStats;
+static int nScanEventId = 0;
+static uint8_t nScanChainId = 0u;
+static uint16_t nScanSlot = 0u;
+static uint32_t nScanSlotCount = 0u;
+static uint64_t nScanNextDueUs = 0u;
+static bool bScanAuxConverted = false;
+static bool bScanOwConverted = false;
+static Adbms6948_CellOWSelType eScanOwSel = ADBMS6948_CELL_OW_EVEN;
+
+static uint32_t Adbms6948_scan_gcd(uint32_t nA, uint32_t nB);
+static bool Adbms6948_scan_is_aux(BMS_SCAN_MEAS eMeas);
+static bool Adbms6948_scan_is_ready(BMS_SCAN_MEAS eMeas);
+static uint32_t Adbms6948_scan_place(BMS_SCAN_PLAN *poPlan, uint8_t nTask, uint16_t nPhase, uint16_t nPeriod,
+                                     uint16_t nAuxSlots, uint16_t nCostUs, uint16_t nTrigCostUs, bool bApply);
+static void Adbms6948_scan_slot(void);
+static int Adbms6948_scan_read(BMS_SCAN_MEAS eMeas, BMS_SCAN_RESULT *poResult, const uint8_t knChainId);
+static void Adbms6948_scan_release_idle(void);
+
+/*!
+    @brief  Compile a table of measurement tasks into a scan plan
+
+    The slot length is the greatest common divisor of the periods and the
+    plan spans their least common multiple. Tasks are placed from the
+    shortest period on, each at the phase that keeps the busiest slot it
+    touches lowest. The first auxiliary task fixes the grid of the auxiliary
+    conversions; the other auxiliary tasks must have multiple periods and are
+    placed on that grid, so they share its triggers. An open wire task reads
+    the S-ADC and triggers its next conversion, with the other wires
+    switched, in the same slot, so its period must cover a conversion; the
+    C-ADC keeps converting meanwhile. A cross check task needs the S-ADC to
+    follow the C-ADC and excludes an open wire task.
+
+    @param[in]  paoTasks     Table of the tasks
+    @param[in]  nNoOfTasks   Number of tasks in the table
+    @param[in]  nNoOfDevices Devices in the daisy chain, scales the SPI time of a frame
+    @param[out] poPlan       Placeholder for the compiled plan
+
+    @return BMS_SCAN_OK if the plan fits, the reason otherwise
+*/
+BMS_SCAN_ERR Adbms6948_Scan_Compile(const BMS_SCAN_TASK *paoTasks, uint8_t nNoOfTasks, uint8_t nNoOfDevices, BMS_SCAN_PLAN *poPlan)
+{
+    BMS_SCAN_ERR eRet = BMS_SCAN_OK;
+    uint8_t anOrder[BMS_SCAN_MAX_TASKS];
+    uint32_t nSlotMs = 0u;
+    uint32_t nSpanMs = 1u;
+    uint16_t nFrameUs = (uint16_t)(BMS_SCAN_FRAME_OVERHEAD_US +
+                                   (((BMS_SCAN_CMD_LEN + (BMS_SCAN_REG_LEN * nNoOfDevices)) * 8u) / BMS_SCAN_SPI_CLOCK_MHZ));
+    uint16_t nTrigCostUs = (uint16_t)(BMS_SCAN_FRAME_OVERHEAD_US + ((BMS_SCAN_CMD_LEN * 8u) / BMS_SCAN_SPI_CLOCK_MHZ));
+    uint16_t nAuxSlots = 0u;
+    uint16_t nAuxPeriod = 0u;
+    uint16_t nAuxPhase = 0u;
+    uint16_t nOwSlots = 0u;
+    uint8_t nNoOfOwTasks = 0u;
+    uint8_t nNoOfCsTasks = 0u;
+
+    memset(poPlan, 0, sizeof(BMS_SCAN_PLAN));
+
+    if((nNoOfTasks == 0u) || (nNoOfTasks > BMS_SCAN_MAX_TASKS)) {
+        eRet = BMS_SCAN_ERR_TASKS;
+    }
+
+    for(uint8_t nTask = 0u; (eRet == BMS_SCAN_OK) && (nTask < nNoOfTasks); nTask++) {
+        if((paoTasks[nTask].nPeriodMs == 0u) || (paoTasks[nTask].pfHandler == NULL) ||
+           ((uint32_t)paoTasks[nTask].eMeas >= (uint32_t)BMS_SCAN_NO_OF_MEAS)) {
+            eRet = BMS_SCAN_ERR_TASKS;
+        } else {
+            poPlan->aoTask[nTask] = paoTasks[nTask];
+            nSlotMs = Adbms6948_scan_gcd(nSlotMs, paoTasks[nTask].nPeriodMs);
+            if(paoTasks[nTask].eMeas == BMS_SCAN_MEAS_OPEN_WIRE) {
+                nNoOfOwTasks++;
+            } else if(paoTasks[nTask].eMeas == BMS_SCAN_MEAS_CS_CHECK) {
+                nNoOfCsTasks++;
+            }
+        }
+    }
+
+    /* The S-ADC alternates the odd and even wires of a single task, or converts with the C-ADC */
+    if((nNoOfOwTasks > 1u) || ((nNoOfOwTasks != 0u) && (nNoOfCsTasks != 0u))) {
+        eRet = BMS_SCAN_ERR_TASKS;
+    }
+
+    /* The span only grows, stop as soon as it exceeds the slot table */
+    for(uint8_t nTask = 0u; (eRet == BMS_SCAN_OK) && (nTask < nNoOfTasks); nTask++) {
+        nSpanMs = (nSpanMs / Adbms6948_scan_gcd(nSpanMs, paoTasks[nTask].nPeriodMs)) * paoTasks[nTask].nPeriodMs;
+        if((nSpanMs / nSlotMs) > BMS_SCAN_MAX_SLOTS) {
+            eRet = BMS_SCAN_ERR_SLOTS;
+        }
+    }
+
+    if(eRet == BMS_SCAN_OK) {
+        poPlan->nNoOfTasks = nNoOfTasks;
+        poPlan->nSlotUs = nSlotMs * 1000u;
+        poPlan->nNoOfSlots = (uint16_t)(nSpanMs / nSlotMs);
+        /* The trigger runs late in its slot, keep a whole slot of margin */
+        nAuxSlots = (uint16_t)(((BMS_CONV_T_AUX_US + poPlan->nSlotUs - 1u) / poPlan->nSlotUs) + 1u);
+        nOwSlots = (uint16_t)(((BMS_CONV_T_SADC_US + poPlan->nSlotUs - 1u) / poPlan->nSlotUs) + 1u);
+
+        /* Shortest period first, ties in table order */
+        for(uint8_t nTask = 0u; nTask < nNoOfTasks; nTask++) {
+            uint8_t nPos = nTask;
+            while((nPos > 0u) && (paoTasks[anOrder[nPos - 1u]].nPeriodMs > paoTasks[nTask].nPeriodMs)) {
+                anOrder[nPos] = anOrder[nPos - 1u];
+                nPos--;
+            }
+            anOrder[nPos] = nTask;
+        }
+    }
+
+    for(uint8_t nIdx = 0u; (eRet == BMS_SCAN_OK) && (nIdx < nNoOfTasks); nIdx++) {
+        uint8_t nTask = anOrder[nIdx];
+        BMS_SCAN_MEAS eMeas = paoTasks[nTask].eMeas;
+        uint16_t nPeriod = (uint16_t)(paoTasks[nTask].nPeriodMs / nSlotMs);
+        uint16_t nCostUs = (uint16_t)(anScanFrames[eMeas] * nFrameUs);
+        uint16_t nFirst = 0u;
+        uint16_t nStep = 1u;
+        uint16_t nBestPhase = 0u;
+        uint32_t nBestLoadUs = 0xFFFFFFFFu;
+
+        if(Adbms6948_scan_is_aux(eMeas) == true) {
+            if(nAuxPeriod == 0u) {
+                if(nPeriod < nAuxSlots) {
+                    eRet = BMS_SCAN_ERR_AUX;
+                }
+            } else if((nPeriod % nAuxPeriod) != 0u) {
+                eRet = BMS_SCAN_ERR_AUX;
+            } else {
+                nFirst = nAuxPhase;
+                nStep = nAuxPeriod;
+            }
+        } else if(eMeas == BMS_SCAN_MEAS_OPEN_WIRE) {
+            if(nPeriod < nOwSlots) {
+                eRet = BMS_SCAN_ERR_AUX;
+            }
+            nCostUs = (uint16_t)(nCostUs + nTrigCostUs);
+        } else {
+            poPlan->bContIVADC = true;
+            if(eMeas == BMS_SCAN_MEAS_CS_CHECK) {
+                poPlan->bRedundant = true;
+            }
+        }
+
+        if(eRet == BMS_SCAN_OK) {
+            for(uint16_t nPhase = nFirst; nPhase < nPeriod; nPhase += nStep) {
+                uint32_t nLoadUs = Adbms6948_scan_place(poPlan, nTask, nPhase, nPeriod, nAuxSlots, nCostUs, nTrigCostUs, false);
+                if(nLoadUs < nBestLoadUs) {
+                    nBestLoadUs = nLoadUs;
+                    nBestPhase = nPhase;
+                }
+            }
+            (void)Adbms6948_scan_place(poPlan, nTask, nBestPhase, nPeriod, nAuxSlots, nCostUs, nTrigCostUs, true);
+            poPlan->anPhase[nTask] = nBestPhase;
+            if(nBestLoadUs > poPlan->nMaxLoadUs) {
+                poPlan->nMaxLoadUs = (uint16_t)nBestLoadUs;
+            }
+            if((Adbms6948_scan_is_aux(eMeas) == true) && (nAuxPeriod == 0u)) {
+                nAuxPeriod = nPeriod;
+                nAuxPhase = nBestPhase;
+            }
+        }
+    }
+
+    if((eRet == BMS_SCAN_OK) && (poPlan->nMaxLoadUs > ((poPlan->nSlotUs * BMS_SCAN_SLOT_BUDGET_PCT) / 100u))) {
+        eRet = BMS_SCAN_ERR_LOAD;
+    }
+
+    if(eRet != BMS_SCAN_OK) {
+        poPlan->nNoOfSlots = 0u;
+    }
+    return eRet;
+}
+
+/*!
+    @brief  Start executing a scan plan
+
+    Starts the C-ADC and I1-ADC in continuous mode when the plan has cell or
+    current tasks, with redundancy when it has a cross check task, and
+    executes one slot every slot length on the scan thread.
+    The open wire conversions start with the odd wires.
+    The plan must stay valid and the engine is the only user of the driver
+    until Adbms6948_Scan_Stop() returns. Auxiliary reads are skipped until
+    the first auxiliary conversion of the plan is done.
+
+    @param[in]  poPlan    Plan compiled by Adbms6948_Scan_Compile()
+    @param[in]  knChainId Daisy chain ID
+
+    @return 0 on success, non-zero otherwise
+*/
+int Adbms6948_Scan_Start(const BMS_SCAN_PLAN *poPlan, const uint8_t knChainId)
+{
+    int nRet = 0;
+    Adbms6948_TrigIVADCInputs oTrigIVADCInputs = {
+        TRUE,                   /*Adbms6948_bContMode*/
+        FALSE,                  /*Adbms6948_bEnRedun*/
+        FALSE,                  /*Adbms6948_bEnSSDP*/
+        FALSE,                  /*Adbms6948_bRstIIRFltr*/
+        ADBMS6948_CELL_OW_NONE  /*Adbms6948_eOWSel*/
+    };
+
+    if((nScanEventId != 0) || (poPlan->nNoOfSlots == 0u) || (Adbms6948_Acq_IsRunning() == true)) {
+        nRet = 1;
+    }
+
+    if(nRet == 0) {
+        if(bScanThreadStarted == false) {
+            oScanTimer.start();
+            nRet = (int)oScanThread.start(callback(&oScanQueue, &EventQueue::dispatch_forever));
+            bScanThreadStarted = (nRet == 0);
+        }
+    }
+
+    if((nRet == 0) && (poPlan->bContIVADC == true)) {
+        oTrigIVADCInputs.Adbms6948_bEnRedun = (poPlan->bRedundant == true) ? TRUE : FALSE;
+        nRet = Adbms6948_TrigIVADC(&oTrigIVADCInputs, knChainId);
+    }
+
+    if(nRet == 0) {
+        poScanPlan = poPlan;
+        nScanChainId = knChainId;
+        nScanSlot = 0u;
+        nScanSlotCount = 0u;
+        bScanAuxConverted = false;
+        bScanOwConverted = false;
+        eScanOwSel = ADBMS6948_CELL_OW_EVEN;
+        memset((void *)&oScanStats, 0, sizeof(oScanStats));
+        nScanNextDueUs = (uint64_t)oScanTimer.elapsed_time().count() + poPlan->nSlotUs;
+        nScanEventId = oScanQueue.call_every(std::chrono::milliseconds(poPlan->nSlotUs / 1000u), Adbms6948_scan_slot);
+        if(nScanEventId == 0) {
+            nRet = 1;
+        }
+    }
+    return nRet;
+}
+
+/*!
+    @brief  Stop executing the scan plan
+
+    Cancels the slot event and returns once a slot in progress has
+    completed, so the caller may use the driver again.
+*/
+void Adbms6948_Scan_Stop(void)
+{
+    if(nScanEventId != 0) {
+        oScanQueue.cancel(nScanEventId);
+        nScanEventId = 0;
+        /* The queue runs its events in order, the slot in progress ends before this one runs */
+        oScanQueue.call(Adbms6948_scan_release_idle);
+        oScanIdle.acquire();
+    }
+}
+
+/*!
+    @brief  Check whether a scan plan is executing
+
+    @return true if the slot event is scheduled
+*/
+bool Adbms6948_Scan_IsRunning(void)
+{
+    return (nScanEventId != 0);
+}
+
+/*!
+    @brief  Get the scan statistics
+
+    @param[out] poStats Placeholder for the statistics
+*/
+void Adbms6948_Scan_GetStats(BMS_SCAN_STATS *poStats)
+{
+    poStats->nSlots = core_util_atomic_load_u32(&oScanStats.nSlots);
+    poStats->nOverruns = core_util_atomic_load_u32(&oScanStats.nOverruns);
+    poStats->nReadErrors = core_util_atomic_load_u32(&oScanStats.nReadErrors);
+    poStats->nMaxSlotUs = core_util_atomic_load_u32(&oScanStats.nMaxSlotUs);
+    poStats->nMaxLatenessUs = core_util_atomic_load_u32(&oScanStats.nMaxLatenessUs);
+    poStats->nLastOverrunSlot = core_util_atomic_load_u32(&oScanStats.nLastOverrunSlot);
+}
+
+/*!
+    @brief  Greatest common divisor, 0 is neutral
+*/
+static uint32_t Adbms6948_scan_gcd(uint32_t nA, uint32_t nB)
+{
+    while(nB != 0u) {
+        uint32_t nRem = nA % nB;
+        nA = nB;
+        nB = nRem;
+    }
+    return nA;
+}
+
+/*!
+    @brief  Check whether a measurement reads an auxiliary conversion
+*/
+static bool Adbms6948_scan_is_aux(BMS_SCAN_MEAS eMeas)
+{
+    return ((eMeas == BMS_SCAN_MEAS_GPIO) || (eMeas == BMS_SCAN_MEAS_STATUS));
+}
+
+/*!
+    @brief  Check whether the registers of a measurement hold a conversion
+
+    The auxiliary and open wire reads wait for the first trigger of the plan.
+*/
+static bool Adbms6948_scan_is_ready(BMS_SCAN_MEAS eMeas)
+{
+    bool bReady = true;
+
+    if(Adbms6948_scan_is_aux(eMeas) == true) {
+        bReady = bScanAuxConverted;
+    } else if(eMeas == BMS_SCAN_MEAS_OPEN_WIRE) {
+        bReady = bScanOwConverted;
+    }
+    return bReady;
+}
+
+/*!
+    @brief  Evaluate or apply the placement of a task at a phase
+
+    An auxiliary task also loads the slot triggering its conversion, unless
+    that slot already triggers one. An open wire task triggers in the slots
+    it reads.
+
+    @param[in,out] poPlan      Plan being compiled
+    @param[in]     nTask       Task to place
+    @param[in]     nPhase      First slot of the task
+    @param[in]     nPeriod     Period of the task in slots
+    @param[in]     nAuxSlots   Slots between an auxiliary trigger and its read
+    @param[in]     nCostUs     SPI time of the task's reads
+    @param[in]     nTrigCostUs SPI time of a trigger
+    @param[in]     bApply      Record the placement in the plan
+
+    @return SPI time of the busiest slot the placement touches
+*/
+static uint32_t Adbms6948_scan_place(BMS_SCAN_PLAN *poPlan, uint8_t nTask, uint16_t nPhase, uint16_t nPeriod,
+                                     uint16_t nAuxSlots, uint16_t nCostUs, uint16_t nTrigCostUs, bool bApply)
+{
+    uint32_t nMaxLoadUs = 0u;
+    bool bAux = Adbms6948_scan_is_aux(poPlan->aoTask[nTask].eMeas);
+    uint16_t nTrigBit = (poPlan->aoTask[nTask].eMeas == BMS_SCAN_MEAS_OPEN_WIRE) ? BMS_SCAN_SLOT_TRIG_OW : 0u;
+
+    for(uint16_t nSlot = nPhase; nSlot < poPlan->nNoOfSlots; nSlot += nPeriod) {
+        uint32_t nLoadUs = (uint32_t)poPlan->anSlotLoadUs[nSlot] + nCostUs;
+        if(nLoadUs > nMaxLoadUs) {
+            nMaxLoadUs = nLoadUs;
+        }
+        if(bApply == true) {
+            poPlan->anSlot[nSlot] |= (uint16_t)((1u << nTask) | nTrigBit);
+            poPlan->anSlotLoadUs[nSlot] = (uint16_t)nLoadUs;
+        }
+
+        if(bAux == true) {
+            uint16_t nTrigSlot = (uint16_t)(((uint32_t)nSlot + poPlan->nNoOfSlots - (nAuxSlots % poPlan->nNoOfSlots)) % poPlan->nNoOfSlots);
+            if((poPlan->anSlot[nTrigSlot] & BMS_SCAN_SLOT_TRIG_AUX) == 0u) {
+                nLoadUs = (uint32_t)poPlan->anSlotLoadUs[nTrigSlot] + nTrigCostUs;
+                if(nLoadUs > nMaxLoadUs) {
+                    nMaxLoadUs = nLoadUs;
+                }
+                if(bApply == true) {
+                    poPlan->anSlot[nTrigSlot] |= BMS_SCAN_SLOT_TRIG_AUX;
+                    poPlan->anSlotLoadUs[nTrigSlot] = (uint16_t)nLoadUs;
+                }
+            }
+        }
+    }
+    return nMaxLoadUs;
+}
+
+/*!
+    @brief  Execute the current slot of the plan
+
+    Runs on the scan thread. A slot overruns when it starts a whole slot late
+    or ends after the next slot is due; it is executed anyway, so the order
+    of the frames never changes.
+*/
+static void Adbms6948_scan_slot(void)
+{
+    BMS_SCAN_RESULT oResult;
+    uint16_t nSlotWord = poScanPlan->anSlot[nScanSlot];
+    uint64_t nStartUs = (uint64_t)oScanTimer.elapsed_time().count();
+    uint64_t nEndUs;
+    uint32_t nLatenessUs = (nStartUs > nScanNextDueUs) ? (uint32_t)(nStartUs - nScanNextDueUs) : 0u;
+
+    if(nLatenessUs > oScanStats.nMaxLatenessUs) {
+        core_util_atomic_store_u32(&oScanStats.nMaxLatenessUs, nLatenessUs);
+    }
+
+    for(uint8_t nTask = 0u; nTask < poScanPlan->nNoOfTasks; nTask++) {
+        const BMS_SCAN_TASK *poTask = &poScanPlan->aoTask[nTask];
+        if(((nSlotWord & (1u << nTask)) != 0u) && (Adbms6948_scan_is_ready(poTask->eMeas) == true)) {
+            oResult.eMeas = poTask->eMeas;
+            oResult.nTask = nTask;
+            oResult.nSlot = nScanSlotCount;
+            oResult.nTimestampUs = (uint64_t)oScanTimer.elapsed_time().count();
+            oResult.nStatus = Adbms6948_scan_read(poTask->eMeas, &oResult, nScanChainId);
+            if(oResult.nStatus != 0) {
+                core_util_atomic_incr_u32(&oScanStats.nReadErrors, 1u);
+            }
+            poTask->pfHandler(&oResult, poTask->pArg);
+        }
+    }
+
+    if((nSlotWord & BMS_SCAN_SLOT_TRIG_AUX) != 0u) {
+        if(Adbms6948_TrigAuxADC(0, 0, ADBMS6948_AUX_CH_ALL, nScanChainId) == 0) {
+            bScanAuxConverted = true;
+        } else {
+            core_util_atomic_incr_u32(&oScanStats.nReadErrors, 1u);
+        }
+    }
+
+    /* The next conversion switches the other wires */
+    if((nSlotWord & BMS_SCAN_SLOT_TRIG_OW) != 0u) {
+        eScanOwSel = (eScanOwSel == ADBMS6948_CELL_OW_ODD) ? ADBMS6948_CELL_OW_EVEN : ADBMS6948_CELL_OW_ODD;
+        bScanOwConverted = (Adbms6948_TrigSADC(0, 0, eScanOwSel, nScanChainId) == 0);
+        if(bScanOwConverted == false) {
+            core_util_atomic_incr_u32(&oScanStats.nReadErrors, 1u);
+        }
+    }
+
+    nEndUs = (uint64_t)oScanTimer.elapsed_time().count();
+    if((uint32_t)(nEndUs - nStartUs) > oScanStats.nMaxSlotUs) {
+        core_util_atomic_store_u32(&oScanStats.nMaxSlotUs, (uint32_t)(nEndUs - nStartUs));
+    }
+    if((nLatenessUs >= poScanPlan->nSlotUs) || (nEndUs > (nScanNextDueUs + poScanPlan->nSlotUs))) {
+        core_util_atomic_incr_u32(&oScanStats.nOverruns, 1u);
+        core_util_atomic_store_u32(&oScanStats.nLastOverrunSlot, nScanSlot);
+    }
+
+    nScanNextDueUs += poScanPlan->nSlotUs;
+    nScanSlotCount++;
+    nScanSlot = (uint16_t)((nScanSlot + 1u) % poScanPlan->nNoOfSlots);
+    core_util_atomic_incr_u32(&oScanStats.nSlots, 1u);
+}
+
+/*!
+    @brief  Read the registers of a measurement
+
+    @param[in]  eMeas     Measurement
+    @param[out] poResult  Placeholder for the data
+    @param[in]  knChainId Daisy chain ID
+
+    @return 0 on success, non-zero otherwise
+*/
+static int Adbms6948_scan_read(BMS_SCAN_MEAS eMeas, BMS_SCAN_RESULT *poResult, const uint8_t knChainId)
+{
+    int nRet;
+
+    switch(eMeas) {
+        case BMS_SCAN_MEAS_CELLS:
+            nRet = Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA,
+                                          ADBMS6948_CELL_GRP_SEL_ALL,
+                                          &poResult->u.anCellVoltage[0],
+                                          ADBMS6948_SEND_NONE,
+                                          knChainId);
+            break;
+        case BMS_SCAN_MEAS_CURRENT:
+            nRet = Adbms6948_ReadCurrent(ADBMS6948_CURRENT_MEAS_DATA,
+                                         ADBMS6948_CURRENT_I1,
+                                         &poResult->u.nCurrent,
+                                         ADBMS6948_SEND_NONE,
+                                         knChainId);
+            break;
+        case BMS_SCAN_MEAS_GPIO:
+            nRet = Adbms6948_ReadGPIOInputVolt(ADBMS6948_GPIO_MEAS_DATA,
+                                               ADBMS6948_GPIO_GRP_ALL,
+                                               &poResult->u.anGpioVoltage[0],
+                                               knChainId);
+            break;
+        case BMS_SCAN_MEAS_OPEN_WIRE:
+            nRet = Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA_REDUNDANT,
+                                          ADBMS6948_CELL_GRP_SEL_ALL,
+                                          &poResult->u.oOpenWire.anCellVoltage[0],
+                                          ADBMS6948_SEND_NONE,
+                                          knChainId);
+            poResult->u.oOpenWire.eOWSel = eScanOwSel;
+            break;
+        case BMS_SCAN_MEAS_CS_CHECK:
+            nRet = Adbms6948_ReadCellVoltCS(&poResult->u.oCrossCheck.anCellVoltage[0],
+                                            &poResult->u.oCrossCheck.anSCellVoltage[0],
+                                            &poResult->u.oCrossCheck.anCSFlt[0],
+                                            ADBMS6948_SEND_NONE,
+                                            knChainId);
+            break;
+        default:
+            nRet = Adbms6948_ReadDevParam(ADBMS6948_DEV_PARAMS_ALL, &poResult->u.anStatVoltage[0], knChainId);
+            break;
+    }
+    return nRet;
+}
+
+/*!
+    @brief  Signal Adbms6948_Scan_Stop() that no slot is in progress
+*/
+static void Adbms6948_scan_release_idle(void)
+{
+    oScanIdle.release();
+}
+
+/*! @}*/
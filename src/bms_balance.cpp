@@ -0,0 +1,112 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_balance.cpp
+ * @brief   Cell balancing policy, see bms_balance.h.
+ *
+ *          A cell starts discharging nStart above the target and stops at
+ *          nStop, the hysteresis keeps cells near a threshold from toggling.
+ *          While discharging, the duty cycle grows linearly with the distance
+ *          to the target and reaches BMS_BAL_DUTY_MAX at nFullDuty.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Balance
+*  @{
+*/
+
+#include <stddef.h>
+#include "bms_balance.h"
+
+/*!
+    @brief  Duty cycle of a discharging cell at a distance to the target
+*/
+static uint8_t BmsBal_lDuty(const BMS_BAL_CFG *poCfg, int32_t nDistance)
+{
+    int32_t nDuty = BMS_BAL_DUTY_MAX;
+
+    if(nDistance < poCfg->nFullDuty) {
+        nDuty = (nDistance * (int32_t)BMS_BAL_DUTY_MAX) / poCfg->nFullDuty;
+    }
+    if(nDuty < 1) {
+        nDuty = 1;
+    }
+    return (uint8_t)nDuty;
+}
+
+/*!
+    @brief  Update the PWM discharge duty cycles from a measurement
+
+    The target is the lowest cell voltage or state of charge among the cells
+    at or above nMinCellCode. Cell voltages measured while cells discharge
+    read low by the drop across the cell's wiring; such a measurement only
+    updates the duty cycles when no cell was discharging, otherwise the duty
+    cycles are kept. Measurements triggered with Adbms6948_bEnSSDP cleared
+    pause the discharge during the conversion and always update. The
+    thresholds of BMS_BAL_TARGET_SOC are states of charge and do not apply to
+    cell codes: without panSoc no cell is discharged.
+
+    @param[in]     poCfg            Balancing policy
+    @param[in]     panCells         Cell codes, BMS_BAL_CELLS_PER_DEVICE per device
+    @param[in]     panSoc           State of charge of every cell in 0.01 %, laid out as
+                                    panCells, for BMS_BAL_TARGET_SOC; NULL if not known
+    @param[in]     nNoOfDevices     Number of devices
+    @param[in]     bDischargePaused 1 if the discharge was paused during the measurement
+    @param[in,out] panDuty          Duty cycles written last, updated in place,
+                                    BMS_BAL_CELLS_PER_DEVICE per device
+
+    @return Number of cells whose duty cycle changed, 0 if nothing needs to be written
+*/
+uint16_t BmsBal_Update(const BMS_BAL_CFG *poCfg, const int16_t *panCells, const int16_t *panSoc,
+                       uint8_t nNoOfDevices, uint8_t bDischargePaused, uint8_t *panDuty)
+{
+    uint16_t nNoOfCells = (uint16_t)nNoOfDevices * BMS_BAL_CELLS_PER_DEVICE;
+    uint16_t nIdx, nChanged = 0u;
+    const int16_t *panMetric = panCells;
+    int32_t nTarget = 0x7FFF, nDistance;
+    uint8_t nDuty, bDischarging = 0u, bHasTarget = 0u, bHasMetric = 1u;
+
+    if(poCfg->eTarget == BMS_BAL_TARGET_SOC) {
+        panMetric = panSoc;
+        bHasMetric = (panSoc != NULL) ? 1u : 0u;
+    }
+    for(nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+        if(panDuty[nIdx] != 0u) {
+            bDischarging = 1u;
+        }
+        if((bHasMetric != 0u) && (panCells[nIdx] >= poCfg->nMinCellCode)) {
+            bHasTarget = 1u;
+            if(panMetric[nIdx] < nTarget) {
+                nTarget = panMetric[nIdx];
+            }
+        }
+    }
+
+    if((bDischargePaused != 0u) || (bDischarging == 0u)) {
+        for(nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+            nDuty = 0u;
+            if((bHasTarget != 0u) && (panCells[nIdx] >= poCfg->nMinCellCode)) {
+                nDistance = (int32_t)panMetric[nIdx] - nTarget;
+                if(((panDuty[nIdx] == 0u) && (nDistance >= poCfg->nStart)) ||
+                   ((panDuty[nIdx] != 0u) && (nDistance > poCfg->nStop))) {
+                    nDuty = BmsBal_lDuty(poCfg, nDistance);
+                }
+            }
+            if(nDuty != panDuty[nIdx]) {
+                panDuty[nIdx] = nDuty;
+                nChanged++;
+            }
+        }
+    }
+    return nChanged;
+}
+
+
+/*! @}*/
@@ -0,0 +1,135 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_charge.cpp
+ * @brief   Charge accounting, see bms_charge.h.
+ *
+ *          Samples are differences of the free running counters, taken
+ *          modulo 2^32 for the coulomb count and modulo 2^16 for the time
+ *          base, so wraps between two samples cost nothing. Two samples must
+ *          be less than 65536 conversions apart, about a minute.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Charge
+*  @{
+*/
+
+#include "bms_charge.h"
+
+/*! Code sum * conversion period [ns] / (shunt [uOhm] * this) is the charge in microampere hours */
+#define BMS_CHG_UAH_DIVISOR             (3600000ll)
+
+/*!
+    @brief  Start the charge accounting
+
+    @param[out] poState         Charge accounting state
+    @param[in]  nSocCentiPct    State of charge at the start, 0.01 %
+*/
+void BmsChg_Init(BMS_CHG_STATE *poState, int16_t nSocCentiPct)
+{
+    poState->nCodeSum = 0;
+    poState->nLastCount = 0u;
+    poState->nLastTimeBase = 0u;
+    poState->bSynced = 0u;
+    poState->nIntervalSum = 0;
+    poState->nIntervalConv = 0u;
+    poState->nConversions = 0u;
+    poState->nRollovers = 0u;
+    poState->nFaults = 0u;
+    poState->nInitialSoc = nSocCentiPct;
+}
+
+/*!
+    @brief  Add a sample of the coulomb counter
+
+    The first sample, and the first one after a fault, is only taken as the
+    reference of the next sample. A coulomb counter fault or sequence error
+    discards the charge since the last sample; clear the flags and the
+    counter on the device after such a sample, the next sample restarts the
+    accounting. A time base fault flags the wrap of the time base, which the
+    modulo differences already cover, so the sample is used.
+
+    @param[in,out] poState      Charge accounting state
+    @param[in]     nCount       Coulomb count read from the device
+    @param[in]     nTimeBase    Time base read from the device
+    @param[in]     nFaults      BMS_CHG_FLT_* flags read with the sample
+
+    @return 1 if the sample added to the charge, 0 otherwise
+*/
+uint8_t BmsChg_Update(BMS_CHG_STATE *poState, uint32_t nCount, uint16_t nTimeBase, uint8_t nFaults)
+{
+    uint16_t nConv = (uint16_t)(nTimeBase - poState->nLastTimeBase);
+    int32_t nSum = (int32_t)(nCount - poState->nLastCount);
+    uint8_t bAdded = 0u;
+
+    if((nFaults & (BMS_CHG_FLT_COUNT | BMS_CHG_FLT_SEQUENCE)) != 0u) {
+        poState->nFaults++;
+        poState->bSynced = 0u;
+    } else {
+        if(poState->bSynced != 0u) {
+            if((nTimeBase < poState->nLastTimeBase) || ((nFaults & BMS_CHG_FLT_TIMEBASE) != 0u)) {
+                poState->nRollovers++;
+            }
+            poState->nCodeSum += nSum;
+            poState->nIntervalSum = nSum;
+            poState->nIntervalConv = nConv;
+            poState->nConversions += nConv;
+            bAdded = 1u;
+        }
+        poState->nLastCount = nCount;
+        poState->nLastTimeBase = nTimeBase;
+        poState->bSynced = 1u;
+    }
+    return bAdded;
+}
+
+/*!
+    @brief  Charge accumulated since BmsChg_Init
+
+    The code sum is divided in two steps so that the 64-bit products do not
+    overflow for shunts up to 1 ohm and conversion periods up to 2 ms.
+
+    @param[in]  poCfg   Charge accounting parameters
+    @param[in]  poState Charge accounting state
+
+    @return Charge in microampere hours
+*/
+int64_t BmsChg_GetMicroAh(const BMS_CHG_CFG *poCfg, const BMS_CHG_STATE *poState)
+{
+    int64_t nDivisor = BMS_CHG_UAH_DIVISOR * (int64_t)poCfg->nShuntMicroOhm;
+    int64_t nQuot = poState->nCodeSum / nDivisor;
+    int64_t nRem = poState->nCodeSum % nDivisor;
+
+    return (nQuot * (int64_t)poCfg->nConvPeriodNs) + ((nRem * (int64_t)poCfg->nConvPeriodNs) / nDivisor);
+}
+
+/*!
+    @brief  State of charge from the initial state of charge and the charge since
+
+    @param[in]  poCfg   Charge accounting parameters
+    @param[in]  poState Charge accounting state
+
+    @return State of charge in 0.01 %, 0 to BMS_CHG_SOC_FULL
+*/
+int16_t BmsChg_GetSocCentiPct(const BMS_CHG_CFG *poCfg, const BMS_CHG_STATE *poState)
+{
+    int64_t nSoc = poState->nInitialSoc + ((BmsChg_GetMicroAh(poCfg, poState) * 10) / (int64_t)poCfg->nCapacityMilliAh);
+
+    if(nSoc > BMS_CHG_SOC_FULL) {
+        nSoc = BMS_CHG_SOC_FULL;
+    } else if(nSoc < 0) {
+        nSoc = 0;
+    }
+    return (int16_t)nSoc;
+}
+
+
+/*! @}*/
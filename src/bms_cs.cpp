@@ -0,0 +1,106 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_cs.cpp
+ * @brief   Redundant cell voltage cross check, see bms_cs.h.
+ *
+ *          The flags of the devices latch every redundant conversion since
+ *          the last read while the software compares the one conversion that
+ *          was read, so either may see a mismatch the other misses; both
+ *          count as disagreement for the diagnostic and the class keeps the
+ *          difference. A cleared result register, 0x8000, differs from any
+ *          conversion, so a channel that stopped converting disagrees too.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Cs
+*  @{
+*/
+
+#include "bms_cs.h"
+
+/*!
+    @brief  Start the cross check, every cell agreeing and clear
+
+    @param[out] poState     Cross check state
+    @param[in]  nNoOfCells  Cells to check, up to BMS_CS_MAX_CELLS
+*/
+void BmsCs_Init(BMS_CS_STATE *poState, uint16_t nNoOfCells)
+{
+    uint16_t nIdx;
+
+    if(nNoOfCells > BMS_CS_MAX_CELLS) {
+        nNoOfCells = BMS_CS_MAX_CELLS;
+    }
+    poState->nNoOfCells = nNoOfCells;
+    poState->nRaised = 0u;
+    poState->nScans = 0u;
+    for(nIdx = 0u; nIdx < BMS_CS_NO_OF_CLASSES; nIdx++) {
+        poState->anClassCells[nIdx] = 0u;
+    }
+    for(nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+        poState->anClass[nIdx] = BMS_CS_AGREE;
+        poState->anRun[nIdx] = 0u;
+        poState->abRaised[nIdx] = 0u;
+    }
+}
+
+/*!
+    @brief  Add the results of a scan
+
+    @param[in]     poCfg     Cross check parameters
+    @param[in,out] poState   Cross check state
+    @param[in]     panCellC  C-ADC cell codes, nNoOfCells of BmsCs_Init
+    @param[in]     panCellS  S-ADC cell codes of the same read
+    @param[in]     panCSFlt  C vs S fault flags of every device, bit n for cell n + 1
+
+    @return Cells with the diagnostic raised
+*/
+uint16_t BmsCs_Update(const BMS_CS_CFG *poCfg, BMS_CS_STATE *poState, const int16_t *panCellC,
+                      const int16_t *panCellS, const uint16_t *panCSFlt)
+{
+    int32_t nDelta;
+    uint8_t nClass, nLimit;
+    bool bDisagree;
+    uint16_t nIdx;
+
+    for(nIdx = 0u; nIdx < BMS_CS_NO_OF_CLASSES; nIdx++) {
+        poState->anClassCells[nIdx] = 0u;
+    }
+
+    for(nIdx = 0u; nIdx < poState->nNoOfCells; nIdx++) {
+        nDelta = (int32_t)panCellC[nIdx] - (int32_t)panCellS[nIdx];
+        nClass = (((nDelta < 0) ? -nDelta : nDelta) > poCfg->nMaxDelta) ? BMS_CS_SW_ONLY : BMS_CS_AGREE;
+        if((panCSFlt[nIdx / BMS_CS_CELLS_PER_DEVICE] & (1u << (nIdx % BMS_CS_CELLS_PER_DEVICE))) != 0u) {
+            nClass |= BMS_CS_CHIP_ONLY;
+        }
+        poState->anClass[nIdx] = nClass;
+        poState->anClassCells[nClass]++;
+
+        /* Count the scans against the current state of the diagnostic, any other scan restarts the count */
+        bDisagree = (nClass != BMS_CS_AGREE);
+        nLimit = (poState->abRaised[nIdx] != 0u) ? poCfg->nClear : poCfg->nRaise;
+        if(bDisagree == (poState->abRaised[nIdx] == 0u)) {
+            poState->anRun[nIdx]++;
+            if(poState->anRun[nIdx] >= nLimit) {
+                poState->abRaised[nIdx] = bDisagree ? 1u : 0u;
+                poState->anRun[nIdx] = 0u;
+                poState->nRaised = (uint16_t)(bDisagree ? (poState->nRaised + 1u) : (poState->nRaised - 1u));
+            }
+        } else {
+            poState->anRun[nIdx] = 0u;
+        }
+    }
+    poState->nScans++;
+    return poState->nRaised;
+}
+
+
+/*! @}*/
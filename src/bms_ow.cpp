@@ -0,0 +1,130 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_ow.cpp
+ * @brief   Open wire verdicts, see bms_ow.h.
+ *
+ *          An open wire Cn pulled by its switch moves both cell n and cell
+ *          n + 1, so a pass is only attributed to the wires it switched:
+ *          the odd pass updates cells 1, 3, ..., the even pass cells 2, 4,
+ *          ... A pass costs one step per switched wire and the verdicts are
+ *          read from the evidence without further state.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Ow
+*  @{
+*/
+
+#include <stddef.h>
+#include "bms_ow.h"
+
+/*!
+    @brief  Start the accumulation, every wire undecided
+
+    @param[out] poState     Open wire state
+    @param[in]  nNoOfCells  Cells to evaluate, up to BMS_OW_MAX_CELLS
+*/
+void BmsOw_Init(BMS_OW_STATE *poState, uint16_t nNoOfCells)
+{
+    uint16_t nIdx;
+
+    if(nNoOfCells > BMS_OW_MAX_CELLS) {
+        nNoOfCells = BMS_OW_MAX_CELLS;
+    }
+    poState->nNoOfCells = nNoOfCells;
+    poState->anPasses[BMS_OW_PASS_EVEN] = 0u;
+    poState->anPasses[BMS_OW_PASS_ODD] = 0u;
+    for(nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+        poState->anEvidence[nIdx] = 0;
+    }
+}
+
+/*!
+    @brief  Add the evaluation of an open wire pass
+
+    An open or closed evaluation moves the evidence of the wire one step
+    towards its verdict; an undecided evaluation moves it one step back
+    towards undecided, so a wire flickering between the thresholds loses its
+    verdict instead of keeping a stale one.
+
+    @param[in]     poCfg     Accumulation parameters
+    @param[in,out] poState   Open wire state
+    @param[in]     panStatus BMS_OW_* status of every cell from Adbms6948_CellOWDiag
+    @param[in]     nPass     BMS_OW_PASS_* switches of the pass
+*/
+void BmsOw_Update(const BMS_OW_CFG *poCfg, BMS_OW_STATE *poState, const uint8_t *panStatus, uint8_t nPass)
+{
+    int8_t nLimit = (int8_t)poCfg->nConfirm;
+    int8_t nEvidence;
+    uint16_t nIdx;
+
+    /* Index 0 is cell 1, the wire C1 of the odd pass */
+    for(nIdx = (nPass == BMS_OW_PASS_ODD) ? 0u : 1u; nIdx < poState->nNoOfCells; nIdx += 2u) {
+        nEvidence = poState->anEvidence[nIdx];
+        if(panStatus[nIdx] == BMS_OW_OPEN) {
+            nEvidence = (nEvidence < nLimit) ? (int8_t)(nEvidence + 1) : nLimit;
+        } else if(panStatus[nIdx] == BMS_OW_CLOSED) {
+            nEvidence = (nEvidence > -nLimit) ? (int8_t)(nEvidence - 1) : (int8_t)(-nLimit);
+        } else {
+            nEvidence = (int8_t)(nEvidence - ((nEvidence > 0) ? 1 : 0) + ((nEvidence < 0) ? 1 : 0));
+        }
+        poState->anEvidence[nIdx] = nEvidence;
+    }
+    poState->anPasses[(nPass == BMS_OW_PASS_ODD) ? BMS_OW_PASS_ODD : BMS_OW_PASS_EVEN]++;
+}
+
+/*!
+    @brief  Verdict and confidence of every wire
+
+    The confidence is the evidence towards the current tendency over the
+    evidence needed for a verdict, 100 % for a decided wire.
+
+    @param[in]  poCfg            Accumulation parameters
+    @param[in]  poState          Open wire state
+    @param[out] panVerdict       Placeholder for the BMS_OW_* verdict of every cell, NULL if not needed
+    @param[out] panConfidencePct Placeholder for the confidence of every cell, 0 to 100, NULL if not needed
+    @param[out] pnDecided        Placeholder for the wires with a verdict, the coverage of the pack
+
+    @return Wires reported open
+*/
+uint16_t BmsOw_GetVerdicts(const BMS_OW_CFG *poCfg, const BMS_OW_STATE *poState, uint8_t *panVerdict,
+                           uint8_t *panConfidencePct, uint16_t *pnDecided)
+{
+    int8_t nLimit = (int8_t)poCfg->nConfirm;
+    int8_t nEvidence;
+    uint8_t nVerdict;
+    uint16_t nIdx, nOpen = 0u, nDecided = 0u;
+
+    for(nIdx = 0u; nIdx < poState->nNoOfCells; nIdx++) {
+        nEvidence = poState->anEvidence[nIdx];
+        if(nEvidence >= nLimit) {
+            nVerdict = BMS_OW_OPEN;
+            nOpen++;
+            nDecided++;
+        } else if(nEvidence <= -nLimit) {
+            nVerdict = BMS_OW_CLOSED;
+            nDecided++;
+        } else {
+            nVerdict = BMS_OW_UNDECIDED;
+        }
+        if(panVerdict != NULL) {
+            panVerdict[nIdx] = nVerdict;
+        }
+        if(panConfidencePct != NULL) {
+            panConfidencePct[nIdx] = (uint8_t)((((nEvidence < 0) ? -nEvidence : nEvidence) * 100) / nLimit);
+        }
+    }
+    *pnDecided = nDecided;
+    return nOpen;
+}
+
+
+/*! @}*/
@@ -0,0 +1,222 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_protect.cpp
+ * @brief   Cell voltage protection evaluator, see bms_protect.h.
+ *
+ *          On the Cortex-M4 a pair of cells is loaded as one word: SSUB16
+ *          compares both halves against the packed thresholds and running
+ *          extremes in its GE flags, SEL turns the flags into the OV/UV masks
+ *          and the new minimum and maximum, and SMLAD adds both cells to the
+ *          sum. SSUB16 and SEL are issued together in one asm statement, as
+ *          nothing would tie a discarded SSUB16 intrinsic to the SEL reading
+ *          its flags. An odd last cell of a device goes through the portable
+ *          path. BMS_PROT_SIMD_MODEL builds the pair path on other targets
+ *          with a C model of the instructions, so it can be checked on the
+ *          host against the portable path.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Protect
+*  @{
+*/
+
+#include <string.h>
+#include "bms_protect.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "cmsis_compiler.h"
+#define BMS_PROT_SIMD
+#elif defined(BMS_PROT_SIMD_MODEL)
+#define BMS_PROT_SIMD
+#endif
+
+#define BMS_PROT_INT16_MAX      (32767)
+#define BMS_PROT_INT16_MIN      (-32768)
+
+/*!
+    @brief  Saturate a 32-bit value to a cell code
+*/
+static int16_t BmsProt_lSat16(int32_t nValue)
+{
+    if(nValue > BMS_PROT_INT16_MAX) {
+        nValue = BMS_PROT_INT16_MAX;
+    } else if(nValue < BMS_PROT_INT16_MIN) {
+        nValue = BMS_PROT_INT16_MIN;
+    }
+    return (int16_t)nValue;
+}
+
+#ifdef BMS_PROT_SIMD
+/*!
+    @brief  Pack a code into both halves of a word
+*/
+static uint32_t BmsProt_lPack(int16_t nCode)
+{
+    return ((uint32_t)(uint16_t)nCode << 16) | (uint32_t)(uint16_t)nCode;
+}
+
+/*!
+    @brief  Select per halfword: nGe where the signed halfword of nA is not
+            lower than the one of nB, nLt otherwise (SSUB16 then SEL)
+*/
+static uint32_t BmsProt_lSelGe(uint32_t nA, uint32_t nB, uint32_t nGe, uint32_t nLt)
+{
+    uint32_t nRes;
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    /* The difference is discarded, only its GE flags feed SEL */
+    __ASM ("ssub16 %0, %1, %2\n\t"
+           "sel    %0, %3, %4"
+           : "=&r" (nRes)
+           : "r" (nA), "r" (nB), "r" (nGe), "r" (nLt)
+           : "cc");
+#else
+    /* GE of a halfword is set where its difference, taken without overflow, is not negative */
+    nRes = (((int32_t)(int16_t)(uint16_t)nA - (int32_t)(int16_t)(uint16_t)nB) >= 0) ? (nGe & 0x0000FFFFu) : (nLt & 0x0000FFFFu);
+    nRes |= (((int32_t)(int16_t)(uint16_t)(nA >> 16) - (int32_t)(int16_t)(uint16_t)(nB >> 16)) >= 0) ?
+            (nGe & 0xFFFF0000u) : (nLt & 0xFFFF0000u);
+#endif
+    return nRes;
+}
+
+/*!
+    @brief  Add both signed halfwords of a pair to a sum (SMLAD with 1, 1)
+*/
+static int32_t BmsProt_lAddPair(uint32_t nPair, int32_t nSum)
+{
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    return (int32_t)__SMLAD(nPair, 0x00010001u, (uint32_t)nSum);
+#else
+    return nSum + (int32_t)(int16_t)(uint16_t)nPair + (int32_t)(int16_t)(uint16_t)(nPair >> 16);
+#endif
+}
+#endif
+
+/*!
+    @brief  Evaluate the cells of a chain against the protection limits
+
+    The cells are laid out device after device, nCellsPerDevice codes each,
+    as returned by the "read all" cell voltage commands. Bit n of the OV/UV
+    bitmap of a device stands for its cell n+1. Thresholds are cell codes,
+    convert voltages with BMS_UNITS_UV_TO_CODE. The bitmaps, the minimum,
+    maximum and sum are taken in a single pass over the cells; the deviations
+    from the mean need the mean and are written in a second pass, which also
+    locates the minimum and maximum cell.
+
+    @param[in]  panCells        Cell codes, nNoOfDevices * nCellsPerDevice
+    @param[in]  nNoOfDevices    Number of devices
+    @param[in]  nCellsPerDevice Cells per device, 1 to BMS_PROT_MAX_CELLS_PER_DEVICE
+    @param[in]  poLimits        Protection limits
+    @param[out] panOvMask       Placeholder for the OV bitmap of every device
+    @param[out] panUvMask       Placeholder for the UV bitmap of every device
+    @param[out] panDelta        Placeholder for the deviation of every cell from the mean,
+                                saturated to 16 bits, NULL when not needed
+    @param[out] poSummary       Placeholder for the extremes, the mean and the number of
+                                flagged cells
+*/
+void BmsProt_EvalCells(const int16_t *panCells, uint8_t nNoOfDevices, uint8_t nCellsPerDevice,
+                       const BMS_PROT_LIMITS *poLimits, uint16_t *panOvMask, uint16_t *panUvMask,
+                       int16_t *panDelta, BMS_PROT_SUMMARY *poSummary)
+{
+    const int16_t *pnDevCells;
+    uint16_t nNoOfCells = (uint16_t)nNoOfDevices * nCellsPerDevice;
+    uint16_t nOvMask, nUvMask, nOvCells = 0u, nUvCells = 0u;
+    uint16_t nDev, nCell, nIdx;
+    int32_t nSum = 0;
+    int16_t nMin = BMS_PROT_INT16_MAX, nMax = BMS_PROT_INT16_MIN, nCode, nAvg;
+#ifdef BMS_PROT_SIMD
+    uint32_t nPair, nMask;
+    uint32_t nOvPair = BmsProt_lPack(poLimits->nOvCode);
+    uint32_t nUvPair = BmsProt_lPack(poLimits->nUvCode);
+    uint32_t nMinPair = BmsProt_lPack(BMS_PROT_INT16_MAX);
+    uint32_t nMaxPair = BmsProt_lPack(BMS_PROT_INT16_MIN);
+#endif
+
+    for(nDev = 0u; nDev < nNoOfDevices; nDev++) {
+        pnDevCells = &panCells[nDev * nCellsPerDevice];
+        nOvMask = 0u;
+        nUvMask = 0u;
+        nCell = 0u;
+#ifdef BMS_PROT_SIMD
+        for(; (nCell + 1u) < nCellsPerDevice; nCell += 2u) {
+            memcpy(&nPair, &pnDevCells[nCell], sizeof(nPair));
+            /* All ones where cell > OV threshold */
+            nMask = BmsProt_lSelGe(nOvPair, nPair, 0u, 0xFFFFFFFFu);
+            nOvMask |= (uint16_t)(((nMask & 1u) | ((nMask >> 15) & 2u)) << nCell);
+            /* All ones where cell < UV threshold */
+            nMask = BmsProt_lSelGe(nPair, nUvPair, 0u, 0xFFFFFFFFu);
+            nUvMask |= (uint16_t)(((nMask & 1u) | ((nMask >> 15) & 2u)) << nCell);
+            nMaxPair = BmsProt_lSelGe(nPair, nMaxPair, nPair, nMaxPair);
+            nMinPair = BmsProt_lSelGe(nPair, nMinPair, nMinPair, nPair);
+            nSum = BmsProt_lAddPair(nPair, nSum);
+        }
+#endif
+        for(; nCell < nCellsPerDevice; nCell++) {
+            nCode = pnDevCells[nCell];
+            if(nCode > poLimits->nOvCode) {
+                nOvMask |= (uint16_t)(1u << nCell);
+            }
+            if(nCode < poLimits->nUvCode) {
+                nUvMask |= (uint16_t)(1u << nCell);
+            }
+            if(nCode > nMax) {
+                nMax = nCode;
+            }
+            if(nCode < nMin) {
+                nMin = nCode;
+            }
+            nSum += nCode;
+        }
+        panOvMask[nDev] = nOvMask;
+        panUvMask[nDev] = nUvMask;
+        for(; nOvMask != 0u; nOvMask &= (uint16_t)(nOvMask - 1u)) {
+            nOvCells++;
+        }
+        for(; nUvMask != 0u; nUvMask &= (uint16_t)(nUvMask - 1u)) {
+            nUvCells++;
+        }
+    }
+#ifdef BMS_PROT_SIMD
+    for(nIdx = 0u; nIdx < 2u; nIdx++) {
+        nCode = (int16_t)(uint16_t)(nMaxPair >> (16u * nIdx));
+        if(nCode > nMax) {
+            nMax = nCode;
+        }
+        nCode = (int16_t)(uint16_t)(nMinPair >> (16u * nIdx));
+        if(nCode < nMin) {
+            nMin = nCode;
+        }
+    }
+#endif
+
+    nAvg = (nNoOfCells > 0u) ? (int16_t)(nSum / (int32_t)nNoOfCells) : 0;
+    poSummary->nMinCode = nMin;
+    poSummary->nMaxCode = nMax;
+    poSummary->nAvgCode = nAvg;
+    poSummary->nMinCell = 0u;
+    poSummary->nMaxCell = 0u;
+    poSummary->nOvCells = nOvCells;
+    poSummary->nUvCells = nUvCells;
+    for(nIdx = nNoOfCells; nIdx > 0u; nIdx--) {
+        nCode = panCells[nIdx - 1u];
+        if(nCode == nMin) {
+            poSummary->nMinCell = nIdx - 1u;
+        }
+        if(nCode == nMax) {
+            poSummary->nMaxCell = nIdx - 1u;
+        }
+        if(panDelta != NULL) {
+            panDelta[nIdx - 1u] = BmsProt_lSat16((int32_t)nCode - nAvg);
+        }
+    }
+}
+
+
+/*! @}*/
@@ -0,0 +1,176 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_soc.cpp
+ * @brief   State of charge estimator, see bms_soc.h.
+ *
+ *          The states are x = [SOC, Vrc], with
+ *              SOC' = SOC + eta * I * dt / (3600 * Q)
+ *              Vrc' = a * Vrc + R1 * (1 - a) * I,   a = exp(-dt / tau1)
+ *              V    = OCV(SOC) + Vrc + R0 * I
+ *          The Jacobian of the prediction is diag(1, a) and the one of the
+ *          measurement [dOCV/dSOC, 1], so the 2x2 covariance is updated in
+ *          closed form. Everything that depends on the current and the time
+ *          step only is computed once per update, outside the cell loop.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Soc
+*  @{
+*/
+
+#include <math.h>
+#include "bms_soc.h"
+#include "bms_units.h"
+
+/*! Initial variance of the RC pair voltage, the cells are assumed at rest */
+#define BMS_SOC_INIT_VAR_VRC    (1e-6f)
+/*! Weight of a cell code, volts */
+#define BMS_SOC_CODE_V          ((float)BMS_UNITS_ADC_LSB_UV * 1e-6f)
+/*! Voltage of cell code 0, volts */
+#define BMS_SOC_OFFSET_V        ((float)BMS_UNITS_ADC_OFFSET_UV * 1e-6f)
+
+/*!
+    @brief  State of charge of a cell at rest from its open circuit voltage
+*/
+static float BmsSoc_lSocFromOcv(const BMS_SOC_CFG *poCfg, float fVolt)
+{
+    float fSoc = 0.0f, fLow, fHigh;
+    uint8_t nIdx;
+
+    if(fVolt >= ((float)poCfg->panOcvUv[poCfg->nOcvPoints - 1u] * 1e-6f)) {
+        fSoc = 1.0f;
+    } else {
+        for(nIdx = 0u; (nIdx + 1u) < poCfg->nOcvPoints; nIdx++) {
+            fLow = (float)poCfg->panOcvUv[nIdx] * 1e-6f;
+            fHigh = (float)poCfg->panOcvUv[nIdx + 1u] * 1e-6f;
+            if((fVolt >= fLow) && (fVolt < fHigh)) {
+                fSoc = ((float)nIdx + ((fVolt - fLow) / (fHigh - fLow))) / (float)(poCfg->nOcvPoints - 1u);
+            }
+        }
+    }
+    return fSoc;
+}
+
+/*!
+    @brief  Start the estimation from cells at rest
+
+    The state of charge of every cell is taken from the open circuit voltage
+    table, so the cells should have rested before; the filter corrects a
+    wrong start within fInitVarSoc.
+
+    @param[in]  poCfg       Cell model and filter tuning
+    @param[out] poState     Filter state
+    @param[in]  panCells    Cell codes of the cells at rest
+    @param[in]  nNoOfCells  Cells to estimate, up to BMS_SOC_MAX_CELLS
+*/
+void BmsSoc_Init(const BMS_SOC_CFG *poCfg, BMS_SOC_STATE *poState, const int16_t *panCells, uint16_t nNoOfCells)
+{
+    uint16_t nIdx;
+
+    if(nNoOfCells > BMS_SOC_MAX_CELLS) {
+        nNoOfCells = BMS_SOC_MAX_CELLS;
+    }
+    poState->nNoOfCells = nNoOfCells;
+    poState->nUpdates = 0u;
+    for(nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+        poState->afSoc[nIdx] = BmsSoc_lSocFromOcv(poCfg, ((float)panCells[nIdx] * BMS_SOC_CODE_V) + BMS_SOC_OFFSET_V);
+        poState->afVrc[nIdx] = 0.0f;
+        poState->afP00[nIdx] = poCfg->fInitVarSoc;
+        poState->afP01[nIdx] = 0.0f;
+        poState->afP11[nIdx] = BMS_SOC_INIT_VAR_VRC;
+        poState->afHealth[nIdx] = 1.0f;
+    }
+}
+
+/*!
+    @brief  Predict and correct the state of charge of every cell
+
+    All the cells carry the same current, e.g. a series string measured with
+    Adbms6948_ReadCellVoltCurrentAverage, whose averages are aligned in time
+    with the current.
+
+    @param[in]     poCfg        Cell model and filter tuning
+    @param[in,out] poState      Filter state
+    @param[in]     panCells     Cell codes, nNoOfCells of BmsSoc_Init
+    @param[in]     fCurrentA    Current over the time step, amperes, positive while charging
+    @param[in]     fDtS         Time step since the last update, seconds
+*/
+void BmsSoc_Update(const BMS_SOC_CFG *poCfg, BMS_SOC_STATE *poState, const int16_t *panCells,
+                   float fCurrentA, float fDtS)
+{
+    const int32_t *panOcvUv = poCfg->panOcvUv;
+    const float fSegments = (float)(poCfg->nOcvPoints - 1u);
+    const int32_t nLastSeg = (int32_t)poCfg->nOcvPoints - 2;
+    const float fA = expf(-fDtS / poCfg->fTau1);
+    const float fVrcIn = poCfg->fR1 * (1.0f - fA) * fCurrentA;
+    const float fCharge = ((fCurrentA > 0.0f) ? poCfg->fChargeEfficiency : 1.0f) * fCurrentA * fDtS /
+                          (3600.0f * poCfg->fCapacityAh);
+    const float fR0Drop = poCfg->fR0 * fCurrentA;
+    const float fQSoc = poCfg->fProcNoiseSoc * fDtS;
+    const float fQVrc = poCfg->fProcNoiseVrc * fDtS;
+    const float fR = poCfg->fMeasNoise;
+    const float fA2 = fA * fA;
+    float fSoc, fVrc, fP00, fP01, fP11, fPos, fFrac, fOcvLow, fSlope, fErr, fPh0, fPh1, fInvS, fK0, fK1;
+    int32_t nSeg;
+    uint16_t nIdx;
+
+    for(nIdx = 0u; nIdx < poState->nNoOfCells; nIdx++) {
+        /* Predict */
+        fSoc = poState->afSoc[nIdx] + (fCharge / poState->afHealth[nIdx]);
+        fVrc = (fA * poState->afVrc[nIdx]) + fVrcIn;
+        fP00 = poState->afP00[nIdx] + fQSoc;
+        fP01 = fA * poState->afP01[nIdx];
+        fP11 = (fA2 * poState->afP11[nIdx]) + fQVrc;
+
+        /* Open circuit voltage and its slope, extrapolated beyond the table */
+        fPos = fSoc * fSegments;
+        nSeg = (int32_t)fPos;
+        nSeg = (nSeg < 0) ? 0 : ((nSeg > nLastSeg) ? nLastSeg : nSeg);
+        fFrac = fPos - (float)nSeg;
+        fOcvLow = (float)panOcvUv[nSeg] * 1e-6f;
+        fSlope = ((float)panOcvUv[nSeg + 1] * 1e-6f) - fOcvLow;
+
+        /* Correct with the measured cell voltage */
+        fErr = (((float)panCells[nIdx] * BMS_SOC_CODE_V) + BMS_SOC_OFFSET_V) -
+               (fOcvLow + (fSlope * fFrac) + fVrc + fR0Drop);
+        fSlope *= fSegments;
+        fPh0 = (fSlope * fP00) + fP01;
+        fPh1 = (fSlope * fP01) + fP11;
+        fInvS = 1.0f / ((fSlope * fPh0) + fPh1 + fR);
+        fK0 = fPh0 * fInvS;
+        fK1 = fPh1 * fInvS;
+        fSoc += fK0 * fErr;
+        poState->afSoc[nIdx] = (fSoc < 0.0f) ? 0.0f : ((fSoc > 1.0f) ? 1.0f : fSoc);
+        poState->afVrc[nIdx] = fVrc + (fK1 * fErr);
+        poState->afP00[nIdx] = fP00 - (fK0 * fPh0);
+        poState->afP01[nIdx] = fP01 - (fK0 * fPh1);
+        poState->afP11[nIdx] = fP11 - (fK1 * fPh1);
+    }
+    poState->nUpdates++;
+}
+
+/*!
+    @brief  State of charge of every cell in 0.01 %, e.g. for BmsBal_Update
+
+    @param[in]  poState Filter state
+    @param[out] panSoc  Placeholder for the state of charge of every cell, 0 to 10000
+*/
+void BmsSoc_GetSocCentiPct(const BMS_SOC_STATE *poState, int16_t *panSoc)
+{
+    uint16_t nIdx;
+
+    for(nIdx = 0u; nIdx < poState->nNoOfCells; nIdx++) {
+        panSoc[nIdx] = (int16_t)((poState->afSoc[nIdx] * 10000.0f) + 0.5f);
+    }
+}
+
+
+/*! @}*/
@@ -0,0 +1,304 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_telemetry.cpp
+ * @brief   Binary telemetry codec, see bms_telemetry.h for the framing.
+ *
+ *          Sample message (schema 1), after the version and type bytes:
+ *            u32 sequence, u64 timestamp [us], u16 voltage CT, u16 current CT,
+ *            s32 current code, u8 number of cells, s16 cell code[number].
+ *          Stats message (schema 1), after the version and type bytes:
+ *            u32 samples, u32 overruns, u32 read errors, u32 max lateness [us].
+ *          Every message ends with the CRC-16/CCITT-FALSE of the bytes before.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Telemetry
+*  @{
+*/
+
+#include <string.h>
+#include "bms_telemetry.h"
+
+/*! Length of the fixed part of a sample message, before the cell codes */
+#define BMS_TLM_SAMPLE_FIXED_LEN    (BMS_TLM_HDR_LEN + 21u)
+/*! Length of a stats message without the CRC */
+#define BMS_TLM_STATS_LEN           (BMS_TLM_HDR_LEN + 16u)
+
+static uint16_t BmsTlm_PutLE(uint8_t *pBuf, uint16_t nIdx, uint64_t nVal, uint8_t nBytes);
+static uint64_t BmsTlm_GetLE(const uint8_t *pBuf, uint16_t nIdx, uint8_t nBytes);
+static uint16_t BmsTlm_Frame(uint8_t *pMsg, uint16_t nLen, uint8_t *pFrame);
+static uint16_t BmsTlm_CobsEncode(const uint8_t *pSrc, uint16_t nLen, uint8_t *pDst);
+static int BmsTlm_CobsDecode(const uint8_t *pSrc, uint16_t nLen, uint8_t *pDst, uint16_t nDstSize);
+static int BmsTlm_ParseMsg(const uint8_t *pMsg, uint16_t nLen, BMS_TLM_MSG *poMsg);
+
+/*!
+    @brief  Encode a sample message into a frame
+
+    @param[in]  poSample Sample to encode
+    @param[out] pFrame   Placeholder for the frame, BMS_TLM_MAX_FRAME_LEN bytes
+
+    @return Length of the frame including the delimiter
+*/
+uint16_t BmsTlm_EncodeSample(const BMS_TLM_SAMPLE *poSample, uint8_t *pFrame)
+{
+    uint8_t anMsg[BMS_TLM_MAX_MSG_LEN];
+    uint16_t nIdx = 0u;
+    uint8_t nNoOfCells = (poSample->nNoOfCells > BMS_TLM_MAX_CELLS) ? BMS_TLM_MAX_CELLS : poSample->nNoOfCells;
+
+    anMsg[nIdx++] = BMS_TLM_SCHEMA_VERSION;
+    anMsg[nIdx++] = BMS_TLM_MSG_SAMPLE;
+    nIdx = BmsTlm_PutLE(anMsg, nIdx, poSample->nSeqNum, 4u);
+    nIdx = BmsTlm_PutLE(anMsg, nIdx, poSample->nTimestampUs, 8u);
+    nIdx = BmsTlm_PutLE(anMsg, nIdx, poSample->nVoltageCT, 2u);
+    nIdx = BmsTlm_PutLE(anMsg, nIdx, poSample->nCurrentCT, 2u);
+    nIdx = BmsTlm_PutLE(anMsg, nIdx, (uint32_t)poSample->nCurrent, 4u);
+    anMsg[nIdx++] = nNoOfCells;
+    for(uint8_t nCell = 0u; nCell < nNoOfCells; nCell++) {
+        nIdx = BmsTlm_PutLE(anMsg, nIdx, (uint16_t)poSample->anCellVoltage[nCell], 2u);
+    }
+    return BmsTlm_Frame(anMsg, nIdx, pFrame);
+}
+
+/*!
+    @brief  Encode a stats message into a frame
+
+    @param[in]  poStats Statistics to encode
+    @param[out] pFrame  Placeholder for the frame, BMS_TLM_MAX_FRAME_LEN bytes
+
+    @return Length of the frame including the delimiter
+*/
+uint16_t BmsTlm_EncodeStats(const BMS_TLM_STATS *poStats, uint8_t *pFrame)
+{
+    uint8_t anMsg[BMS_TLM_MAX_MSG_LEN];
+    uint16_t nIdx = 0u;
+
+    anMsg[nIdx++] = BMS_TLM_SCHEMA_VERSION;
+    anMsg[nIdx++] = BMS_TLM_MSG_STATS;
+    nIdx = BmsTlm_PutLE(anMsg, nIdx, poStats->nSamples, 4u);
+    nIdx = BmsTlm_PutLE(anMsg, nIdx, poStats->nOverruns, 4u);
+    nIdx = BmsTlm_PutLE(anMsg, nIdx, poStats->nReadErrors, 4u);
+    nIdx = BmsTlm_PutLE(anMsg, nIdx, poStats->nMaxLatenessUs, 4u);
+    return BmsTlm_Frame(anMsg, nIdx, pFrame);
+}
+
+/*!
+    @brief  Calculate the CRC-16/CCITT-FALSE (polynomial 0x1021, seed 0xFFFF)
+
+    @param[in]  pData Data to protect
+    @param[in]  nLen  Number of bytes
+
+    @return CRC of the data
+*/
+uint16_t BmsTlm_Crc16(const uint8_t *pData, uint16_t nLen)
+{
+    uint16_t nCrc = 0xFFFFu;
+
+    for(uint16_t nIdx = 0u; nIdx < nLen; nIdx++) {
+        nCrc ^= (uint16_t)((uint16_t)pData[nIdx] << 8u);
+        for(uint8_t nBit = 0u; nBit < 8u; nBit++) {
+            nCrc = ((nCrc & 0x8000u) != 0u) ? (uint16_t)((nCrc << 1u) ^ 0x1021u) : (uint16_t)(nCrc << 1u);
+        }
+    }
+    return nCrc;
+}
+
+/*!
+    @brief  Reset a stream decoder
+
+    @param[out] poDec Decoder to reset
+*/
+void BmsTlm_DecoderInit(BMS_TLM_DECODER *poDec)
+{
+    memset(poDec, 0, sizeof(BMS_TLM_DECODER));
+}
+
+/*!
+    @brief  Feed one received byte to a stream decoder
+
+    Bytes up to the zero delimiter are collected; the frame is then COBS
+    decoded, its CRC checked and the message parsed. A stream captured in the
+    middle of a frame resynchronizes on the next delimiter.
+
+    @param[in,out] poDec  Decoder state
+    @param[in]     nByte  Received byte
+    @param[out]    poMsg  Placeholder for the message
+
+    @return BMS_TLM_DEC_MSG, BMS_TLM_DEC_PENDING or BMS_TLM_DEC_ERROR
+*/
+int BmsTlm_DecoderPush(BMS_TLM_DECODER *poDec, uint8_t nByte, BMS_TLM_MSG *poMsg)
+{
+    int nRet = BMS_TLM_DEC_PENDING;
+    uint8_t anMsg[BMS_TLM_MAX_FRAME_LEN];
+    int nMsgLen;
+
+    if(nByte != 0u) {
+        if(poDec->nLen < (uint16_t)sizeof(poDec->anFrame)) {
+            poDec->anFrame[poDec->nLen++] = nByte;
+        } else {
+            poDec->bOverflow = true;
+        }
+    } else if((poDec->nLen > 0u) || (poDec->bOverflow == true)) {
+        nMsgLen = (poDec->bOverflow == true) ? -1 : BmsTlm_CobsDecode(poDec->anFrame, poDec->nLen, anMsg, (uint16_t)sizeof(anMsg));
+        if((nMsgLen > (int)BMS_TLM_CRC_LEN) &&
+           (BmsTlm_Crc16(anMsg, (uint16_t)(nMsgLen - (int)BMS_TLM_CRC_LEN)) ==
+            (uint16_t)BmsTlm_GetLE(anMsg, (uint16_t)(nMsgLen - (int)BMS_TLM_CRC_LEN), 2u))) {
+            nRet = BmsTlm_ParseMsg(anMsg, (uint16_t)(nMsgLen - (int)BMS_TLM_CRC_LEN), poMsg);
+        } else {
+            nRet = BMS_TLM_DEC_ERROR;
+        }
+        if(nRet == BMS_TLM_DEC_MSG) {
+            poDec->nMsgs++;
+        } else {
+            poDec->nErrors++;
+        }
+        poDec->nLen = 0u;
+        poDec->bOverflow = false;
+    }
+    return nRet;
+}
+
+/*!
+    @brief  Store a value little endian
+
+    @return Index after the value
+*/
+static uint16_t BmsTlm_PutLE(uint8_t *pBuf, uint16_t nIdx, uint64_t nVal, uint8_t nBytes)
+{
+    for(uint8_t nByte = 0u; nByte < nBytes; nByte++) {
+        pBuf[nIdx++] = (uint8_t)(nVal >> (8u * nByte));
+    }
+    return nIdx;
+}
+
+/*!
+    @brief  Load a little endian value
+
+    @return Value at @c nIdx
+*/
+static uint64_t BmsTlm_GetLE(const uint8_t *pBuf, uint16_t nIdx, uint8_t nBytes)
+{
+    uint64_t nVal = 0u;
+
+    for(uint8_t nByte = 0u; nByte < nBytes; nByte++) {
+        nVal |= (uint64_t)pBuf[nIdx + nByte] << (8u * nByte);
+    }
+    return nVal;
+}
+
+/*!
+    @brief  Append the CRC to a message and frame it
+
+    @return Length of the frame including the delimiter
+*/
+static uint16_t BmsTlm_Frame(uint8_t *pMsg, uint16_t nLen, uint8_t *pFrame)
+{
+    uint16_t nFrameLen;
+
+    nLen = BmsTlm_PutLE(pMsg, nLen, BmsTlm_Crc16(pMsg, nLen), 2u);
+    nFrameLen = BmsTlm_CobsEncode(pMsg, nLen, pFrame);
+    pFrame[nFrameLen++] = 0u;
+    return nFrameLen;
+}
+
+/*!
+    @brief  COBS encode a buffer, without the delimiter
+
+    @return Length of the encoded data
+*/
+static uint16_t BmsTlm_CobsEncode(const uint8_t *pSrc, uint16_t nLen, uint8_t *pDst)
+{
+    uint16_t nCodeIdx = 0u;
+    uint16_t nDstIdx = 1u;
+    uint8_t nCode = 1u;
+
+    for(uint16_t nIdx = 0u; nIdx < nLen; nIdx++) {
+        if(pSrc[nIdx] != 0u) {
+            pDst[nDstIdx++] = pSrc[nIdx];
+            nCode++;
+        }
+        if((pSrc[nIdx] == 0u) || (nCode == 0xFFu)) {
+            pDst[nCodeIdx] = nCode;
+            nCode = 1u;
+            nCodeIdx = nDstIdx++;
+        }
+    }
+    pDst[nCodeIdx] = nCode;
+    return nDstIdx;
+}
+
+/*!
+    @brief  COBS decode a frame without its delimiter
+
+    @return Length of the decoded data, -1 if the frame is malformed
+*/
+static int BmsTlm_CobsDecode(const uint8_t *pSrc, uint16_t nLen, uint8_t *pDst, uint16_t nDstSize)
+{
+    int nRet = 0;
+    uint16_t nIdx = 0u;
+    uint16_t nDstIdx = 0u;
+    uint8_t nCode;
+
+    while((nIdx < nLen) && (nRet == 0)) {
+        nCode = pSrc[nIdx++];
+        if(((uint16_t)(nIdx + nCode - 1u) > nLen) || ((uint16_t)(nDstIdx + nCode) > nDstSize)) {
+            nRet = -1;
+        } else {
+            for(uint8_t nByte = 1u; nByte < nCode; nByte++) {
+                pDst[nDstIdx++] = pSrc[nIdx++];
+            }
+            /* A code below 0xFF stands for a zero, except at the end of the frame */
+            if((nCode != 0xFFu) && (nIdx < nLen)) {
+                pDst[nDstIdx++] = 0u;
+            }
+        }
+    }
+    return (nRet == 0) ? (int)nDstIdx : -1;
+}
+
+/*!
+    @brief  Parse a message whose CRC was checked
+
+    @return BMS_TLM_DEC_MSG or BMS_TLM_DEC_ERROR
+*/
+static int BmsTlm_ParseMsg(const uint8_t *pMsg, uint16_t nLen, BMS_TLM_MSG *poMsg)
+{
+    int nRet = BMS_TLM_DEC_ERROR;
+    uint16_t nIdx = BMS_TLM_HDR_LEN;
+
+    if((nLen >= BMS_TLM_HDR_LEN) && (pMsg[0] == BMS_TLM_SCHEMA_VERSION)) {
+        poMsg->nVersion = pMsg[0];
+        poMsg->nMsgType = pMsg[1];
+        if((pMsg[1] == BMS_TLM_MSG_SAMPLE) && (nLen >= BMS_TLM_SAMPLE_FIXED_LEN) &&
+           (pMsg[BMS_TLM_SAMPLE_FIXED_LEN - 1u] <= BMS_TLM_MAX_CELLS) &&
+           (nLen == (BMS_TLM_SAMPLE_FIXED_LEN + (2u * pMsg[BMS_TLM_SAMPLE_FIXED_LEN - 1u])))) {
+            BMS_TLM_SAMPLE *poSample = &poMsg->u.oSample;
+            poSample->nSeqNum = (uint32_t)BmsTlm_GetLE(pMsg, nIdx, 4u);
+            poSample->nTimestampUs = BmsTlm_GetLE(pMsg, nIdx + 4u, 8u);
+            poSample->nVoltageCT = (uint16_t)BmsTlm_GetLE(pMsg, nIdx + 12u, 2u);
+            poSample->nCurrentCT = (uint16_t)BmsTlm_GetLE(pMsg, nIdx + 14u, 2u);
+            poSample->nCurrent = (int32_t)(uint32_t)BmsTlm_GetLE(pMsg, nIdx + 16u, 4u);
+            poSample->nNoOfCells = pMsg[nIdx + 20u];
+            for(uint8_t nCell = 0u; nCell < poSample->nNoOfCells; nCell++) {
+                poSample->anCellVoltage[nCell] = (int16_t)(uint16_t)BmsTlm_GetLE(pMsg, (uint16_t)(BMS_TLM_SAMPLE_FIXED_LEN + (2u * nCell)), 2u);
+            }
+            nRet = BMS_TLM_DEC_MSG;
+        } else if((pMsg[1] == BMS_TLM_MSG_STATS) && (nLen == BMS_TLM_STATS_LEN)) {
+            poMsg->u.oStats.nSamples = (uint32_t)BmsTlm_GetLE(pMsg, nIdx, 4u);
+            poMsg->u.oStats.nOverruns = (uint32_t)BmsTlm_GetLE(pMsg, nIdx + 4u, 4u);
+            poMsg->u.oStats.nReadErrors = (uint32_t)BmsTlm_GetLE(pMsg, nIdx + 8u, 4u);
+            poMsg->u.oStats.nMaxLatenessUs = (uint32_t)BmsTlm_GetLE(pMsg, nIdx + 12u, 4u);
+            nRet = BMS_TLM_DEC_MSG;
+        }
+    }
+    return nRet;
+}
+
+/*! @}*/
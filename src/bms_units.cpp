@@ -0,0 +1,99 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_units.cpp
+ * @brief   Fixed-point conversion of ADC codes to engineering units, see
+ *          bms_units.h for the units.
+ *
+ *          The thermistor table samples the fit of the GPIO divider used by
+ *          ADBMS6948_CONVERT_GPIO_HEX_TO_TEMPERATURA,
+ *            T [degC] = 6.0694 * V^2 - 54.0728 * V + 92.2345,
+ *          every 512 codes from 0 V; linear interpolation between the points
+ *          stays within 11 milli-degrees of the fit.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+/*! \addtogroup Bms_Units
+*  @{
+*/
+
+#include "bms_units.h"
+
+/*! Thermistor temperature at every point of the table, milli-degrees Celsius */
+static const int32_t BmsUnits_kaNtcMilliDegC[BMS_UNITS_NTC_NO_OF_POINTS] =
+{
+      92234,   88118,   84072,   80098,   76196,   72366,   68607,   64919,
+      61303,   57759,   54286,   50885,   47556,   44298,   41112,   37997,
+      34954,   31983,   29083,   26255,   23498,   20813,   18200,   15658,
+      13188,   10789,    8462,    6206,    4023,    1910,    -130,   -2099,
+      -3997,   -5823,   -7577,   -9260,  -10871,  -12410,  -13878,  -15274,
+     -16599,  -17852,  -19034,  -20144,  -21182,  -22149,  -23044,  -23867,
+     -24619,  -25299,  -25908,  -26445,  -26911,  -27305,  -27627,  -27878,
+     -28057,  -28164,  -28200,  -28165,  -28057,  -27879,  -27628,  -27306,
+     -26912
+};
+
+/*!
+    @brief  Convert cell, GPIO or auxiliary voltage codes to microvolts
+
+    @param[in]  panCode Codes to convert
+    @param[out] panUv   Placeholder for the voltages in microvolts
+    @param[in]  nCount  Number of codes
+*/
+void BmsUnits_CodesToUv(const int16_t *panCode, int32_t *panUv, uint16_t nCount)
+{
+    for(uint16_t nIdx = 0u; nIdx < nCount; nIdx++) {
+        panUv[nIdx] = BMS_UNITS_CODE_TO_UV(panCode[nIdx]);
+    }
+}
+
+/*!
+    @brief  Convert a thermistor GPIO code to a temperature
+
+    Codes outside the table are clamped to its first and last points.
+
+    @param[in]  nGpioCode GPIO voltage code
+
+    @return Temperature in milli-degrees Celsius
+*/
+int32_t BmsUnits_ThermistorMilliDegC(int16_t nGpioCode)
+{
+    int32_t nOffset = (int32_t)nGpioCode - BMS_UNITS_NTC_FIRST_CODE;
+    int32_t nIdx = nOffset / BMS_UNITS_NTC_STEP_CODES;
+    int32_t nFrac, nTemp;
+
+    if(nOffset <= 0) {
+        nTemp = BmsUnits_kaNtcMilliDegC[0];
+    } else if(nIdx >= (int32_t)(BMS_UNITS_NTC_NO_OF_POINTS - 1u)) {
+        nTemp = BmsUnits_kaNtcMilliDegC[BMS_UNITS_NTC_NO_OF_POINTS - 1u];
+    } else {
+        nFrac = nOffset - (nIdx * BMS_UNITS_NTC_STEP_CODES);
+        nTemp = BmsUnits_kaNtcMilliDegC[nIdx] +
+                (((BmsUnits_kaNtcMilliDegC[nIdx + 1] - BmsUnits_kaNtcMilliDegC[nIdx]) * nFrac) / BMS_UNITS_NTC_STEP_CODES);
+    }
+    return nTemp;
+}
+
+/*!
+    @brief  Convert thermistor GPIO codes to temperatures
+
+    @param[in]  panCode      GPIO voltage codes
+    @param[out] panMilliDegC Placeholder for the temperatures in milli-degrees Celsius
+    @param[in]  nCount       Number of codes
+*/
+void BmsUnits_GpiosToMilliDegC(const int16_t *panCode, int32_t *panMilliDegC, uint16_t nCount)
+{
+    for(uint16_t nIdx = 0u; nIdx < nCount; nIdx++) {
+        panMilliDegC[nIdx] = BmsUnits_ThermistorMilliDegC(panCode[nIdx]);
+    }
+}
+
+
+/*! @}*/
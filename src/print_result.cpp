@@ -19,6 +19,7 @@ Analog Devices License Agreement.
 
 #include "common.h"
 #include "print_result.h"
+#include "bms_cs.h"
 #include "BufferedSerial.h"
 
 extern mbed::BufferedSerial serial_port;
@@ -38,9 +39,15 @@ void PrintMenu()
     printf("5           : Measure average cell voltages\n");
     printf("6           : Measure gpio pin voltages\n");
     printf("7           : Measure status register voltages\n");
-    printf("8           : Measure continuous synchronized voltage and current\n");
+    printf("8           : Stream continuous synchronized voltage and current\n");
     printf("9           : Configure Cell UV Threshold and observe Cell OV UV Flags\n");
     printf("10          : Write and Read from Always ON Memory\n");
+    printf("11          : Toggle binary telemetry for streaming (command 8)\n");
+    printf("12          : Run the scan plan (cells 10ms, current 1ms, gpio 100ms, status 1s, open wire 50ms)\n");
+    printf("13          : Run cell balancing\n");
+    printf("14          : Run charge accounting\n");
+    printf("15          : Run state of charge estimation\n");
+    printf("16          : Run the scan plan with the C vs S cross check (c and s cells 10ms, current 1ms, gpio 100ms, status 1s)\n");
     printf("\n");
     printf("Enter '0' for menu\n");
     printf("Please enter command: \n");
@@ -106,6 +113,28 @@ void PrintStatusVoltage(int16_t *praw_voltages)
     printf("\n");
 }
 
+void PrintOpenWire(uint8_t *panVerdict, uint8_t *panConfidencePct)
+{
+    for (int i=0; i<16; i++)
+    {
+        printf("C%d: %s %u%% ", (i+1),
+               (panVerdict[i] == ADBMS6948_OW_OPEN) ? "open" : ((panVerdict[i] == ADBMS6948_OW_CLOSED) ? "ok" : "?"),
+               (unsigned)panConfidencePct[i]);
+    }
+    printf("\n");
+}
+
+void PrintCrossCheck(uint8_t *panClass, uint8_t *pabRaised)
+{
+    static const char *const kapClass[BMS_CS_NO_OF_CLASSES] = {"ok", "c", "dev", "both"};
+
+    for (int i=0; i<16; i++)
+    {
+        printf("C%d: %s%s ", (i+1), kapClass[panClass[i] & (BMS_CS_NO_OF_CLASSES - 1u)], (pabRaised[i] != 0u) ? " RAISED" : "");
+    }
+    printf("\n");
+}
+
 void PrintCellOVUVFlags(uint32_t nCellUVStatus, uint32_t nCellOVStatus)
 {
     printf("Cell UV Status: 0x%04X\nCell OV Status: 0x%04X\n", nCellUVStatus, nCellOVStatus);
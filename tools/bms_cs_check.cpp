@@ -0,0 +1,216 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_cs_check.cpp
+ * @brief   Host check of the C vs S cross check. The C-ADC converts
+ *          continuously with redundancy on a simulated chain, so the S-ADC
+ *          follows every conversion and the devices latch their C vs S
+ *          faults against the threshold of the chain configuration. Every
+ *          scan reads C, S and the faults with Adbms6948_ReadCellVoltCS,
+ *          which clears the faults it read, and adds them to BmsCs_Update
+ *          with the thresholds of PAL/inc/bms_configuration.h.
+ *
+ *          An S-ADC error on cell 4 of the last device drives it through
+ *          the four classes: both disagree, the device only (an error
+ *          between two reads), the read only (the device compares at a
+ *          higher threshold) and agree. The diagnostic must raise after
+ *          SYS_CS_RAISE_SCANS disagreeing scans and clear after
+ *          SYS_CS_CLEAR_SCANS agreeing ones, a disagreeing scan restarting
+ *          the count, while an error below the threshold on another cell
+ *          never disagrees.
+ *
+ *          g++ -std=c++14 -pthread -DADI_PAL_HOST
+ *              -DADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN=2U
+ *              -Iinc -IPAL/inc -IADBMS6948/inc -IADBMS6948/lib/inc
+ *              -IADBMS6948/cfg/inc <sources> src/bms_cs.cpp tools/bms_cs_check.cpp
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+#include <stdio.h>
+#include "Adbms6948.h"
+#include "adi_bms_platform.h"
+#include "adi_bms_sim.h"
+#include "bms_configuration.h"
+#include "bms_cs.h"
+#include "bms_units.h"
+
+/*! Devices of the chain, the faulty cell is on the last one */
+#define CHECK_NO_OF_DEVICES         (ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)
+/*! Number of cells of a device */
+#define CHECK_NO_OF_CELLS           (16u)
+/*! Faulty cell, cell 4 of the last device */
+#define CHECK_CELL                  (((CHECK_NO_OF_DEVICES - 1u) * CHECK_NO_OF_CELLS) + 3u)
+/*! Cell with an S-ADC error below the threshold, cell 8 of the first device */
+#define CHECK_CELL_BELOW            (7u)
+/*! S-ADC errors, codes of 150 uV: above the threshold, between the threshold and CHECK_CTH_HIGH, below it */
+#define CHECK_ERR_ABOVE             ((int16_t)((2 * SYS_CS_MAX_DELTA_UV) / BMS_UNITS_ADC_LSB_UV))
+#define CHECK_ERR_BETWEEN           ((int16_t)((4 * SYS_CS_MAX_DELTA_UV) / (3 * BMS_UNITS_ADC_LSB_UV)))
+#define CHECK_ERR_BELOW             ((int16_t)((4 * SYS_CS_MAX_DELTA_UV) / (5 * BMS_UNITS_ADC_LSB_UV)))
+/*! Threshold of the device comparing above the software for the read only class */
+#define CHECK_CTH_HIGH              (ADBMS6948_CTH_VOLT_45mv)
+
+extern const Adbms6948_CfgType Adbms6948ConfigSet_0_PB;
+
+static const BMS_CS_CFG koCheckCsCfg = {SYS_CS_MAX_DELTA_UV / BMS_UNITS_ADC_LSB_UV, SYS_CS_RAISE_SCANS, SYS_CS_CLEAR_SCANS};
+static uint8_t anCheckCellsPerDevice[CHECK_NO_OF_DEVICES];
+static Adbms6948_DaisyChainCfgType oCheckChainCfg;
+static BMS_CS_STATE oCheckCsState;
+static int nCheckFailures = 0;
+
+/*!
+    @brief  Read and add one scan, then compare the class of the faulty cell
+            and the raised diagnostics with the expected ones
+
+    @return Status of the read
+*/
+static int check_scan(uint8_t nExpClass, uint16_t nExpRaised)
+{
+    int16_t anCellC[CHECK_NO_OF_DEVICES * CHECK_NO_OF_CELLS], anCellS[CHECK_NO_OF_DEVICES * CHECK_NO_OF_CELLS];
+    uint16_t anCSFlt[CHECK_NO_OF_DEVICES];
+    uint16_t nRaised;
+    int nRet;
+
+    adi_pal_TimerDelay(SYS_CS_PERIOD_MS * 1000u, 0u);
+    nRet = (int)Adbms6948_ReadCellVoltCS(&anCellC[0], &anCellS[0], &anCSFlt[0], ADBMS6948_SEND_NONE, 0u);
+    if(nRet == 0) {
+        nRaised = BmsCs_Update(&koCheckCsCfg, &oCheckCsState, &anCellC[0], &anCellS[0], &anCSFlt[0]);
+        if((oCheckCsState.anClass[CHECK_CELL] != nExpClass) || (nRaised != nExpRaised) ||
+           (oCheckCsState.abRaised[CHECK_CELL] != ((nExpRaised != 0u) ? 1u : 0u)) ||
+           (oCheckCsState.anClass[CHECK_CELL_BELOW] != BMS_CS_AGREE) ||
+           (oCheckCsState.anClassCells[nExpClass] != ((nExpClass == BMS_CS_AGREE) ? oCheckCsState.nNoOfCells : 1u))) {
+            printf("scan %lu: class %u, raised %u, expected class %u, raised %u\n",
+                   (unsigned long)oCheckCsState.nScans, (unsigned)oCheckCsState.anClass[CHECK_CELL],
+                   (unsigned)nRaised, (unsigned)nExpClass, (unsigned)nExpRaised);
+            nCheckFailures++;
+        }
+    }
+    return nRet;
+}
+
+/*!
+    @brief  Run scans expecting the same class and raised diagnostics, print the last one
+
+    @return Status of the reads
+*/
+static int check_scans(const char *pStep, uint8_t nScans, uint8_t nExpClass, uint16_t nExpRaised)
+{
+    int nRet = 0;
+
+    for(uint8_t nScan = 0u; (nRet == 0) && (nScan < nScans); nScan++) {
+        nRet = check_scan(nExpClass, nExpRaised);
+    }
+    printf("%-32s scans %3lu, class %u, raised %u, classes %u/%u/%u/%u\n", pStep,
+           (unsigned long)oCheckCsState.nScans, (unsigned)oCheckCsState.anClass[CHECK_CELL],
+           (unsigned)oCheckCsState.nRaised,
+           (unsigned)oCheckCsState.anClassCells[BMS_CS_AGREE], (unsigned)oCheckCsState.anClassCells[BMS_CS_SW_ONLY],
+           (unsigned)oCheckCsState.anClassCells[BMS_CS_CHIP_ONLY], (unsigned)oCheckCsState.anClassCells[BMS_CS_BOTH]);
+    return nRet;
+}
+
+/*!
+    @brief  Set the C vs S threshold of the last device, the others keep SYS_CS_THRESHOLD
+*/
+static int check_threshold(Adbms6948_CSThresVoltType eLastCth)
+{
+    Adbms6948_CSThresVoltType aeCth[CHECK_NO_OF_DEVICES];
+
+    for(uint8_t nDevIdx = 0u; nDevIdx < CHECK_NO_OF_DEVICES; nDevIdx++) {
+        aeCth[nDevIdx] = SYS_CS_THRESHOLD;
+    }
+    aeCth[CHECK_NO_OF_DEVICES - 1u] = eLastCth;
+    return (int)Adbms6948_CfgCSCompThresVolt(&aeCth[0], 0u);
+}
+
+int main(void)
+{
+    Adbms6948_TrigIVADCInputs oTrigIVADCInputs = {
+        TRUE,                   /*Adbms6948_bContMode*/
+        TRUE,                   /*Adbms6948_bEnRedun*/
+        FALSE,                  /*Adbms6948_bEnSSDP*/
+        TRUE,                   /*Adbms6948_bRstIIRFltr*/
+        ADBMS6948_CELL_OW_NONE  /*Adbms6948_eOWSel*/
+    };
+    Adbms6948_CfgType oCfg = Adbms6948ConfigSet_0_PB;
+    uint8_t nLastDev = (uint8_t)(CHECK_NO_OF_DEVICES - 1u);
+    int nRet;
+
+    /* The chain of the configuration with every device of the build */
+    oCheckChainCfg = Adbms6948ConfigSet_0_PB.Adbms6948_pDaisyChainCfg[0];
+    oCheckChainCfg.Adbms6948_nNoOfDevices = CHECK_NO_OF_DEVICES;
+    oCheckChainCfg.Adbms6948_pNoOfCellsPerDevice = anCheckCellsPerDevice;
+    oCfg.Adbms6948_pDaisyChainCfg = &oCheckChainCfg;
+    adi_pal_Init();
+    adi_bms_sim_Init(0u, CHECK_NO_OF_DEVICES);
+    for(uint8_t nDevIdx = 0u; nDevIdx < CHECK_NO_OF_DEVICES; nDevIdx++) {
+        anCheckCellsPerDevice[nDevIdx] = CHECK_NO_OF_CELLS;
+        for(uint8_t nCellIdx = 0u; nCellIdx < CHECK_NO_OF_CELLS; nCellIdx++) {
+            adi_bms_sim_SetCellVoltage(0u, nDevIdx, nCellIdx, (int16_t)(12000 + (100 * nDevIdx) + nCellIdx));
+        }
+    }
+    adi_bms_sim_SetSAdcError(0u, 0u, CHECK_CELL_BELOW, CHECK_ERR_BELOW);
+
+    nRet = (int)Adbms6948_Init(&oCfg);
+    nRet |= (int)Adbms6948_TrigIVADC(&oTrigIVADCInputs, 0u);
+    printf("init and redundant C-ADC: %d, %u devices, threshold %d codes\n", nRet,
+           (unsigned)CHECK_NO_OF_DEVICES, (int)koCheckCsCfg.nMaxDelta);
+    BmsCs_Init(&oCheckCsState, (uint16_t)(CHECK_NO_OF_DEVICES * CHECK_NO_OF_CELLS));
+
+    if(nRet == 0) {
+        nRet = check_scans("agree", 2u, BMS_CS_AGREE, 0u);
+    }
+
+    /* Both disagree, raised on the last scan of the count */
+    adi_bms_sim_SetSAdcError(0u, nLastDev, 3u, CHECK_ERR_ABOVE);
+    if(nRet == 0) {
+        nRet = check_scans("both, below the raise count", SYS_CS_RAISE_SCANS - 1u, BMS_CS_BOTH, 0u);
+    }
+    if(nRet == 0) {
+        nRet = check_scans("both, raised", 1u, BMS_CS_BOTH, 1u);
+    }
+
+    /* An error between two reads, latched by the device only */
+    adi_pal_TimerDelay(2u * ADI_BMS_SIM_T_CADC_US, 0u);
+    adi_bms_sim_SetSAdcError(0u, nLastDev, 3u, 0);
+    if(nRet == 0) {
+        nRet = check_scans("device only", 1u, BMS_CS_CHIP_ONLY, 1u);
+    }
+
+    /* The device compares above the software threshold */
+    nRet |= check_threshold(CHECK_CTH_HIGH);
+    adi_bms_sim_SetSAdcError(0u, nLastDev, 3u, CHECK_ERR_BETWEEN);
+    if(nRet == 0) {
+        nRet = check_scans("read only", 1u, BMS_CS_SW_ONLY, 1u);
+    }
+    adi_bms_sim_SetSAdcError(0u, nLastDev, 3u, 0);
+    nRet |= check_threshold(SYS_CS_THRESHOLD);
+
+    /* Agreeing scans clear, a disagreeing one restarts the count */
+    if(nRet == 0) {
+        nRet = check_scans("agree, below the clear count", SYS_CS_CLEAR_SCANS - 1u, BMS_CS_AGREE, 1u);
+    }
+    adi_bms_sim_SetSAdcError(0u, nLastDev, 3u, CHECK_ERR_ABOVE);
+    adi_pal_TimerDelay(2u * ADI_BMS_SIM_T_CADC_US, 0u);
+    adi_bms_sim_SetSAdcError(0u, nLastDev, 3u, 0);
+    if(nRet == 0) {
+        nRet = check_scans("device only, restarts the count", 1u, BMS_CS_CHIP_ONLY, 1u);
+    }
+    if(nRet == 0) {
+        nRet = check_scans("agree, below the clear count", SYS_CS_CLEAR_SCANS - 1u, BMS_CS_AGREE, 1u);
+    }
+    if(nRet == 0) {
+        nRet = check_scans("agree, cleared", 1u, BMS_CS_AGREE, 0u);
+    }
+
+    adi_pal_DeInit();
+    printf("reads: %d\n", nRet);
+    nRet = ((nRet == 0) && (nCheckFailures == 0)) ? 0 : 1;
+    printf("%s\n", (nRet == 0) ? "PASS" : "FAIL");
+    return nRet;
+}
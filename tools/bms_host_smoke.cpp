@@ -0,0 +1,70 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_host_smoke.cpp
+ * @brief   Smoke test of the host build. The driver is initialized on the
+ *          simulated daisy chain, one C-ADC conversion is triggered and the
+ *          cell voltages of the first device are read back and compared
+ *          with the stimulus.
+ *
+ *          g++ -std=c++14 -pthread -DADI_PAL_HOST -Iinc -IPAL/inc
+ *              -IADBMS6948/inc -IADBMS6948/lib/inc -IADBMS6948/cfg/inc
+ *              <sources> tools/bms_host_smoke.cpp
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+#include <stdio.h>
+#include "Adbms6948.h"
+#include "adi_bms_platform.h"
+#include "adi_bms_sim.h"
+
+/*! Number of cells of a device */
+#define SMOKE_NO_OF_CELLS           (16u)
+
+extern const Adbms6948_CfgType Adbms6948ConfigSet_0_PB;
+
+int main(void)
+{
+    Adbms6948_TrigCADCInputs oTrigCADCInputs = {
+        FALSE,                  /*Adbms6948_bContMode*/
+        FALSE,                  /*Adbms6948_bEnRedun*/
+        FALSE,                  /*Adbms6948_bEnSSDP*/
+        TRUE,                   /*Adbms6948_bRstIIRFltr*/
+        ADBMS6948_CELL_OW_NONE  /*Adbms6948_eOWSel*/
+    };
+    int16_t anCellData[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN * SMOKE_NO_OF_CELLS] = {0};
+    int nRet, nMismatch = 0;
+
+    adi_pal_Init();
+    for(uint8_t nCellIdx = 0u; nCellIdx < SMOKE_NO_OF_CELLS; nCellIdx++) {
+        adi_bms_sim_SetCellVoltage(0u, 0u, nCellIdx, (int16_t)(10000 + nCellIdx));
+    }
+
+    nRet = (int)Adbms6948_Init(&Adbms6948ConfigSet_0_PB);
+    printf("init: %d\n", nRet);
+    if(nRet == 0) {
+        nRet = (int)Adbms6948_TrigCADC(&oTrigCADCInputs, 0u);
+        /* Single shot conversion, well past its conversion time */
+        adi_pal_TimerDelay(2u * ADI_BMS_SIM_T_CADC_US, 0u);
+        nRet |= (int)Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA, ADBMS6948_CELL_GRP_SEL_ALL,
+                                            anCellData, ADBMS6948_SEND_NONE, 0u);
+        for(uint8_t nCellIdx = 0u; nCellIdx < SMOKE_NO_OF_CELLS; nCellIdx++) {
+            if(anCellData[nCellIdx] != (int16_t)(10000 + nCellIdx)) {
+                nMismatch++;
+            }
+        }
+        printf("cell read: %d, c1=%d c16=%d, %d mismatches\n", nRet, anCellData[0],
+               anCellData[SMOKE_NO_OF_CELLS - 1u], nMismatch);
+    }
+    adi_pal_DeInit();
+    nRet = ((nRet == 0) && (nMismatch == 0)) ? 0 : 1;
+    printf("%s\n", (nRet == 0) ? "PASS" : "FAIL");
+    return nRet;
+}
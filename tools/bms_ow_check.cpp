@@ -0,0 +1,178 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_ow_check.cpp
+ * @brief   Host check of the open wire diagnostics. Wire C5 of the first
+ *          device is opened on the simulated chain, the C-ADC converts
+ *          continuously and the S-ADC passes alternate the switches of the
+ *          odd and the even wires as the open wire task of the scan plan
+ *          does. Every pass is rated by Adbms6948_CellOWDiag and accumulated
+ *          by BmsOw_Update; the verdicts and confidences of BmsOw_GetVerdicts
+ *          are checked after every pass, until C5 is reported open and every
+ *          other wire closed, and again while the evidence of C5 decays
+ *          after the wire is reconnected.
+ *
+ *          g++ -std=c++14 -pthread -DADI_PAL_HOST -Iinc -IPAL/inc
+ *              -IADBMS6948/inc -IADBMS6948/lib/inc -IADBMS6948/cfg/inc
+ *              <sources> src/bms_ow.cpp tools/bms_ow_check.cpp
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+#include <stdio.h>
+#include "Adbms6948.h"
+#include "adi_bms_platform.h"
+#include "adi_bms_sim.h"
+#include "bms_ow.h"
+
+/*! Number of cells of the device */
+#define CHECK_NO_OF_CELLS           (16u)
+/*! Wire opened, Cn, evaluated with the cell below it at index n - 1 */
+#define CHECK_OPEN_WIRE             (5u)
+/*! Agreeing passes of a wire for a verdict */
+#define CHECK_CONFIRM               (3u)
+/*! Time of an S-ADC pass, well past its conversion time */
+#define CHECK_PASS_US               (10000u)
+
+extern const Adbms6948_CfgType Adbms6948ConfigSet_0_PB;
+
+static const BMS_OW_CFG koCheckOwCfg = {CHECK_CONFIRM};
+static BMS_OW_STATE oCheckOwState;
+static int nCheckFailures = 0;
+
+/*!
+    @brief  Run one open wire pass and accumulate it
+
+    @return Status of the conversion, the reads and the evaluation
+*/
+static int check_pass(uint8_t nPass)
+{
+    int16_t anCells[CHECK_NO_OF_CELLS], anOwCells[CHECK_NO_OF_CELLS];
+    uint8_t anStatus[CHECK_NO_OF_CELLS];
+    int nRet;
+
+    nRet = (int)Adbms6948_TrigSADC(FALSE, FALSE,
+                                   (nPass == BMS_OW_PASS_ODD) ? ADBMS6948_CELL_OW_ODD : ADBMS6948_CELL_OW_EVEN, 0u);
+    adi_pal_TimerDelay(CHECK_PASS_US, 0u);
+    nRet |= (int)Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA, ADBMS6948_CELL_GRP_SEL_ALL,
+                                        &anCells[0], ADBMS6948_SEND_NONE, 0u);
+    nRet |= (int)Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA_REDUNDANT, ADBMS6948_CELL_GRP_SEL_ALL,
+                                        &anOwCells[0], ADBMS6948_SEND_NONE, 0u);
+    nRet |= (int)Adbms6948_CellOWDiag(&anCells[0], &anOwCells[0], FALSE, &anStatus[0], 0u);
+    if(nRet == 0) {
+        BmsOw_Update(&koCheckOwCfg, &oCheckOwState, &anStatus[0], nPass);
+    }
+    return nRet;
+}
+
+/*!
+    @brief  Compare the verdict and the confidence of every wire with the expected ones
+
+    @param[in]  pStep           Name of the step printed
+    @param[in]  nOddEvidence    Expected evidence of the closed odd wires, negative
+    @param[in]  nEvenEvidence   Expected evidence of the closed even wires, negative
+    @param[in]  nOpenEvidence   Expected evidence of wire C5
+*/
+static void check_verdicts(const char *pStep, int nOddEvidence, int nEvenEvidence, int nOpenEvidence)
+{
+    uint8_t anVerdict[CHECK_NO_OF_CELLS], anConfidence[CHECK_NO_OF_CELLS];
+    uint8_t nExpVerdict, nExpConfidence;
+    uint16_t nOpen, nDecided, nExpOpen = 0u, nExpDecided = 0u;
+    int nEvidence;
+
+    nOpen = BmsOw_GetVerdicts(&koCheckOwCfg, &oCheckOwState, &anVerdict[0], &anConfidence[0], &nDecided);
+    printf("%-24s open %u, decided %u, C5 %u/%u%%:", pStep, (unsigned)nOpen, (unsigned)nDecided,
+           (unsigned)anVerdict[CHECK_OPEN_WIRE - 1u], (unsigned)anConfidence[CHECK_OPEN_WIRE - 1u]);
+    for(uint8_t nIdx = 0u; nIdx < CHECK_NO_OF_CELLS; nIdx++) {
+        /* Index 0 is wire C1, switched by the odd passes */
+        nEvidence = ((nIdx % 2u) == 0u) ? nOddEvidence : nEvenEvidence;
+        if(nIdx == (CHECK_OPEN_WIRE - 1u)) {
+            nEvidence = nOpenEvidence;
+        }
+        nExpVerdict = BMS_OW_UNDECIDED;
+        if(nEvidence >= (int)CHECK_CONFIRM) {
+            nExpVerdict = BMS_OW_OPEN;
+            nExpOpen++;
+        } else if(nEvidence <= -(int)CHECK_CONFIRM) {
+            nExpVerdict = BMS_OW_CLOSED;
+        }
+        nExpDecided = (uint16_t)(nExpDecided + ((nExpVerdict != BMS_OW_UNDECIDED) ? 1u : 0u));
+        nExpConfidence = (uint8_t)((((nEvidence < 0) ? -nEvidence : nEvidence) * 100) / (int)CHECK_CONFIRM);
+        printf(" %u/%u", (unsigned)anVerdict[nIdx], (unsigned)anConfidence[nIdx]);
+        if((anVerdict[nIdx] != nExpVerdict) || (anConfidence[nIdx] != nExpConfidence)) {
+            nCheckFailures++;
+        }
+    }
+    printf("\n");
+    if((nOpen != nExpOpen) || (nDecided != nExpDecided)) {
+        nCheckFailures++;
+    }
+}
+
+int main(void)
+{
+    Adbms6948_TrigIVADCInputs oTrigIVADCInputs = {
+        TRUE,                   /*Adbms6948_bContMode*/
+        FALSE,                  /*Adbms6948_bEnRedun*/
+        FALSE,                  /*Adbms6948_bEnSSDP*/
+        TRUE,                   /*Adbms6948_bRstIIRFltr*/
+        ADBMS6948_CELL_OW_NONE  /*Adbms6948_eOWSel*/
+    };
+    int nRet, nOdd = 0, nEven = 0, nOpen = 0;
+    uint8_t nPass;
+
+    adi_pal_Init();
+    for(uint8_t nCellIdx = 0u; nCellIdx < CHECK_NO_OF_CELLS; nCellIdx++) {
+        adi_bms_sim_SetCellVoltage(0u, 0u, nCellIdx, (int16_t)(12000 + (10 * nCellIdx)));
+    }
+    adi_bms_sim_SetOpenWire(0u, 0u, CHECK_OPEN_WIRE, TRUE);
+
+    nRet = (int)Adbms6948_Init(&Adbms6948ConfigSet_0_PB);
+    nRet |= (int)Adbms6948_TrigIVADC(&oTrigIVADCInputs, 0u);
+    printf("init and continuous C-ADC: %d\n", nRet);
+    BmsOw_Init(&oCheckOwState, CHECK_NO_OF_CELLS);
+
+    /* Odd and even passes alternate; a pass only moves the wires it switched */
+    for(nPass = 0u; (nRet == 0) && (nPass < (2u * CHECK_CONFIRM)); nPass++) {
+        if((nPass % 2u) == 0u) {
+            nRet = check_pass(BMS_OW_PASS_ODD);
+            nOdd--;
+            nOpen++;
+            check_verdicts("odd pass", nOdd, nEven, nOpen);
+        } else {
+            nRet = check_pass(BMS_OW_PASS_EVEN);
+            nEven--;
+            check_verdicts("even pass", nOdd, nEven, nOpen);
+        }
+    }
+    if((oCheckOwState.anPasses[BMS_OW_PASS_ODD] != CHECK_CONFIRM) ||
+       (oCheckOwState.anPasses[BMS_OW_PASS_EVEN] != CHECK_CONFIRM)) {
+        nCheckFailures++;
+    }
+
+    /* More passes saturate the evidence, the verdicts stay */
+    if(nRet == 0) {
+        nRet = check_pass(BMS_OW_PASS_ODD);
+        check_verdicts("saturated", nOdd, nEven, nOpen);
+    }
+
+    /* Reconnected, C5 loses its verdict after one pass and is closed after the confirmation */
+    adi_bms_sim_SetOpenWire(0u, 0u, CHECK_OPEN_WIRE, FALSE);
+    for(nPass = 0u; (nRet == 0) && (nPass < (2u * CHECK_CONFIRM)); nPass++) {
+        nRet = check_pass(BMS_OW_PASS_ODD);
+        nOpen--;
+        check_verdicts("reconnected, odd pass", nOdd, nEven, nOpen);
+    }
+
+    adi_pal_DeInit();
+    printf("passes: %d\n", nRet);
+    nRet = ((nRet == 0) && (nCheckFailures == 0)) ? 0 : 1;
+    printf("%s\n", (nRet == 0) ? "PASS" : "FAIL");
+    return nRet;
+}
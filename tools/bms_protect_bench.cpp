@@ -0,0 +1,242 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_protect_bench.cpp
+ * @brief   Host check and benchmark of the cell voltage protection
+ *          evaluator. BmsProt_EvalCells is compared with a plain scalar
+ *          evaluation on random cells, on cells at the limits of the code
+ *          range and on the thresholds themselves, for every device count and
+ *          for even and odd cells per device; every bitmap, extreme, mean and
+ *          deviation must match. The time of an evaluation is then measured
+ *          for every device count, 16 cells each, and fitted against the cell
+ *          count: the time per cell must stay flat as the chain grows.
+ *
+ *          With -DBMS_PROT_SIMD_MODEL the pair path of the Cortex-M4 runs on
+ *          a C model of SSUB16, SEL and SMLAD and is checked the same way.
+ *
+ *          g++ -std=c++14 -O2 [-DBMS_PROT_SIMD_MODEL] -Iinc src/bms_protect.cpp
+ *              tools/bms_protect_bench.cpp -o bms_protect_bench
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+#include "bms_protect.h"
+
+/*! Devices of the largest chain */
+#define BENCH_MAX_DEVICES           (16u)
+/*! Cells of the largest chain */
+#define BENCH_MAX_CELLS             (BENCH_MAX_DEVICES * BMS_PROT_MAX_CELLS_PER_DEVICE)
+/*! Random chains compared per device count and cells per device */
+#define BENCH_NO_OF_RANDOM          (200u)
+/*! Evaluations timed per device count */
+#define BENCH_NO_OF_REPEATS         (20000u)
+/*! Largest ratio of the time per cell of any chain to the fitted time per cell */
+#define BENCH_MAX_PER_CELL_RATIO    (2.0)
+
+static int16_t anBenchCells[BENCH_MAX_CELLS];
+static uint16_t anBenchOv[BENCH_MAX_DEVICES], anBenchUv[BENCH_MAX_DEVICES];
+static uint16_t anRefOv[BENCH_MAX_DEVICES], anRefUv[BENCH_MAX_DEVICES];
+static int16_t anBenchDelta[BENCH_MAX_CELLS], anRefDelta[BENCH_MAX_CELLS];
+static uint32_t nBenchSeed = 1u;
+
+/*!
+    @brief  Pseudo random number
+*/
+static uint32_t bench_rand(void)
+{
+    nBenchSeed = (nBenchSeed * 1664525u) + 1013904223u;
+    return nBenchSeed >> 8;
+}
+
+/*!
+    @brief  Scalar evaluation, one cell at a time, the reference of the check
+*/
+static void bench_eval_ref(uint8_t nNoOfDevices, uint8_t nCellsPerDevice, const BMS_PROT_LIMITS *poLimits,
+                           BMS_PROT_SUMMARY *poSummary)
+{
+    uint16_t nNoOfCells = (uint16_t)(nNoOfDevices * nCellsPerDevice);
+    int32_t nSum = 0, nDelta;
+    int16_t nCode;
+
+    poSummary->nMinCode = 32767;
+    poSummary->nMaxCode = -32768;
+    poSummary->nMinCell = 0u;
+    poSummary->nMaxCell = 0u;
+    poSummary->nOvCells = 0u;
+    poSummary->nUvCells = 0u;
+    for(uint8_t nDev = 0u; nDev < nNoOfDevices; nDev++) {
+        anRefOv[nDev] = 0u;
+        anRefUv[nDev] = 0u;
+        for(uint8_t nCell = 0u; nCell < nCellsPerDevice; nCell++) {
+            uint16_t nIdx = (uint16_t)((nDev * nCellsPerDevice) + nCell);
+            nCode = anBenchCells[nIdx];
+            if(nCode > poLimits->nOvCode) {
+                anRefOv[nDev] |= (uint16_t)(1u << nCell);
+                poSummary->nOvCells++;
+            }
+            if(nCode < poLimits->nUvCode) {
+                anRefUv[nDev] |= (uint16_t)(1u << nCell);
+                poSummary->nUvCells++;
+            }
+            if(nCode < poSummary->nMinCode) {
+                poSummary->nMinCode = nCode;
+                poSummary->nMinCell = nIdx;
+            }
+            if(nCode > poSummary->nMaxCode) {
+                poSummary->nMaxCode = nCode;
+                poSummary->nMaxCell = nIdx;
+            }
+            nSum += nCode;
+        }
+    }
+    poSummary->nAvgCode = (nNoOfCells > 0u) ? (int16_t)(nSum / (int32_t)nNoOfCells) : 0;
+    for(uint16_t nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+        nDelta = (int32_t)anBenchCells[nIdx] - poSummary->nAvgCode;
+        anRefDelta[nIdx] = (int16_t)((nDelta > 32767) ? 32767 : ((nDelta < -32768) ? -32768 : nDelta));
+    }
+}
+
+/*!
+    @brief  Evaluate the cells with both paths and compare every output
+
+    @return 0 if they agree, 1 otherwise
+*/
+static int bench_compare(uint8_t nNoOfDevices, uint8_t nCellsPerDevice, const BMS_PROT_LIMITS *poLimits)
+{
+    BMS_PROT_SUMMARY oSummary, oRef;
+    int nRet = 0;
+
+    BmsProt_EvalCells(anBenchCells, nNoOfDevices, nCellsPerDevice, poLimits, anBenchOv, anBenchUv,
+                      anBenchDelta, &oSummary);
+    bench_eval_ref(nNoOfDevices, nCellsPerDevice, poLimits, &oRef);
+    if((oSummary.nMinCode != oRef.nMinCode) || (oSummary.nMaxCode != oRef.nMaxCode) ||
+       (oSummary.nAvgCode != oRef.nAvgCode) || (oSummary.nMinCell != oRef.nMinCell) ||
+       (oSummary.nMaxCell != oRef.nMaxCell) || (oSummary.nOvCells != oRef.nOvCells) ||
+       (oSummary.nUvCells != oRef.nUvCells)) {
+        nRet = 1;
+    }
+    for(uint8_t nDev = 0u; nDev < nNoOfDevices; nDev++) {
+        if((anBenchOv[nDev] != anRefOv[nDev]) || (anBenchUv[nDev] != anRefUv[nDev])) {
+            nRet = 1;
+        }
+    }
+    for(uint16_t nIdx = 0u; nIdx < (uint16_t)(nNoOfDevices * nCellsPerDevice); nIdx++) {
+        if(anBenchDelta[nIdx] != anRefDelta[nIdx]) {
+            nRet = 1;
+        }
+    }
+    return nRet;
+}
+
+/*!
+    @brief  Compare both paths over every device count and cells per device
+
+    @return Number of disagreeing evaluations
+*/
+static uint32_t bench_check(uint32_t *pnCases)
+{
+    static const uint8_t kanCellsPerDevice[] = {16u, 15u, 12u, 3u, 1u};
+    BMS_PROT_LIMITS oLimits;
+    uint32_t nFailed = 0u, nCases = 0u;
+    uint16_t nNoOfCells;
+
+    for(uint8_t nCpd = 0u; nCpd < (uint8_t)(sizeof(kanCellsPerDevice) / sizeof(kanCellsPerDevice[0])); nCpd++) {
+        for(uint8_t nNoOfDevices = 1u; nNoOfDevices <= BENCH_MAX_DEVICES; nNoOfDevices++) {
+            nNoOfCells = (uint16_t)(nNoOfDevices * kanCellsPerDevice[nCpd]);
+            for(uint32_t nRun = 0u; nRun < BENCH_NO_OF_RANDOM; nRun++) {
+                /* Cells around the thresholds, on them, and at the limits of the code range */
+                oLimits.nOvCode = (int16_t)(18000 + (int32_t)(bench_rand() % 400u));
+                oLimits.nUvCode = (int16_t)(8000 + (int32_t)(bench_rand() % 400u));
+                for(uint16_t nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+                    switch(bench_rand() % 8u) {
+                        case 0u: anBenchCells[nIdx] = oLimits.nOvCode; break;
+                        case 1u: anBenchCells[nIdx] = oLimits.nUvCode; break;
+                        case 2u: anBenchCells[nIdx] = (int16_t)((bench_rand() & 1u) ? 32767 : -32768); break;
+                        case 3u: anBenchCells[nIdx] = (int16_t)(bench_rand() & 0xFFFFu); break;
+                        default: anBenchCells[nIdx] = (int16_t)(7000 + (int32_t)(bench_rand() % 12000u)); break;
+                    }
+                }
+                /* Thresholds at the limits as well, nothing can be over 32767 or under -32768 */
+                if(nRun == 0u) {
+                    oLimits.nOvCode = 32767;
+                    oLimits.nUvCode = -32768;
+                } else if(nRun == 1u) {
+                    oLimits.nOvCode = -32768;
+                    oLimits.nUvCode = 32767;
+                }
+                nFailed += (uint32_t)bench_compare(nNoOfDevices, kanCellsPerDevice[nCpd], &oLimits);
+                nCases++;
+            }
+        }
+    }
+    *pnCases = nCases;
+    return nFailed;
+}
+
+int main(void)
+{
+    const BMS_PROT_LIMITS koLimits = {18867, 8667};    /*4.33 V and 2.8 V*/
+    BMS_PROT_SUMMARY oSummary;
+    double adNs[BENCH_MAX_DEVICES + 1u];
+    double dSumN = 0.0, dSumT = 0.0, dSumNN = 0.0, dSumNT = 0.0, dSlope, dOffset, dRatio, dMaxRatio = 0.0;
+    struct timespec oStart, oEnd;
+    uint32_t nCases, nFailed, nChecksum = 0u;
+    uint16_t nNoOfCells;
+    int nRet = 0;
+
+#ifdef BMS_PROT_SIMD_MODEL
+    printf("path: pair model\n");
+#else
+    printf("path: portable\n");
+#endif
+    nFailed = bench_check(&nCases);
+    printf("equivalence: %u of %u evaluations disagree with the scalar path\n", (unsigned)nFailed, (unsigned)nCases);
+    nRet |= (nFailed != 0u) ? 1 : 0;
+
+    printf("devices,cells,ns_per_eval,ns_per_cell\n");
+    for(uint8_t nNoOfDevices = 1u; nNoOfDevices <= BENCH_MAX_DEVICES; nNoOfDevices++) {
+        nNoOfCells = (uint16_t)(nNoOfDevices * BMS_PROT_MAX_CELLS_PER_DEVICE);
+        for(uint16_t nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+            anBenchCells[nIdx] = (int16_t)(8000 + (int32_t)(bench_rand() % 11000u));
+        }
+        clock_gettime(CLOCK_MONOTONIC, &oStart);
+        for(uint32_t nRep = 0u; nRep < BENCH_NO_OF_REPEATS; nRep++) {
+            anBenchCells[nRep % nNoOfCells] ^= 1;
+            BmsProt_EvalCells(anBenchCells, nNoOfDevices, BMS_PROT_MAX_CELLS_PER_DEVICE, &koLimits, anBenchOv,
+                              anBenchUv, anBenchDelta, &oSummary);
+            nChecksum += (uint32_t)oSummary.nAvgCode + oSummary.nOvCells;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &oEnd);
+        adNs[nNoOfDevices] = (((double)(oEnd.tv_sec - oStart.tv_sec) * 1e9) + (double)(oEnd.tv_nsec - oStart.tv_nsec)) /
+                             BENCH_NO_OF_REPEATS;
+        printf("%u,%u,%.0f,%.2f\n", (unsigned)nNoOfDevices, (unsigned)nNoOfCells, adNs[nNoOfDevices],
+               adNs[nNoOfDevices] / nNoOfCells);
+        dSumN += nNoOfCells;
+        dSumT += adNs[nNoOfDevices];
+        dSumNN += (double)nNoOfCells * nNoOfCells;
+        dSumNT += nNoOfCells * adNs[nNoOfDevices];
+    }
+    dSlope = ((BENCH_MAX_DEVICES * dSumNT) - (dSumN * dSumT)) / ((BENCH_MAX_DEVICES * dSumNN) - (dSumN * dSumN));
+    dOffset = (dSumT - (dSlope * dSumN)) / BENCH_MAX_DEVICES;
+    /* Per cell time of the chains of 4 devices and more, the call overhead dominates the shorter ones */
+    for(uint8_t nNoOfDevices = 4u; nNoOfDevices <= BENCH_MAX_DEVICES; nNoOfDevices++) {
+        dRatio = (adNs[nNoOfDevices] / (nNoOfDevices * BMS_PROT_MAX_CELLS_PER_DEVICE)) / dSlope;
+        dMaxRatio = (dRatio > dMaxRatio) ? dRatio : dMaxRatio;
+    }
+    printf("fit: ns_per_eval = %.0f + %.2f * cells, worst time per cell %.2f x the fit (checksum %u)\n",
+           dOffset, dSlope, dMaxRatio, (unsigned)nChecksum);
+    if(dMaxRatio > BENCH_MAX_PER_CELL_RATIO) {
+        printf("time per cell grows with the chain\n");
+        nRet = 1;
+    }
+    printf("%s\n", (nRet == 0) ? "PASS" : "FAIL");
+    return nRet;
+}
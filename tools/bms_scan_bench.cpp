@@ -0,0 +1,233 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_scan_bench.cpp
+ * @brief   Host benchmark of a full cell voltage scan against the simulated
+ *          daisy chains. For every device count the driver is initialized,
+ *          a C-ADC conversion is triggered on all the chains and the cell
+ *          voltages of every device are read back and checked against the
+ *          stimulus. Times are simulated bus and conversion times; the time
+ *          to read the cells must grow linearly with the number of devices.
+ *
+ *          With ADI_LEGACY_GRP_SUPPORT the cells are read with the register
+ *          group commands, otherwise with a single RDCVALL frame per chain.
+ *
+ *          Build on the host together with the sources of ADBMS6948/lib/src,
+ *          ADBMS6948/cfg/src and PAL/src, for example for two chains of up
+ *          to twelve devices:
+ *          g++ -std=c++14 -pthread -DADI_PAL_HOST [-DADI_LEGACY_GRP_SUPPORT]
+ *              -DADBMS6948_NO_OF_DAISY_CHAIN=2U
+ *              -DADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN=12U
+ *              -Iinc -IPAL/inc -IADBMS6948/inc -IADBMS6948/lib/inc
+ *              -IADBMS6948/cfg/inc <sources> tools/bms_scan_bench.cpp
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "Adbms6948.h"
+#include "adi_bms_platform.h"
+#include "adi_bms_sim.h"
+
+/*! Number of cells read from every device */
+#define BENCH_NO_OF_CELLS           (16u)
+/*! Number of cells in each of the first five cell register groups */
+#define BENCH_CELLS_PER_REGGRP      (3u)
+/*! Largest deviation of a read time from the linear fit, in microseconds: one
+    register group frame of the longest chain, sent by the periodic command
+    counter check whenever it falls into a read */
+#define BENCH_LINEARITY_TOL_US      ((double)((4u + (8u * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)) * \
+                                              ADI_BMS_SIM_SPI_BYTE_TIME_US))
+
+extern const Adbms6948_CfgType Adbms6948ConfigSet_0_PB;
+
+static uint8_t anBenchCellsPerDevice[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+static Adbms6948_DaisyChainCfgType aoBenchChainCfg[ADBMS6948_NO_OF_DAISY_CHAIN];
+static int16_t anBenchCellData[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN * BENCH_NO_OF_CELLS];
+static uint64_t nBenchReadUs;
+
+/*!
+    @brief  Stimulus code of a cell, unique over all the chains and devices
+*/
+static int16_t bench_cell_code(uint8_t nChainId, uint8_t nDevIdx, uint8_t nCellIdx)
+{
+    return (int16_t)(4000 + (nChainId * 2000) + (nDevIdx * 100) + nCellIdx);
+}
+
+/*!
+    @brief  Position of a cell in the buffer filled by Adbms6948_ReadCellVolt()
+
+    The register group reads order the buffer by register group, then by
+    device: groups A to E hold three cells of every device, group F holds the
+    last cell. The "read all" reads hold all the cells of a device before the
+    next device.
+*/
+static uint16_t bench_cell_index(uint8_t nNoOfDevices, uint8_t nDevIdx, uint8_t nCellIdx)
+{
+#ifdef ADI_LEGACY_GRP_SUPPORT
+    uint16_t nGrp = nCellIdx / BENCH_CELLS_PER_REGGRP;
+    uint16_t nCellsInGrp = (nCellIdx < (BENCH_NO_OF_CELLS - 1u)) ? BENCH_CELLS_PER_REGGRP : 1u;
+
+    return (uint16_t)((nGrp * BENCH_CELLS_PER_REGGRP * nNoOfDevices) +
+                      (nDevIdx * nCellsInGrp) + (nCellIdx % BENCH_CELLS_PER_REGGRP));
+#else
+    (void)nNoOfDevices;
+    return (uint16_t)((nDevIdx * BENCH_NO_OF_CELLS) + nCellIdx);
+#endif
+}
+
+/*!
+    @brief  Initialize the driver with @c nNoOfDevices devices on every chain
+
+    The driver is de-initialized first when it runs with another device count.
+
+    @return 0 on success, non-zero otherwise
+*/
+static int bench_init(uint8_t nNoOfDevices)
+{
+    static Adbms6948_CfgType oCfg;
+    int nRet = 0;
+
+    if(oCfg.Adbms6948_pDaisyChainCfg != NULL_PTR) {
+        nRet = (int)Adbms6948_DeInit();
+    }
+
+    for(uint8_t nChainId = 0u; nChainId < ADBMS6948_NO_OF_DAISY_CHAIN; nChainId++) {
+        aoBenchChainCfg[nChainId] = Adbms6948ConfigSet_0_PB.Adbms6948_pDaisyChainCfg[0];
+        aoBenchChainCfg[nChainId].Adbms6948_nNoOfDevices = nNoOfDevices;
+        aoBenchChainCfg[nChainId].Adbms6948_pNoOfCellsPerDevice = anBenchCellsPerDevice;
+        adi_bms_sim_Init(nChainId, nNoOfDevices);
+        for(uint8_t nDevIdx = 0u; nDevIdx < nNoOfDevices; nDevIdx++) {
+            for(uint8_t nCellIdx = 0u; nCellIdx < BENCH_NO_OF_CELLS; nCellIdx++) {
+                adi_bms_sim_SetCellVoltage(nChainId, nDevIdx, nCellIdx, bench_cell_code(nChainId, nDevIdx, nCellIdx));
+            }
+        }
+    }
+    oCfg.Adbms6948_pDaisyChainCfg = aoBenchChainCfg;
+    oCfg.Adbms6948_pRunTimeErrCfg = Adbms6948ConfigSet_0_PB.Adbms6948_pRunTimeErrCfg;
+
+    if(nRet == 0) {
+        nRet = (int)Adbms6948_Init(&oCfg);
+    }
+    return nRet;
+}
+
+/*!
+    @brief  Convert and read the cell voltages of every device on every chain
+
+    The time spent reading the cells, without the conversion and the polls, is
+    accumulated in nBenchReadUs.
+
+    @return Number of cells not matching the stimulus, -1 if the scan failed
+*/
+static int bench_scan(uint8_t nNoOfDevices)
+{
+    Adbms6948_TrigCADCInputs oTrigCADCInputs = {
+        FALSE,                  /*Adbms6948_bContMode*/
+        FALSE,                  /*Adbms6948_bEnRedun*/
+        FALSE,                  /*Adbms6948_bEnSSDP*/
+        TRUE,                   /*Adbms6948_bRstIIRFltr*/
+        ADBMS6948_CELL_OW_NONE  /*Adbms6948_eOWSel*/
+    };
+    int nMismatch = 0;
+    boolean bBusy;
+    uint16_t nPolls;
+    uint64_t nStartUs;
+
+    nBenchReadUs = 0u;
+
+    for(uint8_t nChainId = 0u; (nChainId < ADBMS6948_NO_OF_DAISY_CHAIN) && (nMismatch >= 0); nChainId++) {
+        if(Adbms6948_TrigCADC(&oTrigCADCInputs, nChainId) != E_OK) {
+            nMismatch = -1;
+        }
+    }
+    for(uint8_t nChainId = 0u; (nChainId < ADBMS6948_NO_OF_DAISY_CHAIN) && (nMismatch >= 0); nChainId++) {
+        nPolls = 0u;
+        do {
+            if(Adbms6948_PollADCStatus(ADBMS6948_ADC_CADC, &bBusy, nChainId) != E_OK) {
+                nMismatch = -1;
+            }
+        } while((nMismatch >= 0) && (bBusy == TRUE) && (++nPolls < 1000u));
+
+        memset(anBenchCellData, 0, sizeof(anBenchCellData));
+        nStartUs = adi_bms_sim_GetTimeUs();
+        if((nMismatch < 0) || (Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA, ADBMS6948_CELL_GRP_SEL_ALL,
+                                                      anBenchCellData, ADBMS6948_SEND_BOTH, nChainId) != E_OK)) {
+            nMismatch = -1;
+        }
+        nBenchReadUs += adi_bms_sim_GetTimeUs() - nStartUs;
+        for(uint8_t nDevIdx = 0u; (nDevIdx < nNoOfDevices) && (nMismatch >= 0); nDevIdx++) {
+            for(uint8_t nCellIdx = 0u; nCellIdx < BENCH_NO_OF_CELLS; nCellIdx++) {
+                if(anBenchCellData[bench_cell_index(nNoOfDevices, nDevIdx, nCellIdx)] !=
+                   bench_cell_code(nChainId, nDevIdx, nCellIdx)) {
+                    nMismatch++;
+                }
+            }
+        }
+    }
+    return nMismatch;
+}
+
+int main(void)
+{
+    double adReadUs[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN + 1u];
+    double dSumN = 0.0, dSumT = 0.0, dSumNN = 0.0, dSumNT = 0.0, dSlope, dOffset, dDev, dMaxDev = 0.0;
+    uint8_t nNoOfDevices;
+    uint64_t nStartUs, nScanUs;
+    int nMismatch, nRet = 0;
+
+    adi_pal_Init();
+    memset(anBenchCellsPerDevice, BENCH_NO_OF_CELLS, sizeof(anBenchCellsPerDevice));
+
+    printf("chains=%u max_devices=%u\n", (unsigned)ADBMS6948_NO_OF_DAISY_CHAIN,
+           (unsigned)ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN);
+    printf("devices,scan_us,read_us,read_us_per_device,cells_checked,mismatches\n");
+
+    for(nNoOfDevices = 1u; nNoOfDevices <= ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN; nNoOfDevices++) {
+        if(bench_init(nNoOfDevices) != 0) {
+            printf("%u,init failed\n", (unsigned)nNoOfDevices);
+            nRet = 1;
+            break;
+        }
+        nStartUs = adi_bms_sim_GetTimeUs();
+        nMismatch = bench_scan(nNoOfDevices);
+        nScanUs = adi_bms_sim_GetTimeUs() - nStartUs;
+        adReadUs[nNoOfDevices] = (double)nBenchReadUs;
+        printf("%u,%u,%u,%.1f,%u,%d\n", (unsigned)nNoOfDevices, (unsigned)nScanUs, (unsigned)nBenchReadUs,
+               adReadUs[nNoOfDevices] / nNoOfDevices,
+               (unsigned)(nNoOfDevices * BENCH_NO_OF_CELLS * ADBMS6948_NO_OF_DAISY_CHAIN), nMismatch);
+        if(nMismatch != 0) {
+            nRet = 1;
+        }
+        dSumN += nNoOfDevices;
+        dSumT += adReadUs[nNoOfDevices];
+        dSumNN += (double)nNoOfDevices * nNoOfDevices;
+        dSumNT += nNoOfDevices * adReadUs[nNoOfDevices];
+    }
+
+    if((nRet == 0) && (ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN > 1u)) {
+        /* Least squares line through the read times, the conversion time does not depend on the devices */
+        nNoOfDevices = ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN;
+        dSlope = ((nNoOfDevices * dSumNT) - (dSumN * dSumT)) / ((nNoOfDevices * dSumNN) - (dSumN * dSumN));
+        dOffset = (dSumT - (dSlope * dSumN)) / nNoOfDevices;
+        for(uint8_t nIdx = 1u; nIdx <= nNoOfDevices; nIdx++) {
+            dDev = adReadUs[nIdx] - (dOffset + (dSlope * nIdx));
+            dDev = (dDev < 0.0) ? -dDev : dDev;
+            dMaxDev = (dDev > dMaxDev) ? dDev : dMaxDev;
+        }
+        printf("fit: read_us = %.0f + %.1f * devices, max deviation %.1f us\n", dOffset, dSlope, dMaxDev);
+        if(dMaxDev > BENCH_LINEARITY_TOL_US) {
+            printf("read time is not linear in the number of devices\n");
+            nRet = 1;
+        }
+    }
+    printf("%s\n", (nRet == 0) ? "PASS" : "FAIL");
+    return nRet;
+}
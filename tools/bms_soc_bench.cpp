@@ -0,0 +1,192 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_soc_bench.cpp
+ * @brief   Host benchmark of the state of charge estimator. For every device
+ *          count, 16 cells each, a string of simulated cells with spread
+ *          initial states of charge and capacities follows a pulsed current
+ *          profile; the cell voltages are quantized to cell codes with noise
+ *          and fed to BmsSoc_Update, which starts 10 % off. The time spent in
+ *          BmsSoc_Update is measured per update and per cell and fitted
+ *          against the cell count, and the largest state of charge error
+ *          after convergence is checked.
+ *
+ *          g++ -std=c++14 -O2 -Iinc src/bms_soc.cpp tools/bms_soc_bench.cpp -o bms_soc_bench
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+#include "bms_soc.h"
+#include "bms_units.h"
+
+/*! Cells of a device */
+#define BENCH_CELLS_PER_DEVICE      (16u)
+/*! Devices of the largest string */
+#define BENCH_MAX_DEVICES           (BMS_SOC_MAX_CELLS / BENCH_CELLS_PER_DEVICE)
+/*! Time step, the default period of the acquisition engine */
+#define BENCH_DT_S                  (0.05f)
+/*! Updates per device count, 20 minutes */
+#define BENCH_NO_OF_UPDATES         (24000u)
+/*! Updates before the error is checked */
+#define BENCH_SETTLE_UPDATES        (6000u)
+/*! Largest state of charge error after convergence */
+#define BENCH_MAX_SOC_ERR           (0.02f)
+/*! Standard deviation of the voltage noise, volts */
+#define BENCH_NOISE_V               (0.0005f)
+
+static const int32_t kanBenchOcvUv[] = {
+    3000000, 3450000, 3550000, 3620000, 3680000, 3740000,
+    3820000, 3900000, 3980000, 4070000, 4180000
+};
+
+static const BMS_SOC_CFG koBenchCfg = {
+    kanBenchOcvUv,
+    (uint8_t)(sizeof(kanBenchOcvUv) / sizeof(kanBenchOcvUv[0])),
+    0.0015f,        /*fR0*/
+    0.0010f,        /*fR1*/
+    20.0f,          /*fTau1*/
+    50.0f,          /*fCapacityAh*/
+    1.0f,           /*fChargeEfficiency*/
+    1e-7f,          /*fProcNoiseSoc*/
+    1e-6f,          /*fProcNoiseVrc*/
+    BENCH_NOISE_V * BENCH_NOISE_V * 4.0f, /*fMeasNoise*/
+    0.01f           /*fInitVarSoc*/
+};
+
+static BMS_SOC_STATE oBenchState;
+static float afBenchSoc[BMS_SOC_MAX_CELLS];
+static float afBenchVrc[BMS_SOC_MAX_CELLS];
+static float afBenchCap[BMS_SOC_MAX_CELLS];
+static int16_t anBenchCells[BMS_SOC_MAX_CELLS];
+static uint32_t nBenchSeed = 1u;
+
+/*!
+    @brief  Uniform pseudo random number in [0, 1)
+*/
+static float bench_rand(void)
+{
+    nBenchSeed = (nBenchSeed * 1664525u) + 1013904223u;
+    return (float)(nBenchSeed >> 8) / 16777216.0f;
+}
+
+/*!
+    @brief  Open circuit voltage of the table, volts
+*/
+static float bench_ocv(float fSoc)
+{
+    float fPos = fSoc * (float)(koBenchCfg.nOcvPoints - 1u);
+    int nSeg = (int)fPos;
+
+    nSeg = (nSeg < 0) ? 0 : ((nSeg > (koBenchCfg.nOcvPoints - 2)) ? (koBenchCfg.nOcvPoints - 2) : nSeg);
+    return ((float)kanBenchOcvUv[nSeg] +
+            ((fPos - (float)nSeg) * (float)(kanBenchOcvUv[nSeg + 1] - kanBenchOcvUv[nSeg]))) * 1e-6f;
+}
+
+/*!
+    @brief  Pulsed current profile: 1C discharge pulses and C/2 charge pulses with rests
+*/
+static float bench_current(uint32_t nStep)
+{
+    uint32_t nPhase = (nStep / 1200u) % 4u;
+
+    return (nPhase == 0u) ? -50.0f : ((nPhase == 2u) ? 25.0f : 0.0f);
+}
+
+/*!
+    @brief  Advance the simulated cells and quantize their voltages to cell codes
+*/
+static void bench_cells(uint16_t nNoOfCells, float fCurrentA)
+{
+    float fA = expf(-BENCH_DT_S / koBenchCfg.fTau1);
+    float fVolt, fNoise;
+
+    for(uint16_t nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+        afBenchSoc[nIdx] += fCurrentA * BENCH_DT_S / (3600.0f * afBenchCap[nIdx]);
+        afBenchVrc[nIdx] = (fA * afBenchVrc[nIdx]) + (koBenchCfg.fR1 * (1.0f - fA) * fCurrentA);
+        fNoise = (bench_rand() + bench_rand() + bench_rand() - 1.5f) * 2.0f * BENCH_NOISE_V;
+        fVolt = bench_ocv(afBenchSoc[nIdx]) + afBenchVrc[nIdx] + (koBenchCfg.fR0 * fCurrentA) + fNoise;
+        anBenchCells[nIdx] = BMS_UNITS_UV_TO_CODE((int32_t)(fVolt * 1e6f));
+    }
+}
+
+/*!
+    @brief  Run the estimator on a string of @c nNoOfDevices devices
+
+    @param[out] pdNsPerUpdate   Time of an update, nanoseconds
+    @param[out] pfMaxErr        Largest state of charge error after convergence
+
+    @return 0 on success, non-zero if the error is too large
+*/
+static int bench_run(uint8_t nNoOfDevices, double *pdNsPerUpdate, float *pfMaxErr)
+{
+    uint16_t nNoOfCells = (uint16_t)(nNoOfDevices * BENCH_CELLS_PER_DEVICE);
+    struct timespec oStart, oEnd;
+    double dNs = 0.0;
+    float fCurrentA, fErr, fMaxErr = 0.0f;
+
+    for(uint16_t nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+        afBenchSoc[nIdx] = 0.4f + (0.4f * bench_rand());
+        afBenchVrc[nIdx] = 0.0f;
+        afBenchCap[nIdx] = koBenchCfg.fCapacityAh * (0.97f + (0.03f * bench_rand()));
+    }
+    bench_cells(nNoOfCells, 0.0f);
+    BmsSoc_Init(&koBenchCfg, &oBenchState, anBenchCells, nNoOfCells);
+    for(uint16_t nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+        oBenchState.afSoc[nIdx] += (nIdx & 1u) ? 0.1f : -0.1f;
+    }
+
+    for(uint32_t nStep = 0u; nStep < BENCH_NO_OF_UPDATES; nStep++) {
+        fCurrentA = bench_current(nStep);
+        bench_cells(nNoOfCells, fCurrentA);
+        clock_gettime(CLOCK_MONOTONIC, &oStart);
+        BmsSoc_Update(&koBenchCfg, &oBenchState, anBenchCells, fCurrentA, BENCH_DT_S);
+        clock_gettime(CLOCK_MONOTONIC, &oEnd);
+        dNs += ((double)(oEnd.tv_sec - oStart.tv_sec) * 1e9) + (double)(oEnd.tv_nsec - oStart.tv_nsec);
+        if(nStep >= BENCH_SETTLE_UPDATES) {
+            for(uint16_t nIdx = 0u; nIdx < nNoOfCells; nIdx++) {
+                fErr = fabsf(oBenchState.afSoc[nIdx] - afBenchSoc[nIdx]);
+                fMaxErr = (fErr > fMaxErr) ? fErr : fMaxErr;
+            }
+        }
+    }
+    *pdNsPerUpdate = dNs / BENCH_NO_OF_UPDATES;
+    *pfMaxErr = fMaxErr;
+    return (fMaxErr > BENCH_MAX_SOC_ERR) ? 1 : 0;
+}
+
+int main(void)
+{
+    double adNs[BENCH_MAX_DEVICES + 1u];
+    double dSumN = 0.0, dSumT = 0.0, dSumNN = 0.0, dSumNT = 0.0, dSlope, dOffset;
+    float fMaxErr;
+    int nRet = 0;
+
+    printf("devices,cells,ns_per_update,ns_per_cell,max_soc_err_pct\n");
+    for(uint8_t nNoOfDevices = 1u; nNoOfDevices <= BENCH_MAX_DEVICES; nNoOfDevices++) {
+        nRet |= bench_run(nNoOfDevices, &adNs[nNoOfDevices], &fMaxErr);
+        printf("%u,%u,%.0f,%.1f,%.2f\n", (unsigned)nNoOfDevices, (unsigned)(nNoOfDevices * BENCH_CELLS_PER_DEVICE),
+               adNs[nNoOfDevices], adNs[nNoOfDevices] / (nNoOfDevices * BENCH_CELLS_PER_DEVICE), fMaxErr * 100.0f);
+        dSumN += nNoOfDevices * BENCH_CELLS_PER_DEVICE;
+        dSumT += adNs[nNoOfDevices];
+        dSumNN += (double)(nNoOfDevices * BENCH_CELLS_PER_DEVICE) * (nNoOfDevices * BENCH_CELLS_PER_DEVICE);
+        dSumNT += (nNoOfDevices * BENCH_CELLS_PER_DEVICE) * adNs[nNoOfDevices];
+    }
+    if(BENCH_MAX_DEVICES > 1u) {
+        dSlope = ((BENCH_MAX_DEVICES * dSumNT) - (dSumN * dSumT)) / ((BENCH_MAX_DEVICES * dSumNN) - (dSumN * dSumN));
+        dOffset = (dSumT - (dSlope * dSumN)) / BENCH_MAX_DEVICES;
+        printf("fit: ns_per_update = %.0f + %.2f * cells, %u cells take %.1f us of a %.0f ms period\n",
+               dOffset, dSlope, (unsigned)BMS_SOC_MAX_CELLS, (dOffset + (dSlope * BMS_SOC_MAX_CELLS)) / 1000.0,
+               (double)BENCH_DT_S * 1000.0);
+    }
+    printf("%s\n", (nRet == 0) ? "PASS" : "FAIL");
+    return nRet;
+}
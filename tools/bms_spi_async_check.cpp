@@ -0,0 +1,211 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_spi_async_check.cpp
+ * @brief   Host check of the asynchronous SPI transport. The host PAL clocks
+ *          every adi_pal_SpiWriteReadAsync frame on a worker thread, so the
+ *          wait of Adbms6948_Cmd_ExecuteCmdRDPipelined really waits and the
+ *          next group is in flight while the previous one is validated.
+ *
+ *          Raw frames are started on the PAL, must be seen in progress and
+ *          must return a valid response once done; an aborted frame must
+ *          report one platform error. Through the driver,
+ *          configuration writes are committed and read back over the
+ *          pipelined register group reads, a PEC error injected into a group
+ *          must still be caught, and the cell voltages are converted and read,
+ *          with ADI_LEGACY_GRP_SUPPORT group by group over the pipeline.
+ *
+ *          g++ -std=c++14 -pthread -DADI_PAL_HOST [-DADI_LEGACY_GRP_SUPPORT]
+ *              -Iinc -IPAL/inc -IADBMS6948/inc -IADBMS6948/lib/inc
+ *              -IADBMS6948/cfg/inc <sources> tools/bms_spi_async_check.cpp
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "Adbms6948.h"
+#include "Adbms6948_ExecCmd.h"
+#include "Adbms6948_Pec.h"
+#include "adi_bms_platform.h"
+#include "adi_bms_sim.h"
+
+/*! Raw frames started on the PAL */
+#define CHECK_NO_OF_RAW_FRAMES      (100u)
+/*! Number of cells read from every device */
+#define CHECK_NO_OF_CELLS           (16u)
+/*! Number of cells in each of the first five cell register groups */
+#define CHECK_CELLS_PER_REGGRP      (3u)
+/*! Length of a register group of one device, including the PEC */
+#define CHECK_REG_LEN_WITH_PEC      (8u)
+
+extern const Adbms6948_CfgType Adbms6948ConfigSet_0_PB;
+
+static uint8_t anCheckTx[4u + (CHECK_REG_LEN_WITH_PEC * ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN)];
+static uint8_t anCheckRx[sizeof(anCheckTx)];
+static int16_t anCheckCellData[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN * CHECK_NO_OF_CELLS];
+
+/*!
+    @brief  Stimulus code of a cell
+*/
+static int16_t check_cell_code(uint8_t nDevIdx, uint8_t nCellIdx)
+{
+    return (int16_t)(6000 + (nDevIdx * 100) + nCellIdx);
+}
+
+/*!
+    @brief  Position of a cell in the buffer filled by Adbms6948_ReadCellVolt(),
+            see tools/bms_scan_bench.cpp
+*/
+static uint16_t check_cell_index(uint8_t nNoOfDevices, uint8_t nDevIdx, uint8_t nCellIdx)
+{
+#ifdef ADI_LEGACY_GRP_SUPPORT
+    uint16_t nGrp = nCellIdx / CHECK_CELLS_PER_REGGRP;
+    uint16_t nCellsInGrp = (nCellIdx < (CHECK_NO_OF_CELLS - 1u)) ? CHECK_CELLS_PER_REGGRP : 1u;
+
+    return (uint16_t)((nGrp * CHECK_CELLS_PER_REGGRP * nNoOfDevices) +
+                      (nDevIdx * nCellsInGrp) + (nCellIdx % CHECK_CELLS_PER_REGGRP));
+#else
+    (void)nNoOfDevices;
+    return (uint16_t)((nDevIdx * CHECK_NO_OF_CELLS) + nCellIdx);
+#endif
+}
+
+/*!
+    @brief  Read configuration register A with raw asynchronous frames
+
+    @param[out] pnPending   Frames seen in progress right after their start
+    @return Frames with a PEC error in the response of any device
+*/
+static uint32_t check_raw_frames(uint8_t nNoOfDevices, uint32_t *pnPending)
+{
+    boolean abPecMatch[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+    uint8_t anCmdCnt[ADBMS6948_MAX_NO_OF_DEVICES_IN_DAISY_CHAIN];
+    uint16_t nCmdPec = Adbms6948_Pec15Command(ADBMS6948_CMD_RDCFGA);
+    uint16_t nFrameLen = (uint16_t)(4u + (CHECK_REG_LEN_WITH_PEC * nNoOfDevices));
+    uint32_t nBad = 0u;
+
+    *pnPending = 0u;
+    memset(anCheckTx, 0xFF, sizeof(anCheckTx));
+    anCheckTx[0] = (uint8_t)(ADBMS6948_CMD_RDCFGA >> 8u);
+    anCheckTx[1] = (uint8_t)ADBMS6948_CMD_RDCFGA;
+    anCheckTx[2] = (uint8_t)(nCmdPec >> 8u);
+    anCheckTx[3] = (uint8_t)nCmdPec;
+
+    for(uint32_t nFrame = 0u; nFrame < CHECK_NO_OF_RAW_FRAMES; nFrame++) {
+        memset(anCheckRx, 0, sizeof(anCheckRx));
+        adi_pal_SpiWriteReadAsync(anCheckTx, anCheckRx, nFrameLen, 0u);
+        if(adi_pal_IsSpiTransferDone(0u) == FALSE) {
+            (*pnPending)++;
+        }
+        while(adi_pal_IsSpiTransferDone(0u) == FALSE) {
+        }
+        if(Adbms6948_Pec10ValidateSlices(&anCheckRx[4], CHECK_REG_LEN_WITH_PEC, nNoOfDevices,
+                                         abPecMatch, anCmdCnt) != 0u) {
+            nBad++;
+        }
+    }
+    return nBad;
+}
+
+/*!
+    @brief  Convert the cells and read them back
+
+    @return Number of cells not matching the stimulus, -1 if the read failed
+*/
+static int check_cells(uint8_t nNoOfDevices)
+{
+    Adbms6948_TrigCADCInputs oTrigCADCInputs = {
+        FALSE,                  /*Adbms6948_bContMode*/
+        FALSE,                  /*Adbms6948_bEnRedun*/
+        FALSE,                  /*Adbms6948_bEnSSDP*/
+        TRUE,                   /*Adbms6948_bRstIIRFltr*/
+        ADBMS6948_CELL_OW_NONE  /*Adbms6948_eOWSel*/
+    };
+    int nMismatch = 0;
+    boolean bBusy = TRUE;
+    uint16_t nPolls = 0u;
+
+    if(Adbms6948_TrigCADC(&oTrigCADCInputs, 0u) != E_OK) {
+        nMismatch = -1;
+    }
+    while((nMismatch >= 0) && (bBusy == TRUE) && (++nPolls < 1000u)) {
+        if(Adbms6948_PollADCStatus(ADBMS6948_ADC_CADC, &bBusy, 0u) != E_OK) {
+            nMismatch = -1;
+        }
+    }
+    if((nMismatch < 0) || (Adbms6948_ReadCellVolt(ADBMS6948_CELL_MEAS_DATA, ADBMS6948_CELL_GRP_SEL_ALL,
+                                                  anCheckCellData, ADBMS6948_SEND_BOTH, 0u) != E_OK)) {
+        nMismatch = -1;
+    }
+    for(uint8_t nDevIdx = 0u; (nDevIdx < nNoOfDevices) && (nMismatch >= 0); nDevIdx++) {
+        for(uint8_t nCellIdx = 0u; nCellIdx < CHECK_NO_OF_CELLS; nCellIdx++) {
+            if(anCheckCellData[check_cell_index(nNoOfDevices, nDevIdx, nCellIdx)] != check_cell_code(nDevIdx, nCellIdx)) {
+                nMismatch++;
+            }
+        }
+    }
+    return nMismatch;
+}
+
+int main(void)
+{
+    uint8_t nNoOfDevices = Adbms6948ConfigSet_0_PB.Adbms6948_pDaisyChainCfg[0].Adbms6948_nNoOfDevices;
+    Adbms6948_OVThresCfgType nOVThreshold = 0x0A28u;
+    Adbms6948_UVThresCfgType nUVThreshold = 0x03E8u;
+    uint32_t nPending, nBad;
+    int nRet = 0, nStep;
+
+    adi_pal_Init();
+    for(uint8_t nDevIdx = 0u; nDevIdx < nNoOfDevices; nDevIdx++) {
+        for(uint8_t nCellIdx = 0u; nCellIdx < CHECK_NO_OF_CELLS; nCellIdx++) {
+            adi_bms_sim_SetCellVoltage(0u, nDevIdx, nCellIdx, check_cell_code(nDevIdx, nCellIdx));
+        }
+    }
+
+    nStep = (int)Adbms6948_Init(&Adbms6948ConfigSet_0_PB);
+    printf("init: %d\n", nStep);
+    nRet |= nStep;
+
+    nBad = check_raw_frames(nNoOfDevices, &nPending);
+    printf("raw frames: %u, in progress after start %u, pec errors %u\n", (unsigned)CHECK_NO_OF_RAW_FRAMES,
+           (unsigned)nPending, (unsigned)nBad);
+    nRet |= ((nPending == 0u) || (nBad != 0u)) ? 1 : 0;
+
+    /* The error of an aborted frame is reported once */
+    adi_pal_SpiWriteReadAsync(anCheckTx, anCheckRx, (uint16_t)sizeof(anCheckTx), 0u);
+    adi_pal_AbortSpiTransfer(0u);
+    nStep = (adi_pal_IsError(0u) == TRUE) ? 0 : 1;
+    nStep |= (adi_pal_IsError(0u) == FALSE) ? 0 : 1;
+    nStep |= (adi_pal_IsSpiTransferDone(0u) == TRUE) ? 0 : 1;
+    printf("aborted frame: %d\n", nStep);
+    nRet |= nStep;
+
+    /* Both writes land in one commit, read back over the pipeline */
+    nStep = (int)Adbms6948_CfgBegin(0u);
+    nStep |= (int)Adbms6948_CfgOVThreshold(&nOVThreshold, 0u);
+    nStep |= (int)Adbms6948_CfgUVThreshold(&nUVThreshold, 0u);
+    nStep |= (int)Adbms6948_CfgCommit(0u);
+    nStep |= (int)Adbms6948_CheckChainCfg(0u);
+    printf("configuration write and read back: %d\n", nStep);
+    nRet |= nStep;
+
+    adi_bms_sim_InjectPecError(0u, 0u);
+    nStep = (int)Adbms6948_CheckChainCfg(0u);
+    printf("read back with a pec error: %d\n", nStep);
+    nRet |= (nStep == (int)E_OK) ? 1 : 0;
+
+    nStep = check_cells(nNoOfDevices);
+    printf("cells: %u checked, %d mismatches\n", (unsigned)(nNoOfDevices * CHECK_NO_OF_CELLS), nStep);
+    nRet |= (nStep != 0) ? 1 : 0;
+
+    adi_pal_DeInit();
+    printf("%s\n", (nRet == 0) ? "PASS" : "FAIL");
+    return (nRet == 0) ? 0 : 1;
+}
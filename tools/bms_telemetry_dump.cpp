@@ -0,0 +1,64 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_telemetry_dump.cpp
+ * @brief   Host tool decoding a captured binary telemetry stream into CSV.
+ *          Reads the capture from the file given as argument, or stdin.
+ *          Text printed by the firmware between frames is dropped as bad
+ *          frames and reported in the summary on stderr.
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include "bms_telemetry.h"
+
+int main(int argc, char *argv[])
+{
+    FILE *pIn = (argc > 1) ? fopen(argv[1], "rb") : stdin;
+    BMS_TLM_DECODER oDec;
+    BMS_TLM_MSG oMsg;
+    int nByte;
+
+    if(pIn == NULL) {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    BmsTlm_DecoderInit(&oDec);
+    printf("seq,timestamp_us,voltage_ct,current_ct,current");
+    for(uint8_t nCell = 0u; nCell < BMS_TLM_MAX_CELLS; nCell++) {
+        printf(",c%u", (unsigned)(nCell + 1u));
+    }
+    printf("\n");
+
+    while((nByte = fgetc(pIn)) != EOF) {
+        if(BmsTlm_DecoderPush(&oDec, (uint8_t)nByte, &oMsg) != BMS_TLM_DEC_MSG) {
+            continue;
+        }
+        if(oMsg.nMsgType == BMS_TLM_MSG_SAMPLE) {
+            printf("%" PRIu32 ",%" PRIu64 ",%u,%u,%" PRId32, oMsg.u.oSample.nSeqNum, oMsg.u.oSample.nTimestampUs,
+                   (unsigned)oMsg.u.oSample.nVoltageCT, (unsigned)oMsg.u.oSample.nCurrentCT, oMsg.u.oSample.nCurrent);
+            for(uint8_t nCell = 0u; nCell < oMsg.u.oSample.nNoOfCells; nCell++) {
+                printf(",%d", oMsg.u.oSample.anCellVoltage[nCell]);
+            }
+            printf("\n");
+        } else {
+            fprintf(stderr, "stats: samples=%" PRIu32 " overruns=%" PRIu32 " read_errors=%" PRIu32 " max_lateness_us=%" PRIu32 "\n",
+                    oMsg.u.oStats.nSamples, oMsg.u.oStats.nOverruns, oMsg.u.oStats.nReadErrors, oMsg.u.oStats.nMaxLatenessUs);
+        }
+    }
+    fprintf(stderr, "frames: %" PRIu32 " decoded, %" PRIu32 " dropped\n", oDec.nMsgs, oDec.nErrors);
+
+    if(pIn != stdin) {
+        fclose(pIn);
+    }
+    return 0;
+}
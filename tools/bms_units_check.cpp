@@ -0,0 +1,121 @@
+/*!
+******************************************************************************
+Copyright (c) 2022 Analog Devices, Inc. All Rights Reserved.
+This software is proprietary & confidential to Analog Devices, Inc. and its
+licensors. By using this software you agree to the terms of the associated
+Analog Devices License Agreement.
+******************************************************************************
+ * @file    bms_units_check.cpp
+ * @brief   Host check of the fixed-point unit conversions. Every cell code
+ *          must survive the round trip through microvolts, the offset and
+ *          the rounding of BMS_UNITS_UV_TO_CODE are pinned at 1.5 V and at the
+ *          limits of the code range, the supply, die temperature and current
+ *          scalings are pinned at their limits, and the thermistor table is
+ *          compared with the fit it samples.
+ *
+ *          g++ -std=c++14 -Iinc src/bms_units.cpp tools/bms_units_check.cpp -o bms_units_check
+ * @version $Revision$
+ * @date    $Date$
+ *
+ * Developed by: ADI BMS Applications Team, Bangalore, India
+*****************************************************************************/
+
+#include <stdio.h>
+#include "bms_units.h"
+
+/*! Largest deviation of the thermistor interpolation from the fit, milli-degrees Celsius */
+#define CHECK_NTC_TOL_MDEGC         (11.0)
+
+static int nCheckFailures = 0;
+
+/*!
+    @brief  Compare a conversion with its expected value
+*/
+static void check_equal(const char *pName, int64_t nGot, int64_t nExpected)
+{
+    if(nGot != nExpected) {
+        printf("%s: %lld, expected %lld\n", pName, (long long)nGot, (long long)nExpected);
+        nCheckFailures++;
+    }
+}
+
+/*!
+    @brief  Thermistor temperature of the GPIO divider fit, milli-degrees Celsius
+*/
+static double check_ntc_fit(int32_t nGpioCode)
+{
+    double dVolt = ((double)nGpioCode * 0.000150) + 1.5;
+
+    return ((6.0694 * dVolt * dVolt) - (54.0728 * dVolt) + 92.2345) * 1000.0;
+}
+
+int main(void)
+{
+    int16_t anCode[3] = {INT16_MIN, 0, INT16_MAX};
+    int32_t anUv[3], anMilliDegC[3];
+    int32_t nCode, nRoundTrips = 0;
+    double dDev, dMaxDev = 0.0;
+
+    /* Every code to microvolts and back */
+    for(nCode = INT16_MIN; nCode <= INT16_MAX; nCode++) {
+        if(BMS_UNITS_UV_TO_CODE(BMS_UNITS_CODE_TO_UV(nCode)) != nCode) {
+            nCheckFailures++;
+        } else {
+            nRoundTrips++;
+        }
+    }
+    printf("code round trips: %ld of 65536\n", (long)nRoundTrips);
+
+    /* Offset and limits of the code range */
+    check_equal("uv(0)", BMS_UNITS_CODE_TO_UV(0), 1500000);
+    check_equal("uv(1)", BMS_UNITS_CODE_TO_UV(1), 1500150);
+    check_equal("uv(-10000)", BMS_UNITS_CODE_TO_UV(-10000), 0);
+    check_equal("uv(min)", BMS_UNITS_CODE_TO_UV(INT16_MIN), -3415200);
+    check_equal("uv(max)", BMS_UNITS_CODE_TO_UV(INT16_MAX), 6415050);
+
+    /* Rounding towards 1.5 V, from both sides and at the limits */
+    check_equal("code(1500149)", BMS_UNITS_UV_TO_CODE(1500149), 0);
+    check_equal("code(1499851)", BMS_UNITS_UV_TO_CODE(1499851), 0);
+    check_equal("code(1500150)", BMS_UNITS_UV_TO_CODE(1500150), 1);
+    check_equal("code(1499850)", BMS_UNITS_UV_TO_CODE(1499850), -1);
+    check_equal("code(6415199)", BMS_UNITS_UV_TO_CODE(6415199), INT16_MAX);
+    check_equal("code(-3415349)", BMS_UNITS_UV_TO_CODE(-3415349), INT16_MIN);
+
+    /* Supply, die temperature and currents at the limits */
+    check_equal("vp(max)", BMS_UNITS_VP_CODE_TO_UV(INT16_MAX), 160376250);
+    check_equal("vp(min)", BMS_UNITS_VP_CODE_TO_UV(INT16_MIN), -85380000);
+    check_equal("itmp(0)", BMS_UNITS_ITMP_CODE_TO_MDEGC(0), -73000);
+    check_equal("itmp(max)", BMS_UNITS_ITMP_CODE_TO_MDEGC(INT16_MAX), 582340);
+    check_equal("i(1)", BMS_UNITS_CURRENT_CODE_TO_NV(1), 1000);
+    check_equal("i(-2^21)", BMS_UNITS_CURRENT_CODE_TO_NV(-2097152), -2097152000);
+    check_equal("iavg(1)", BMS_UNITS_AVG_CURRENT_CODE_TO_NV(1), 125);
+    check_equal("iavg(2^24-1)", BMS_UNITS_AVG_CURRENT_CODE_TO_NV(16777215), 2097151875);
+
+    /* Array conversion matches the macro */
+    BmsUnits_CodesToUv(anCode, anUv, 3u);
+    for(uint8_t nIdx = 0u; nIdx < 3u; nIdx++) {
+        check_equal("CodesToUv", anUv[nIdx], BMS_UNITS_CODE_TO_UV(anCode[nIdx]));
+    }
+
+    /* Thermistor: clamped outside the table, within the tolerance of the fit inside */
+    check_equal("ntc(min)", BmsUnits_ThermistorMilliDegC(INT16_MIN), 92234);
+    check_equal("ntc(0 V)", BmsUnits_ThermistorMilliDegC(BMS_UNITS_NTC_FIRST_CODE), 92234);
+    check_equal("ntc(max)", BmsUnits_ThermistorMilliDegC(INT16_MAX), -26912);
+    for(nCode = BMS_UNITS_NTC_FIRST_CODE;
+        nCode <= (BMS_UNITS_NTC_FIRST_CODE + ((int32_t)(BMS_UNITS_NTC_NO_OF_POINTS - 1u) * BMS_UNITS_NTC_STEP_CODES)); nCode++) {
+        dDev = (double)BmsUnits_ThermistorMilliDegC((int16_t)nCode) - check_ntc_fit(nCode);
+        dDev = (dDev < 0.0) ? -dDev : dDev;
+        dMaxDev = (dDev > dMaxDev) ? dDev : dMaxDev;
+    }
+    printf("thermistor: max deviation from the fit %.1f mdegC\n", dMaxDev);
+    if(dMaxDev > CHECK_NTC_TOL_MDEGC) {
+        nCheckFailures++;
+    }
+    BmsUnits_GpiosToMilliDegC(anCode, anMilliDegC, 3u);
+    for(uint8_t nIdx = 0u; nIdx < 3u; nIdx++) {
+        check_equal("GpiosToMilliDegC", anMilliDegC[nIdx], BmsUnits_ThermistorMilliDegC(anCode[nIdx]));
+    }
+
+    printf("%s\n", (nCheckFailures == 0) ? "PASS" : "FAIL");
+    return (nCheckFailures == 0) ? 0 : 1;
+}